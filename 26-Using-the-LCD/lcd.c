@@ -46,6 +46,15 @@
 
 //#define LCD_EMULATION
 
+/*
+ * When LCD_USE_MASK_TABLE is defined, characters in positions 1 to 11 are written using
+ * the masks in lcdmasks.h. It is generated by tools/lcdgen.c, which compiles this file
+ * with LCD_NO_MASK_TABLE defined.
+ */
+#ifndef LCD_NO_MASK_TABLE
+#define LCD_USE_MASK_TABLE
+#endif
+
 
 #include  <stdint.h>
 #include "lcd.h"
@@ -69,7 +78,7 @@
  * @brief Macros to control Freeze/Unfreeze
  * @note  Can be overridden for debugging
  */
-#ifdef DO_NOT_USE_FREEZE
+#if defined(DO_NOT_USE_FREEZE) || defined(LCD_EMULATION)
 #define LCD_FREEZE
 #define LCD_UNFREEZE
 #else
@@ -88,6 +97,22 @@ typedef struct {
     uint32_t    lo;
 } SegEncoding_t;
 
+#ifdef LCD_USE_MASK_TABLE
+#include "lcdmasks.h"
+/*
+ * Masks pack both registers in one word (lo = mask&~0xFF, hi = mask&0xFF). So character
+ * positions must not use lo bits 0-7 nor hi bits 8-31
+ */
+#if (LCDMASKS_LOBITS&0xFFUL) != 0 || (LCDMASKS_HIBITS&~0xFFUL) != 0
+#error "lcdmasks.h: masks cannot be packed"
+#endif
+#endif
+
+
+/**
+ * Interrupt priority for the frame counter interrupt
+ */
+#define LCD_INT_LEVEL   3
 
 /**
  * Flag. When set, LCD clock is initialized.
@@ -786,6 +811,7 @@ lcddata_t lcd[8];
  * @brief pointer to segment data registers
  */
 //{
+#ifndef LCD_EMULATION
 volatile uint32_t  * const segdatalow[8] = {
     &(LCD->SEGD0L),&(LCD->SEGD1L),&(LCD->SEGD2L),&(LCD->SEGD3L),
     &(LCD->SEGD4L),&(LCD->SEGD5L),&(LCD->SEGD6L),&(LCD->SEGD7L)
@@ -797,8 +823,85 @@ volatile uint32_t  * const segdatahigh[8] = {
 // To simplify assignements
 #define SEGDATALOW  *segdatalow
 #define SEGDATAHIGH *segdatahigh
+#endif
 //}
 
+/**
+ * @brief  Shadow of the segment data registers
+ *
+ * @note   Indexed by controller common number. All write functions change only the
+ *         shadow and set the bit of the changed common lines in lcddirty.
+ * @note   LCD_Commit copies the changed registers to the controller in a single freeze.
+ *         Common lines whose data did not change are not marked and not written.
+ * @note   When lcdautocommit is set (default), public write functions call LCD_Commit
+ *         before returning. LCD_SetAutoCommit(0) allows grouping many writes in one update.
+ */
+///@{
+static SegEncoding_t lcdshadow[8];
+static uint8_t lcddirty      = 0;
+static uint8_t lcdautocommit = 1;
+///@}
+
+/**
+ * @brief  Critical section
+ *
+ * @note   The shadow is also changed by the frame counter interrupt (animation)
+ * @note   PRIMASK is saved in m and restored, so they can be nested and used in
+ *         interrupt handlers (LCD_IRQHandler)
+ */
+#ifdef LCD_EMULATION
+#define ENTER_ATOMIC(m) ((m) = 0)
+#define EXIT_ATOMIC(m)  ((void) (m))
+#else
+#define ENTER_ATOMIC(m) do { (m) = __get_PRIMASK(); __disable_irq(); } while(0)
+#define EXIT_ATOMIC(m)  __set_PRIMASK(m)
+#endif
+
+/**
+ * @brief  Update the shadow of one common line
+ *
+ * @note   Bits in clear are cleared and then bits in set are set. The common line is
+ *         marked as dirty only when the result differs from the current value
+ */
+static void UpdateShadow(uint8_t comn, SegEncoding_t clear, SegEncoding_t set) {
+uint32_t lo,hi;
+uint32_t primask;
+
+    ENTER_ATOMIC(primask);
+    lo = (lcdshadow[comn].lo&~clear.lo)|set.lo;
+    hi = (lcdshadow[comn].hi&~clear.hi)|set.hi;
+    if( lo != lcdshadow[comn].lo || hi != lcdshadow[comn].hi ) {
+        lcdshadow[comn].lo = lo;
+        lcdshadow[comn].hi = hi;
+        lcddirty |= BIT(comn);
+    }
+    EXIT_ATOMIC(primask);
+}
+
+/**
+ * @brief  Fill the shadow of all common lines with the same value
+ */
+static void FillShadow(uint32_t lo, uint32_t hi) {
+SegEncoding_t all = { 0xFFFFFFFF, 0xFFFFFFFF };
+SegEncoding_t v;
+uint8_t comn;
+
+    v.lo = lo;
+    v.hi = hi;
+    for(comn=0;comn<8;comn++) {
+        UpdateShadow(comn,all,v);
+    }
+}
+
+/**
+ * @brief  Commit if auto commit is enabled
+ */
+static inline void AutoCommit(void) {
+
+    if( lcdautocommit )
+        LCD_Commit();
+}
+
 /**
  * @brief   Set Clock for LCD module
  *
@@ -1031,12 +1134,14 @@ uint32_t LCD_SetClock(uint32_t presc, uint32_t div) {
         if ( div > 7 ) div = 7;
     }
 
+#ifndef LCD_EMULATION
     /* Configure LCD Clock */
     CMU->LFAPRESC0 =    (CMU->LFAPRESC0&(~_CMU_LFAPRESC0_LCD_MASK))
                     |   presc<<_CMU_LFAPRESC0_LCD_SHIFT;
 
     CMU->LCDCTRL =      (CMU->LCDCTRL&(~_CMU_LCDCTRL_FDIV_MASK))
                     |   (div<<_CMU_LCDCTRL_FDIV_SHIFT);
+#endif
 
     return 0;
 }
@@ -1090,17 +1195,18 @@ uint32_t rc;
  *
  */
 uint32_t LCD_Config(uint32_t presc, uint32_t div) {
-#ifdef LCD_EMULATION
 int i;
 
-    /* Initializes area for segment information */
+    /* Initializes shadow. All registers are written in the next commit */
     for(i=0;i<8;i++) {
-        lcd[i].hi = 0;
-        lcd[i].lo = 0;
+        lcdshadow[i].hi = 0;
+        lcdshadow[i].lo = 0;
     }
+    lcddirty = 0xFF;
+#ifdef LCD_EMULATION
+    LCD_Commit();
 #else
 uint32_t segen;
-int i;
 uint32_t dispctrl;
 uint32_t m,m4;
 SegEncoding_t used = { 0,0 };
@@ -1175,6 +1281,15 @@ SegEncoding_t used = { 0,0 };
      * Enable LCD after configuration
      */
     LCD->CTRL |= LCD_CTRL_EN;
+
+    LCD_Commit();
+
+    /*
+     * Frame counter interrupt is used by the animation. It is enabled in IEN only when needed
+     */
+    NVIC_SetPriority(LCD_IRQn,LCD_INT_LEVEL);
+    NVIC_ClearPendingIRQ(LCD_IRQn);
+    NVIC_EnableIRQ(LCD_IRQn);
 #endif
     return 0;
 }
@@ -1185,34 +1300,18 @@ SegEncoding_t used = { 0,0 };
 #define GENBITMASK1(N)  ((1UL<<((N)+1))-1)
 
 /**
- *  @brief  Write an ASCII character at the specified position
- *
- *  @param  c:   character to be written
- *  @param  pos: position where character is to be written
+ *  @brief  Set the segments of a position in the shadow
  *
- *  @note   When LCD_EMULATION is set, all writes happen to a 8 position array
+ *  @param  segments: bit mask with display segments (A-Q,DP) to be lit
+ *  @param  pos:      position (1 to 14)
  *
+ *  @note   All segments of the position are cleared before setting the new ones
  */
-
-void LCD_WriteChar(uint8_t c, uint8_t pos) {
-uint32_t segments,m;
+static void WriteSegments(uint32_t segments, uint8_t pos) {
+uint32_t m;
 uint8_t sn,comn,segn,comnrev;
 SegEncoding_t s[8] = { {0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0} };
 
-    if( pos < 1 || pos > 14 )
-        return;
-    /*
-     * looks for segments to be lit
-     * table contains only character with
-     */
-    if( pos >=1 && pos <= 7 )           segments = segments14forchar[c-' '];
-    else if( pos >= 8 && pos <= 11 )    segments = segments7forchar[c-' '];
-    else if( pos == 12 ) segments = GENBITMASK1(c-'0');
-    else if( pos == 13 ) segments = GENBITMASK1(c-'0');
-    else if( pos == 14 ) segments = GENBITMASK1(c-'0');
-    else segments = 0;
-
-
     /*
      * scan segments bit mask and set corresponding bits in the segment encoding variable 's'
      */
@@ -1230,27 +1329,101 @@ SegEncoding_t s[8] = { {0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0} };
         sn++;
     }
     /*
-     * Set LCD registers with data from s and erase field simultaneously
+     * Set shadow with data from s and erase field simultaneously
      */
-#ifndef LCD_EMULATION
-    LCD_FREEZE;
-    for(comn=0;comn<8;comn++) {
-        comnrev=com_encoding[comn];
-        SEGDATALOW[comn]  = (SEGDATALOW[comn] &~tablcdclear[pos][comnrev].lo) | s[comn].lo;
-        SEGDATAHIGH[comn] = (SEGDATAHIGH[comn]&~tablcdclear[pos][comnrev].hi) | s[comn].hi;
-//        SEGDATALOW[comn]  = SEGDATALOW[comn] | s[comn].lo;
-//        SEGDATAHIGH[comn] = SEGDATAHIGH[comn]| s[comn].hi;
-     }
-    LCD_UNFREEZE;
-#else
     for(comn=0;comn<8;comn++) {
         comnrev=com_encoding[comn];
-        lcd[comn].lo = (lcd[comn].lo&~tablcdclear[pos][comnrev].lo)|s[comn].lo;
-        lcd[comn].hi = (lcd[comn].hi&~tablcdclear[pos][comnrev].hi)|s[comn].hi;
+        UpdateShadow(comn,tablcdclear[pos][comnrev],s[comn]);
+    }
+}
+
+/**
+ *  @brief  Write an ASCII character at the specified position into the shadow
+ *
+ *  @note   Does not commit
+ */
+static void WriteChar(uint8_t c, uint8_t pos) {
+uint32_t segments;
+#ifdef LCD_USE_MASK_TABLE
+uint8_t comn;
+uint8_t dirty;
+const uint32_t *set,*clear;
+uint32_t lo,hi;
+uint32_t primask;
+#endif
+
+    if( pos < 1 || pos > 14 )
+        return;
+#ifdef LCD_USE_MASK_TABLE
+    /*
+     * Positions 1 to 11: masks already computed for each common line
+     */
+    if( pos <= 11 ) {
+        if( c < ' ' || c >= ' '+96 )
+            c = ' ';
+        set   = lcdcharmask[pos-1][c-' '];
+        clear = lcdclearmask[pos-1];
+        dirty = 0;
+        ENTER_ATOMIC(primask);
+        for(comn=0;comn<8;comn++) {
+            lo = (lcdshadow[comn].lo&~(clear[comn]&~0xFFUL))|(set[comn]&~0xFFUL);
+            hi = (lcdshadow[comn].hi&~(clear[comn]&0xFFUL))|(set[comn]&0xFFUL);
+            if( lo != lcdshadow[comn].lo || hi != lcdshadow[comn].hi ) {
+                lcdshadow[comn].lo = lo;
+                lcdshadow[comn].hi = hi;
+                dirty |= BIT(comn);
+            }
+        }
+        lcddirty |= dirty;
+        EXIT_ATOMIC(primask);
+        return;
     }
 #endif
+    /*
+     * looks for segments to be lit
+     * table contains only character with
+     */
+    if( pos >=1 && pos <= 7 )           segments = segments14forchar[c-' '];
+    else if( pos >= 8 && pos <= 11 )    segments = segments7forchar[c-' '];
+    else if( pos == 12 ) segments = GENBITMASK1(c-'0');
+    else if( pos == 13 ) segments = GENBITMASK1(c-'0');
+    else if( pos == 14 ) segments = GENBITMASK1(c-'0');
+    else segments = 0;
 
+    WriteSegments(segments,pos);
+}
 
+/**
+ *  @brief  Write an ASCII character at the specified position
+ *
+ *  @param  c:   character to be written
+ *  @param  pos: position where character is to be written
+ *
+ *  @note   When LCD_EMULATION is set, all writes happen to a 8 position array
+ *
+ */
+
+void LCD_WriteChar(uint8_t c, uint8_t pos) {
+
+    WriteChar(c,pos);
+    AutoCommit();
+}
+
+/**
+ * @brief  Turns on/off a special symbol in the shadow
+ */
+static void WriteSpecialSegment(uint8_t code, uint32_t v) {
+SegEncoding_t none = { 0,0 };
+uint16_t m;
+uint8_t comn;
+
+    m = tablcdspecial[code];
+    comn = com_encoding[GET_COMMON(m)]; // it is reversed on STK3700
+    if( v ) {
+        UpdateShadow(comn,none,seg_encoding[GET_SEG(m)]);
+    } else {
+        UpdateShadow(comn,seg_encoding[GET_SEG(m)],none);
+    }
 }
 
 /**
@@ -1266,12 +1439,12 @@ int pos;
 
     for(pos=1;pos<=7;pos++) {
         if( *s ) {
-            LCD_WriteChar(*s++,pos);
+            WriteChar(*s++,pos);
         } else {
-            LCD_WriteChar(' ',pos);
+            WriteChar(' ',pos);
         }
     }
-
+    AutoCommit();
 }
 
 /**
@@ -1287,12 +1460,12 @@ int pos;
 
     for(pos=8;pos<=11;pos++) {
         if( *s ) {
-            LCD_WriteChar(*s++,pos);
+            WriteChar(*s++,pos);
         } else {
-            LCD_WriteChar(' ',pos);
+            WriteChar(' ',pos);
         }
     }
-
+    AutoCommit();
 }
 
 /**
@@ -1309,12 +1482,123 @@ int pos;
 
     for(pos=1;pos<=11;pos++) {
         if( *s ) {
-            LCD_WriteChar(*s++,pos);
+            WriteChar(*s++,pos);
+        } else {
+            WriteChar(' ',pos);
+        }
+    }
+    AutoCommit();
+}
+
+/**
+ *  @brief  Number of digits in the alphanumeric field
+ */
+#define ALPHADIGITS     7
+
+/**
+ *  @brief  Write a number right aligned in the alphanumeric field
+ *
+ *  @param  v:      magnitude
+ *  @param  base:   10 or 16
+ *  @param  n:      minimal number of digits (leading zeros)
+ *  @param  neg:    turn on minus sign
+ *  @param  frac:   number of digits after the decimal point (0 or 2 to 6)
+ *
+ *  @note   Decimal point LCD_DPn is at the left of position n, so the point before
+ *          the last frac digits is LCD_DP(8-frac). There is none before position 7.
+ *  @note   If it does not fit, all positions show '-' and LCD_OVERFLOW_SYMBOL is lit.
+ *          The symbol is turned off by the next number that fits, only when it was lit
+ *          by an overflow, so it can still be used with LCD_WriteSpecial.
+ *  @note   Only the shadow is changed
+ */
+static void WriteNumber(uint32_t v, uint32_t base, int n, int neg, int frac) {
+static const char digits[] = "0123456789ABCDEF";
+static uint8_t overflow = 0;
+uint32_t limit;
+int pos,i;
+
+    limit = (base == 16) ? 0x10000000 : 10000000;
+
+    for(i=0;i<=6-2;i++) {
+        WriteSpecialSegment(LCD_DP2+i,0);
+    }
+    if( v >= limit ) {
+        WriteSpecialSegment(LCD_MINUS,0);
+        for(pos=1;pos<=ALPHADIGITS;pos++) {
+            WriteChar('-',pos);
+        }
+        WriteSpecialSegment(LCD_OVERFLOW_SYMBOL,1);
+        overflow = 1;
+        return;
+    }
+    if( overflow ) {
+        WriteSpecialSegment(LCD_OVERFLOW_SYMBOL,0);
+        overflow = 0;
+    }
+
+    for(pos=ALPHADIGITS;pos>=1;pos--) {
+        if( v != 0 || n > 0 ) {
+            WriteChar(digits[v%base],pos);
+            v /= base;
         } else {
-            LCD_WriteChar(' ',pos);
+            WriteChar(' ',pos);
         }
+        n--;
+    }
+    WriteSpecialSegment(LCD_MINUS,neg);
+    if( frac >= 2 && frac <= 6 ) {
+        WriteSpecialSegment(LCD_DP2+6-frac,1);
     }
+}
+
+/**
+ *  @brief  Write a signed fixed point number into positions 1 to 7
+ *
+ *  @param  value:       number multiplied by 10^frac_digits
+ *  @param  frac_digits: digits after the decimal point (0 to 6)
+ *
+ *  @note   E.g. LCD_WriteFixed(-1234,2) shows -12.34
+ *  @note   Sign is shown by LCD_MINUS and the decimal point by LCD_DP2 to LCD_DP6
+ *  @note   There is no decimal point before position 7, so 1 digit after the point
+ *          is shown as 2 digits (12.3 is shown as 12.30)
+ *  @note   Values with more than 7 digits are shown as "-------" with LCD_OVERFLOW_SYMBOL
+ */
+void LCD_WriteFixed(int32_t value, uint8_t frac_digits) {
+uint32_t v;
+int neg;
+
+    neg = value < 0;
+    v = neg ? -(uint32_t) value : (uint32_t) value;
 
+    if( frac_digits > 6 ) {
+        v = ~0U;
+    } else if( frac_digits == 1 ) {
+        v = (v < 10000000) ? v*10 : ~0U;
+        frac_digits = 2;
+    }
+    WriteNumber(v,10,frac_digits?frac_digits+1:1,neg&&(v!=0),frac_digits);
+    AutoCommit();
+}
+
+/**
+ *  @brief  Write a signed integer into positions 1 to 7
+ *
+ *  @note   Range is -9999999 to 9999999. Sign is shown by LCD_MINUS
+ */
+void LCD_WriteInt(int32_t value) {
+
+    LCD_WriteFixed(value,0);
+}
+
+/**
+ *  @brief  Write an unsigned integer in hexadecimal into positions 1 to 7
+ *
+ *  @note   Values above 0xFFFFFFF (7 digits) are shown as "-------" with LCD_OVERFLOW_SYMBOL
+ */
+void LCD_WriteHex(uint32_t value) {
+
+    WriteNumber(value,16,1,0,0);
+    AutoCommit();
 }
 
 /**
@@ -1322,18 +1606,9 @@ int pos;
  *
  */
 void LCD_ClearAll(void) {
-int comn;
-    LCD_FREEZE;
-    for(comn=0;comn<8;comn++) {
-#ifdef LCD_EMULATION
-        lcd[comn].hi = 0;
-        lcd[comn].lo = 0;
-#else
-        SEGDATALOW[comn]  = 0;
-        SEGDATAHIGH[comn] = 0;
-#endif
-    LCD_UNFREEZE;
-    }
+
+    FillShadow(0,0);
+    AutoCommit();
 }
 
 /**
@@ -1341,20 +1616,63 @@ int comn;
  *
  */
 void LCD_SetAll(void) {
-int comn;
-    LCD_FREEZE;
-    for(comn=0;comn<8;comn++) {
+
+    FillShadow(0xFFFFFFFF,0xFF);
+    AutoCommit();
+}
+
+/**
+ *  @brief  Write all changed common lines to the LCD controller
+ *
+ *  @note   Only the registers of the common lines marked as dirty are written
+ *  @note   Registers are frozen during the update, so all changes appear in the same frame
+ */
+void LCD_Commit(void) {
+uint8_t comn;
+uint8_t dirty;
+uint32_t primask;
+
+    ENTER_ATOMIC(primask);
+    dirty = lcddirty;
+    if( dirty == 0 ) {
+        EXIT_ATOMIC(primask);
+        return;
+    }
+    lcddirty = 0;
+
 #ifdef LCD_EMULATION
-        lcd[comn].hi = 0xFF;
-        lcd[comn].lo = 0xFFFFFFFF;
+    for(comn=0;comn<8;comn++) {
+        if( dirty&BIT(comn) ) {
+            lcd[comn].lo = lcdshadow[comn].lo;
+            lcd[comn].hi = lcdshadow[comn].hi;
+        }
+    }
 #else
-        SEGDATALOW[comn]  = 0xFFFFFFFF;
-        SEGDATAHIGH[comn] = 0xFF;
-#endif
-    LCD_UNFREEZE;
+    LCD_FREEZE;
+    for(comn=0;comn<8;comn++) {
+        if( dirty&BIT(comn) ) {
+            SEGDATALOW[comn]  = lcdshadow[comn].lo;
+            SEGDATAHIGH[comn] = lcdshadow[comn].hi;
+        }
     }
+    LCD_UNFREEZE;
+#endif
+    EXIT_ATOMIC(primask);
 }
 
+/**
+ *  @brief  Enable or disable the commit at the end of each write function
+ *
+ *  @note   When disabled, LCD_Commit must be called to update the display
+ *  @note   Enabling it commits pending changes
+ */
+void LCD_SetAutoCommit(uint32_t on) {
+
+    lcdautocommit = (on != 0);
+    AutoCommit();
+}
+
+#ifndef LCD_EMULATION
 /**
  *  @brief find the log2 of an integer
  *  @note  y = ln2(x)  <=>  2^x = y
@@ -1373,6 +1691,7 @@ uint32_t v;
 
     return n;
 }
+#endif
 
 /**
  *  @brief Set LCD Voltage
@@ -1394,6 +1713,7 @@ uint32_t v;
  *  @endverbatim
  */
 void LCD_SetVoltage(uint32_t source, uint32_t div, uint32_t level ) {
+#ifndef LCD_EMULATION
 uint32_t d;
 uint32_t lcdctrl, dispctrl;
 
@@ -1431,6 +1751,7 @@ uint32_t lcdctrl, dispctrl;
 
     // Set LCD to use Boost
     LCD->DISPCTRL = (LCD->DISPCTRL&~_LCD_DISPCTRL_VLCDSEL_MASK)|_LCD_DISPCTRL_VLCDSEL_VEXTBOOST;
+#endif
 }
 
 
@@ -1445,6 +1766,7 @@ uint32_t lcdctrl, dispctrl;
  *
  */
 void LCD_SetContrast(uint32_t level, uint32_t ref) {
+#ifndef LCD_EMULATION
 uint32_t dispctrl;
 
     // Read register
@@ -1457,22 +1779,22 @@ uint32_t dispctrl;
     dispctrl |= (ref<<_LCD_DISPCTRL_CONCONF_SHIFT)&_LCD_DISPCTRL_CONCONF_MASK;
     // Write register
     LCD->DISPCTRL = dispctrl;
-
+#endif
 }
 
 /**
  * @brief Write a segment using segment mask
  */
 void LCD_WriteSegmentMask(uint32_t com, SegEncoding_t s, uint32_t v) {
+SegEncoding_t none = { 0,0 };
 
     com = com_encoding[com]; // it is reversed on STK3700
     if( v ) { /* Set */
-        SEGDATALOW[com]  |= s.lo;
-        SEGDATAHIGH[com] |= s.hi;
+        UpdateShadow(com,none,s);
     } else { /* Clear */
-        SEGDATALOW[com]  &= ~s.lo;
-        SEGDATAHIGH[com] &= ~s.hi;
+        UpdateShadow(com,s,none);
     }
+    AutoCommit();
 }
 
 /**
@@ -1509,11 +1831,8 @@ SegEncoding_t s;
  */
 void LCD_WriteSpecial(LCD_Code_t code, uint8_t v) {
 uint16_t m;
-uint8_t segn,comn,sn;
+uint8_t segn,comn;
 SegEncoding_t seg;
-SegEncoding_t s[8] = { 0 };
-uint8_t pos=0;
-uint32_t segments;
 
     if( code < LCD_GROUP ) {
         m = tablcdspecial[code];
@@ -1524,52 +1843,18 @@ uint32_t segments;
     } else {
         switch(code) {
         case LCD_ARC:
-            pos = 12;
-            segments = GENBITMASK1(v);
+            WriteSegments(GENBITMASK1(v),12);
             break;
         case LCD_BAT:
-            pos = 13;
-            segments = GENBITMASK1(v);
+            WriteSegments(GENBITMASK1(v),13);
             break;
         case LCD_TARGET:
-            pos = 14;
-            segments = GENBITMASK1(v);
+            WriteSegments(GENBITMASK1(v),14);
             break;
         default:
-            segments = 0;
-        }
-        /*
-         * scan segments bit mask and set corresponding bits in the segment encoding variable 's'
-         */
-        sn = 0;
-        while( segments ) {
-            if( segments&1 ) {
-                m = tablcd[sn][pos];
-                comn = GET_COMMON(m);
-                segn = GET_SEG(m);
-                comn = com_encoding[comn]; // it is reversed on STK3700
-                s[comn].hi |= seg_encoding[segn].hi;
-                s[comn].lo |= seg_encoding[segn].lo;
-            }
-            segments>>=1;
-            sn++;
-        }
-        /*
-         * Set LCD registers with data from s and erase field simultaneously
-         */
-#ifndef LCD_EMULATION
-        LCD_FREEZE;
-        for(comn=0;comn<8;comn++) {
-            SEGDATALOW[comn]  = (SEGDATALOW[comn] &~tablcdclear[comn][pos].lo) | s[comn].lo;
-            SEGDATAHIGH[comn] = (SEGDATAHIGH[comn]&~tablcdclear[comn][pos].hi) | s[comn].hi;
-        }
-        LCD_UNFREEZE;
-#else
-        for(comn=0;comn<8;comn++) {
-            lcd[comn].lo = (lcd[comn].lo&~tablcdclear[comn][pos].lo)|s[comn].lo;
-            lcd[comn].hi = (lcd[comn].hi&~tablcdclear[comn][pos].hi)|s[comn].hi;
+            break;
         }
-#endif
+        AutoCommit();
     }
 }
 
@@ -1587,3 +1872,353 @@ void LCD_Freeze(void) {
 void LCD_Unfreeze(void) {
     LCD_UNFREEZE;
 }
+
+
+#ifndef LCD_EMULATION
+/**
+ * @brief  Animation
+ *
+ * @note   The ring (position 12) is animated by the controller. AREGA and AREGB are rotated
+ *         at each frame counter event and combined (AND or OR) to drive the 8 arc segments
+ *         (controller segments 12 to 19 of COM0). No CPU is used, also in EM2.
+ * @note   The marquee and the blinking symbols use the frame counter interrupt. It happens
+ *         once per animation step, not once per frame, and it is enabled only while the
+ *         queue is not empty or a symbol is blinking.
+ * @note   Texts in the queue are not copied. They must be valid until shown.
+ */
+///@{
+#define LCD_QUEUE_SIZE      8
+#define ALPHAPOSITIONS      7
+
+#define FRAME_TEXT          0
+#define FRAME_MARQUEE       1
+
+typedef struct {
+    const char  *text;                              /**< text to be shown    */
+    uint16_t    len;                                /**< text length         */
+    uint16_t    steps;                              /**< steps of the frame  */
+    uint8_t     mode;                               /**< TEXT or MARQUEE     */
+} FrameInfo;
+
+static FrameInfo    lcdqueue[LCD_QUEUE_SIZE];
+static uint8_t      qhead      = 0;                 /**< first frame         */
+static uint8_t      qcount     = 0;                 /**< frames in queue     */
+static uint16_t     qstep      = 0;                 /**< step in first frame */
+static uint8_t      qloop      = 0;                 /**< requeue shown frames*/
+static uint64_t     blinkmask  = 0;                 /**< blinking symbols    */
+static uint8_t      blinkphase = 0;
+static uint8_t      ringon     = 0;                 /**< ring animation on   */
+///@}
+
+/**
+ * @brief  Wait until writes to the LCD registers in the low frequency domain are done
+ */
+static inline void WaitSync(uint32_t mask) {
+
+    while( LCD->SYNCBUSY&mask ) {}
+}
+
+/**
+ * @brief  Enable frame counter and its interrupt only when needed
+ */
+static void UpdateFrameCounter(void) {
+uint32_t needint;
+
+    needint = (qcount != 0) || (blinkmask != 0);
+
+    if( needint || ringon ) {
+        WaitSync(LCD_SYNCBUSY_BACTRL);
+        LCD->BACTRL |= LCD_BACTRL_FCEN;
+    } else {
+        WaitSync(LCD_SYNCBUSY_BACTRL);
+        LCD->BACTRL &= ~LCD_BACTRL_FCEN;
+    }
+    if( needint ) {
+        LCD->IEN |= LCD_IEN_FC;
+    } else {
+        LCD->IEN &= ~LCD_IEN_FC;
+    }
+}
+
+/**
+ * @brief  Show first frame of the queue and advance
+ *
+ * @note   Marquee: text enters from the right and leaves at the left, one character per step.
+ *         At step k, position p shows character k+p-7.
+ */
+static void QueueStep(void) {
+FrameInfo *f;
+int p,j;
+
+    if( qcount == 0 )
+        return;
+
+    f = &lcdqueue[qhead];
+    if( f->mode == FRAME_MARQUEE ) {
+        for(p=1;p<=ALPHAPOSITIONS;p++) {
+            j = qstep+p-ALPHAPOSITIONS;
+            WriteChar( (j >= 0 && j < f->len) ? f->text[j] : ' ', p);
+        }
+    } else if( qstep == 0 ) {
+        for(p=1;p<=ALPHAPOSITIONS;p++) {
+            WriteChar( (p <= f->len) ? f->text[p-1] : ' ', p);
+        }
+    }
+
+    qstep++;
+    if( qstep >= f->steps ) {
+        qstep = 0;
+        qhead = (qhead+1)%LCD_QUEUE_SIZE;
+        if( qloop ) {
+            lcdqueue[(qhead+qcount-1)%LCD_QUEUE_SIZE] = *f;
+        } else {
+            qcount--;
+        }
+    }
+}
+
+/**
+ * @brief  Animation step, called at each frame counter event
+ *
+ * @note   Only the segments changed by the step are written to the controller. Pending
+ *         writes of the application (auto commit off) stay in the shadow until its
+ *         LCD_Commit, and the lines it marked as dirty are kept.
+ * @note   The registers are frozen only when the application has not frozen them, so
+ *         an interrupt between LCD_Freeze and LCD_Unfreeze does not unfreeze them.
+ */
+static void AnimationStep(void) {
+SegEncoding_t before[8];
+uint32_t chlo,chhi;
+uint32_t frozen;
+uint8_t dirty;
+uint8_t code;
+uint8_t comn;
+
+    dirty = lcddirty;
+    for(comn=0;comn<8;comn++)
+        before[comn] = lcdshadow[comn];
+
+    if( blinkmask ) {
+        blinkphase ^= 1;
+        for(code=0;code<LCD_GROUP && (blinkmask>>code)!=0;code++) {
+            if( (blinkmask>>code)&1 )
+                WriteSpecialSegment(code,blinkphase);
+        }
+    }
+
+    QueueStep();
+
+    frozen = LCD->FREEZE&LCD_FREEZE_REGFREEZE;
+    if( !frozen )
+        LCD_FREEZE;
+    for(comn=0;comn<8;comn++) {
+        chlo = before[comn].lo^lcdshadow[comn].lo;
+        chhi = before[comn].hi^lcdshadow[comn].hi;
+        if( chlo )
+            SEGDATALOW[comn]  = (SEGDATALOW[comn]&~chlo)|(lcdshadow[comn].lo&chlo);
+        if( chhi )
+            SEGDATAHIGH[comn] = (SEGDATAHIGH[comn]&~chhi)|(lcdshadow[comn].hi&chhi);
+    }
+    if( !frozen )
+        LCD_UNFREEZE;
+    lcddirty = dirty;
+
+    if( qcount == 0 && blinkmask == 0 )
+        UpdateFrameCounter();
+}
+
+/**
+ * @brief  LCD interrupt handler
+ *
+ * @note   Only the frame counter interrupt is used
+ */
+void
+LCD_IRQHandler(void) {
+
+    LCD->IFC = LCD_IFC_FC;
+
+    AnimationStep();
+}
+
+/**
+ * @brief  Set the animation rate
+ *
+ * @param  frames: number of frames per animation step (1 to 512)
+ *
+ * @note   A step happens every (FCTOP+1)*2^FCPRESC frames. With the default 128 Hz frame
+ *         rate, 32 frames gives 4 steps per second.
+ */
+void LCD_SetAnimationRate(uint32_t frames) {
+uint32_t presc;
+
+    if( frames < 1 )    frames = 1;
+    if( frames > 512 )  frames = 512;
+
+    presc = 0;
+    while( frames > (64U<<presc) )
+        presc++;
+
+    WaitSync(LCD_SYNCBUSY_BACTRL);
+    LCD->BACTRL = (LCD->BACTRL&~(_LCD_BACTRL_FCPRESC_MASK|_LCD_BACTRL_FCTOP_MASK))
+                 |(presc<<_LCD_BACTRL_FCPRESC_SHIFT)
+                 |((((frames>>presc)-1)<<_LCD_BACTRL_FCTOP_SHIFT)&_LCD_BACTRL_FCTOP_MASK);
+}
+
+/**
+ * @brief  Start the animation of the ring
+ *
+ * @param  a,b:    initial values of the AREGA and AREGB registers (one bit per arc segment)
+ * @param  config: OR of LCD_ANIM_x flags: shift direction of each register and logical function
+ *
+ * @note   E.g. a single segment turning: LCD_StartRingAnimation(0x01,0x00,LCD_ANIM_LEFT_A)
+ * @note   Ring segments are cleared in the data registers, so only the animation is shown.
+ *         Do not write to position 12 (LCD_ARC) while the animation is running.
+ */
+void LCD_StartRingAnimation(uint8_t a, uint8_t b, uint32_t config) {
+uint32_t bactrl;
+uint32_t primask;
+
+    WriteSegments(0,12);
+    AutoCommit();
+
+    WaitSync(LCD_SYNCBUSY_AREGA|LCD_SYNCBUSY_AREGB|LCD_SYNCBUSY_BACTRL);
+    LCD->AREGA = a;
+    LCD->AREGB = b;
+
+    bactrl = LCD->BACTRL&~(_LCD_BACTRL_AREGASC_MASK|_LCD_BACTRL_AREGBSC_MASK
+                          |_LCD_BACTRL_ALOGSEL_MASK);
+    if( config&LCD_ANIM_LEFT_A )        bactrl |= LCD_BACTRL_AREGASC_SHIFTLEFT;
+    else if( config&LCD_ANIM_RIGHT_A )  bactrl |= LCD_BACTRL_AREGASC_SHIFTRIGHT;
+    if( config&LCD_ANIM_LEFT_B )        bactrl |= LCD_BACTRL_AREGBSC_SHIFTLEFT;
+    else if( config&LCD_ANIM_RIGHT_B )  bactrl |= LCD_BACTRL_AREGBSC_SHIFTRIGHT;
+    if( config&LCD_ANIM_AND )           bactrl |= LCD_BACTRL_ALOGSEL_AND;
+    else                                bactrl |= LCD_BACTRL_ALOGSEL_OR;
+    LCD->BACTRL = bactrl|LCD_BACTRL_AEN;
+
+    ENTER_ATOMIC(primask);
+    ringon = 1;
+    UpdateFrameCounter();
+    EXIT_ATOMIC(primask);
+}
+
+/**
+ * @brief  Stop the animation of the ring
+ */
+void LCD_StopRingAnimation(void) {
+uint32_t primask;
+
+    WaitSync(LCD_SYNCBUSY_BACTRL);
+    LCD->BACTRL &= ~LCD_BACTRL_AEN;
+
+    ENTER_ATOMIC(primask);
+    ringon = 0;
+    UpdateFrameCounter();
+    EXIT_ATOMIC(primask);
+}
+
+/**
+ * @brief  Add a frame to the queue
+ *
+ * @return 0 if OK, 1 if queue is full
+ */
+static uint32_t QueueFrame(const char *s, uint16_t steps, uint8_t mode) {
+FrameInfo *f;
+uint16_t len;
+uint32_t primask;
+
+    len = 0;
+    while( s[len] ) len++;
+
+    ENTER_ATOMIC(primask);
+    if( qcount >= LCD_QUEUE_SIZE ) {
+        EXIT_ATOMIC(primask);
+        return 1;
+    }
+    f = &lcdqueue[(qhead+qcount)%LCD_QUEUE_SIZE];
+    f->text  = s;
+    f->len   = len;
+    f->mode  = mode;
+    f->steps = (mode == FRAME_MARQUEE) ? len+ALPHAPOSITIONS : steps;
+    if( f->steps == 0 )
+        f->steps = 1;
+    qcount++;
+    UpdateFrameCounter();
+    EXIT_ATOMIC(primask);
+
+    return 0;
+}
+
+/**
+ * @brief  Queue a text to be shown in the alphanumeric field (positions 1 to 7)
+ *
+ * @param  s:     text (only the first 7 characters are shown)
+ * @param  steps: number of animation steps it is shown
+ *
+ * @return 0 if OK, 1 if queue is full
+ */
+uint32_t LCD_QueueText(const char *s, uint16_t steps) {
+
+    return QueueFrame(s,steps,FRAME_TEXT);
+}
+
+/**
+ * @brief  Queue a text to scroll through the alphanumeric field
+ *
+ * @note   It moves one character per animation step
+ *
+ * @return 0 if OK, 1 if queue is full
+ */
+uint32_t LCD_QueueMarquee(const char *s) {
+
+    return QueueFrame(s,0,FRAME_MARQUEE);
+}
+
+/**
+ * @brief  Remove all frames from the queue
+ *
+ * @note   The alphanumeric field keeps the last content shown
+ */
+void LCD_ClearQueue(void) {
+uint32_t primask;
+
+    ENTER_ATOMIC(primask);
+    qcount = 0;
+    qstep  = 0;
+    UpdateFrameCounter();
+    EXIT_ATOMIC(primask);
+}
+
+/**
+ * @brief  When on, frames are added to the end of the queue after being shown
+ */
+void LCD_SetQueueLoop(uint32_t on) {
+
+    qloop = (on != 0);
+}
+
+/**
+ * @brief  Blink a special symbol (LCD_GECKO to LCD_DP10)
+ *
+ * @note   It toggles at each animation step. When blinking stops, the symbol is left on.
+ */
+void LCD_SetBlink(LCD_Code_t code, uint32_t on) {
+uint32_t primask;
+
+    if( code >= LCD_GROUP )
+        return;
+
+    ENTER_ATOMIC(primask);
+    if( on ) {
+        blinkmask |= (1ULL<<code);
+    } else {
+        blinkmask &= ~(1ULL<<code);
+    }
+    UpdateFrameCounter();
+    EXIT_ATOMIC(primask);
+
+    if( !on )
+        WriteSpecialSegment(code,1);
+
+    AutoCommit();
+}
+#endif
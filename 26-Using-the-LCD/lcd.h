@@ -90,6 +90,17 @@ void LCD_WriteString(char *s);
 void LCD_WriteAlphanumericDisplay(char *s);
 void LCD_WriteNumericDisplay(char *s);
 void LCD_WriteSpecial(LCD_Code_t code, uint8_t v);
+/**
+ * Symbol lit by LCD_WriteInt, LCD_WriteFixed and LCD_WriteHex when the value does not
+ * fit in 7 digits. The STK3700 display has no error symbol, so the antenna is used.
+ */
+#ifndef LCD_OVERFLOW_SYMBOL
+#define LCD_OVERFLOW_SYMBOL         LCD_ANTENNA
+#endif
+
+void LCD_WriteInt(int32_t value);
+void LCD_WriteFixed(int32_t value, uint8_t frac_digits);
+void LCD_WriteHex(uint32_t value);
 
 uint32_t SetLFAClock(uint32_t clock);
 uint32_t SetLCDClock(uint32_t presc, uint32_t div);
@@ -100,6 +111,28 @@ void LCD_SetContrast(uint32_t level, uint32_t ref);
 void LCD_Freeze(void);
 void LCD_Unfreeze(void);
 
+void LCD_Commit(void);
+void LCD_SetAutoCommit(uint32_t on);
+
+/**
+ * Configuration of the ring animation (LCD_StartRingAnimation)
+ */
+#define LCD_ANIM_LEFT_A             0x01
+#define LCD_ANIM_RIGHT_A            0x02
+#define LCD_ANIM_LEFT_B             0x04
+#define LCD_ANIM_RIGHT_B            0x08
+#define LCD_ANIM_OR                 0x00
+#define LCD_ANIM_AND                0x10
+
+void LCD_SetAnimationRate(uint32_t frames);
+void LCD_StartRingAnimation(uint8_t a, uint8_t b, uint32_t config);
+void LCD_StopRingAnimation(void);
+uint32_t LCD_QueueText(const char *s, uint16_t steps);
+uint32_t LCD_QueueMarquee(const char *s);
+void LCD_ClearQueue(void);
+void LCD_SetQueueLoop(uint32_t on);
+void LCD_SetBlink(LCD_Code_t code, uint32_t on);
+
 
 
 #endif // LCD_H
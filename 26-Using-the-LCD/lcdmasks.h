@@ -0,0 +1,1119 @@
+/**
+ * @file    lcdmasks.h
+ * @brief   Segment masks for positions 1 to 11
+ *
+ * @note    Generated by tools/lcdgen.c. Do not edit
+ * @note    Indexed by position-1, character-' ' and controller common number
+ * @note    Low register mask is mask&~0xFF, high register mask is mask&0xFF
+ */
+#ifndef LCDMASKS_H
+#define LCDMASKS_H
+
+/**
+ * @brief   Bits to be cleared before writing a character at a position
+ */
+static const uint32_t lcdclearmask[11][8] = {
+    { 0x00000000, 0x00006000, 0x00006000, 0x00006000, 0x00006000, 0x00006000, 0x00006000, 0x00006000 },  // P01
+    { 0x00000000, 0x00018000, 0x00018000, 0x00018000, 0x00018000, 0x00018000, 0x00018000, 0x00018000 },  // P02
+    { 0x00000000, 0x00060000, 0x00060000, 0x00060000, 0x00060000, 0x00060000, 0x00060000, 0x00060000 },  // P03
+    { 0x00000000, 0x10080000, 0x10080000, 0x10080000, 0x10080000, 0x10080000, 0x10080000, 0x10080000 },  // P04
+    { 0x20000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x40000000 },  // P05
+    { 0x80000000, 0x80000001, 0x80000001, 0x80000001, 0x80000001, 0x80000001, 0x80000001, 0x00000001 },  // P06
+    { 0x00000000, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006 },  // P07
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040 },  // P08
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020 },  // P09
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010 },  // P10
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008 }   // P11
+};
+
+/**
+ * @brief   Bits to be set to show a character at a position
+ */
+static const uint32_t lcdcharmask[11][96][8] = {
+  { // P01
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x20
+    { 0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00001000 },  // 0x21 '!'
+    { 0x00000000, 0x00004000, 0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x22 '"'
+    { 0x00000000, 0x00004000, 0x00000000, 0x00004000, 0x00006000, 0x00006000, 0x00000000, 0x00004000 },  // 0x23 '#'
+    { 0x00000000, 0x00002000, 0x00000000, 0x00006000, 0x00006000, 0x00006000, 0x00000000, 0x00004000 },  // 0x24 '$'
+    { 0x00000000, 0x00000000, 0x00006000, 0x00006000, 0x00006000, 0x00006000, 0x00006000, 0x00000000 },  // 0x25 '%'
+    { 0x00000000, 0x00002000, 0x00002000, 0x00004000, 0x00002000, 0x00000000, 0x00004000, 0x00006000 },  // 0x26 '&'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x27 '''
+    { 0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00000000, 0x00004000, 0x00000000 },  // 0x28 '('
+    { 0x00000000, 0x00000000, 0x00002000, 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00000000 },  // 0x29 ')'
+    { 0x00000000, 0x00000000, 0x00006000, 0x00004000, 0x00006000, 0x00002000, 0x00006000, 0x00000000 },  // 0x2A '*'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00004000, 0x00006000, 0x00002000, 0x00000000, 0x00000000 },  // 0x2B '+'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00000000 },  // 0x2C ','
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00006000, 0x00000000, 0x00000000, 0x00000000 },  // 0x2D '-'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001000 },  // 0x2E '.'
+    { 0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00000000 },  // 0x2F '/'
+    { 0x00000000, 0x00006000, 0x00004000, 0x00002000, 0x00000000, 0x00004000, 0x00002000, 0x00006000 },  // 0x30 '0'
+    { 0x00000000, 0x00004000, 0x00004000, 0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00000000 },  // 0x31 '1'
+    { 0x00000000, 0x00006000, 0x00000000, 0x00000000, 0x00006000, 0x00000000, 0x00000000, 0x00006000 },  // 0x32 '2'
+    { 0x00000000, 0x00006000, 0x00000000, 0x00000000, 0x00004000, 0x00004000, 0x00000000, 0x00004000 },  // 0x33 '3'
+    { 0x00000000, 0x00004000, 0x00000000, 0x00002000, 0x00006000, 0x00004000, 0x00000000, 0x00000000 },  // 0x34 '4'
+    { 0x00000000, 0x00002000, 0x00000000, 0x00002000, 0x00002000, 0x00000000, 0x00004000, 0x00004000 },  // 0x35 '5'
+    { 0x00000000, 0x00002000, 0x00000000, 0x00002000, 0x00006000, 0x00004000, 0x00000000, 0x00006000 },  // 0x36 '6'
+    { 0x00000000, 0x00006000, 0x00000000, 0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00000000 },  // 0x37 '7'
+    { 0x00000000, 0x00006000, 0x00000000, 0x00002000, 0x00006000, 0x00004000, 0x00000000, 0x00006000 },  // 0x38 '8'
+    { 0x00000000, 0x00006000, 0x00000000, 0x00002000, 0x00006000, 0x00004000, 0x00000000, 0x00004000 },  // 0x39 '9'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00002000, 0x00000000, 0x00000000 },  // 0x3A ':'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00002000, 0x00000000 },  // 0x3B ';'
+    { 0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00002000, 0x00000000, 0x00004000, 0x00000000 },  // 0x3C '<'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00006000, 0x00000000, 0x00000000, 0x00004000 },  // 0x3D '='
+    { 0x00000000, 0x00000000, 0x00002000, 0x00000000, 0x00004000, 0x00000000, 0x00002000, 0x00000000 },  // 0x3E '>'
+    { 0x00000000, 0x00006000, 0x00000000, 0x00000000, 0x00004000, 0x00002000, 0x00000000, 0x00001000 },  // 0x3F '?'
+    { 0x00000000, 0x00006000, 0x00000000, 0x00006000, 0x00004000, 0x00000000, 0x00000000, 0x00006000 },  // 0x40 '@'
+    { 0x00000000, 0x00006000, 0x00000000, 0x00002000, 0x00006000, 0x00004000, 0x00000000, 0x00002000 },  // 0x41 'A'
+    { 0x00000000, 0x00006000, 0x00000000, 0x00004000, 0x00004000, 0x00006000, 0x00000000, 0x00004000 },  // 0x42 'B'
+    { 0x00000000, 0x00002000, 0x00000000, 0x00002000, 0x00000000, 0x00000000, 0x00000000, 0x00006000 },  // 0x43 'C'
+    { 0x00000000, 0x00006000, 0x00000000, 0x00004000, 0x00000000, 0x00006000, 0x00000000, 0x00004000 },  // 0x44 'D'
+    { 0x00000000, 0x00002000, 0x00000000, 0x00002000, 0x00002000, 0x00000000, 0x00000000, 0x00006000 },  // 0x45 'E'
+    { 0x00000000, 0x00002000, 0x00000000, 0x00002000, 0x00002000, 0x00000000, 0x00000000, 0x00002000 },  // 0x46 'F'
+    { 0x00000000, 0x00002000, 0x00000000, 0x00002000, 0x00004000, 0x00004000, 0x00000000, 0x00006000 },  // 0x47 'G'
+    { 0x00000000, 0x00004000, 0x00000000, 0x00002000, 0x00006000, 0x00004000, 0x00000000, 0x00002000 },  // 0x48 'H'
+    { 0x00000000, 0x00002000, 0x00000000, 0x00004000, 0x00000000, 0x00002000, 0x00000000, 0x00004000 },  // 0x49 'I'
+    { 0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00006000 },  // 0x4A 'J'
+    { 0x00000000, 0x00000000, 0x00004000, 0x00002000, 0x00002000, 0x00000000, 0x00004000, 0x00002000 },  // 0x4B 'K'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00000000, 0x00000000, 0x00000000, 0x00006000 },  // 0x4C 'L'
+    { 0x00000000, 0x00004000, 0x00006000, 0x00002000, 0x00000000, 0x00004000, 0x00000000, 0x00002000 },  // 0x4D 'M'
+    { 0x00000000, 0x00004000, 0x00002000, 0x00002000, 0x00000000, 0x00004000, 0x00004000, 0x00002000 },  // 0x4E 'N'
+    { 0x00000000, 0x00006000, 0x00000000, 0x00002000, 0x00000000, 0x00004000, 0x00000000, 0x00006000 },  // 0x4F 'O'
+    { 0x00000000, 0x00006000, 0x00000000, 0x00002000, 0x00006000, 0x00000000, 0x00000000, 0x00002000 },  // 0x50 'P'
+    { 0x00000000, 0x00006000, 0x00000000, 0x00002000, 0x00000000, 0x00004000, 0x00004000, 0x00006000 },  // 0x51 'Q'
+    { 0x00000000, 0x00006000, 0x00000000, 0x00002000, 0x00006000, 0x00000000, 0x00004000, 0x00002000 },  // 0x52 'R'
+    { 0x00000000, 0x00002000, 0x00000000, 0x00002000, 0x00006000, 0x00004000, 0x00000000, 0x00004000 },  // 0x53 'S'
+    { 0x00000000, 0x00002000, 0x00000000, 0x00004000, 0x00000000, 0x00002000, 0x00000000, 0x00000000 },  // 0x54 'T'
+    { 0x00000000, 0x00004000, 0x00000000, 0x00002000, 0x00000000, 0x00004000, 0x00000000, 0x00006000 },  // 0x55 'U'
+    { 0x00000000, 0x00000000, 0x00004000, 0x00002000, 0x00000000, 0x00000000, 0x00002000, 0x00002000 },  // 0x56 'V'
+    { 0x00000000, 0x00004000, 0x00000000, 0x00002000, 0x00000000, 0x00004000, 0x00006000, 0x00002000 },  // 0x57 'W'
+    { 0x00000000, 0x00000000, 0x00006000, 0x00000000, 0x00000000, 0x00000000, 0x00006000, 0x00000000 },  // 0x58 'X'
+    { 0x00000000, 0x00004000, 0x00000000, 0x00002000, 0x00006000, 0x00004000, 0x00000000, 0x00004000 },  // 0x59 'Y'
+    { 0x00000000, 0x00002000, 0x00004000, 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00004000 },  // 0x5A 'Z'
+    { 0x00000000, 0x00002000, 0x00000000, 0x00002000, 0x00000000, 0x00000000, 0x00000000, 0x00006000 },  // 0x5B '['
+    { 0x00000000, 0x00000000, 0x00002000, 0x00000000, 0x00000000, 0x00000000, 0x00004000, 0x00000000 },  // 0x5C
+    { 0x00000000, 0x00006000, 0x00000000, 0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00004000 },  // 0x5D ']'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00006000, 0x00000000 },  // 0x5E '^'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00004000 },  // 0x5F '_'
+    { 0x00000000, 0x00000000, 0x00002000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x60 '`'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00002000, 0x00000000, 0x00006000 },  // 0x61 'a'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00002000, 0x00000000, 0x00004000, 0x00006000 },  // 0x62 'b'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00006000, 0x00000000, 0x00000000, 0x00006000 },  // 0x63 'c'
+    { 0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00004000, 0x00004000, 0x00002000, 0x00004000 },  // 0x64 'd'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00000000, 0x00002000, 0x00006000 },  // 0x65 'e'
+    { 0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00006000, 0x00002000, 0x00000000, 0x00000000 },  // 0x66 'f'
+    { 0x00000000, 0x00004000, 0x00004000, 0x00000000, 0x00004000, 0x00004000, 0x00000000, 0x00004000 },  // 0x67 'g'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00002000, 0x00002000, 0x00000000, 0x00002000 },  // 0x68 'h'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00000000, 0x00000000 },  // 0x69 'i'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00002000, 0x00002000 },  // 0x6A 'j'
+    { 0x00000000, 0x00000000, 0x00004000, 0x00004000, 0x00000000, 0x00002000, 0x00004000, 0x00000000 },  // 0x6B 'k'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00000000, 0x00000000, 0x00000000, 0x00002000 },  // 0x6C 'l'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00006000, 0x00006000, 0x00000000, 0x00002000 },  // 0x6D 'm'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00002000, 0x00000000, 0x00002000 },  // 0x6E 'n'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00006000, 0x00004000, 0x00000000, 0x00006000 },  // 0x6F 'o'
+    { 0x00000000, 0x00000000, 0x00002000, 0x00002000, 0x00002000, 0x00000000, 0x00000000, 0x00002000 },  // 0x70 'p'
+    { 0x00000000, 0x00004000, 0x00004000, 0x00000000, 0x00004000, 0x00004000, 0x00000000, 0x00000000 },  // 0x71 'q'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00000000, 0x00000000, 0x00002000 },  // 0x72 'r'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00004000, 0x00004000 },  // 0x73 's'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00002000, 0x00000000, 0x00000000, 0x00006000 },  // 0x74 't'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00006000 },  // 0x75 'u'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00002000 },  // 0x76 'v'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00004000, 0x00006000, 0x00002000 },  // 0x77 'w'
+    { 0x00000000, 0x00000000, 0x00006000, 0x00000000, 0x00000000, 0x00000000, 0x00006000, 0x00000000 },  // 0x78 'x'
+    { 0x00000000, 0x00004000, 0x00000000, 0x00004000, 0x00004000, 0x00004000, 0x00000000, 0x00004000 },  // 0x79 'y'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00000000, 0x00002000, 0x00004000 },  // 0x7A 'z'
+    { 0x00000000, 0x00002000, 0x00002000, 0x00000000, 0x00002000, 0x00000000, 0x00002000, 0x00004000 },  // 0x7B '{'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00002000, 0x00000000, 0x00000000 },  // 0x7C '|'
+    { 0x00000000, 0x00002000, 0x00004000, 0x00000000, 0x00004000, 0x00000000, 0x00004000, 0x00004000 },  // 0x7D '}'
+    { 0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00006000, 0x00000000, 0x00002000, 0x00000000 },  // 0x7E '~'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 }   // 0x7F
+  },
+  { // P02
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x20
+    { 0x00000000, 0x00010000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00001000 },  // 0x21 '!'
+    { 0x00000000, 0x00010000, 0x00000000, 0x00010000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x22 '"'
+    { 0x00000000, 0x00010000, 0x00000000, 0x00010000, 0x00018000, 0x00018000, 0x00000000, 0x00010000 },  // 0x23 '#'
+    { 0x00000000, 0x00008000, 0x00000000, 0x00018000, 0x00018000, 0x00018000, 0x00000000, 0x00010000 },  // 0x24 '$'
+    { 0x00000000, 0x00000000, 0x00018000, 0x00018000, 0x00018000, 0x00018000, 0x00018000, 0x00000000 },  // 0x25 '%'
+    { 0x00000000, 0x00008000, 0x00008000, 0x00010000, 0x00008000, 0x00000000, 0x00010000, 0x00018000 },  // 0x26 '&'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x27 '''
+    { 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000 },  // 0x28 '('
+    { 0x00000000, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00000000 },  // 0x29 ')'
+    { 0x00000000, 0x00000000, 0x00018000, 0x00010000, 0x00018000, 0x00008000, 0x00018000, 0x00000000 },  // 0x2A '*'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00018000, 0x00008000, 0x00000000, 0x00000000 },  // 0x2B '+'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00000000 },  // 0x2C ','
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00018000, 0x00000000, 0x00000000, 0x00000000 },  // 0x2D '-'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001000 },  // 0x2E '.'
+    { 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00000000 },  // 0x2F '/'
+    { 0x00000000, 0x00018000, 0x00010000, 0x00008000, 0x00000000, 0x00010000, 0x00008000, 0x00018000 },  // 0x30 '0'
+    { 0x00000000, 0x00010000, 0x00010000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00000000 },  // 0x31 '1'
+    { 0x00000000, 0x00018000, 0x00000000, 0x00000000, 0x00018000, 0x00000000, 0x00000000, 0x00018000 },  // 0x32 '2'
+    { 0x00000000, 0x00018000, 0x00000000, 0x00000000, 0x00010000, 0x00010000, 0x00000000, 0x00010000 },  // 0x33 '3'
+    { 0x00000000, 0x00010000, 0x00000000, 0x00008000, 0x00018000, 0x00010000, 0x00000000, 0x00000000 },  // 0x34 '4'
+    { 0x00000000, 0x00008000, 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00010000, 0x00010000 },  // 0x35 '5'
+    { 0x00000000, 0x00008000, 0x00000000, 0x00008000, 0x00018000, 0x00010000, 0x00000000, 0x00018000 },  // 0x36 '6'
+    { 0x00000000, 0x00018000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00000000 },  // 0x37 '7'
+    { 0x00000000, 0x00018000, 0x00000000, 0x00008000, 0x00018000, 0x00010000, 0x00000000, 0x00018000 },  // 0x38 '8'
+    { 0x00000000, 0x00018000, 0x00000000, 0x00008000, 0x00018000, 0x00010000, 0x00000000, 0x00010000 },  // 0x39 '9'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00008000, 0x00000000, 0x00000000 },  // 0x3A ':'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00000000, 0x00008000, 0x00000000 },  // 0x3B ';'
+    { 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00008000, 0x00000000, 0x00010000, 0x00000000 },  // 0x3C '<'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00018000, 0x00000000, 0x00000000, 0x00010000 },  // 0x3D '='
+    { 0x00000000, 0x00000000, 0x00008000, 0x00000000, 0x00010000, 0x00000000, 0x00008000, 0x00000000 },  // 0x3E '>'
+    { 0x00000000, 0x00018000, 0x00000000, 0x00000000, 0x00010000, 0x00008000, 0x00000000, 0x00001000 },  // 0x3F '?'
+    { 0x00000000, 0x00018000, 0x00000000, 0x00018000, 0x00010000, 0x00000000, 0x00000000, 0x00018000 },  // 0x40 '@'
+    { 0x00000000, 0x00018000, 0x00000000, 0x00008000, 0x00018000, 0x00010000, 0x00000000, 0x00008000 },  // 0x41 'A'
+    { 0x00000000, 0x00018000, 0x00000000, 0x00010000, 0x00010000, 0x00018000, 0x00000000, 0x00010000 },  // 0x42 'B'
+    { 0x00000000, 0x00008000, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00018000 },  // 0x43 'C'
+    { 0x00000000, 0x00018000, 0x00000000, 0x00010000, 0x00000000, 0x00018000, 0x00000000, 0x00010000 },  // 0x44 'D'
+    { 0x00000000, 0x00008000, 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00000000, 0x00018000 },  // 0x45 'E'
+    { 0x00000000, 0x00008000, 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00000000, 0x00008000 },  // 0x46 'F'
+    { 0x00000000, 0x00008000, 0x00000000, 0x00008000, 0x00010000, 0x00010000, 0x00000000, 0x00018000 },  // 0x47 'G'
+    { 0x00000000, 0x00010000, 0x00000000, 0x00008000, 0x00018000, 0x00010000, 0x00000000, 0x00008000 },  // 0x48 'H'
+    { 0x00000000, 0x00008000, 0x00000000, 0x00010000, 0x00000000, 0x00008000, 0x00000000, 0x00010000 },  // 0x49 'I'
+    { 0x00000000, 0x00010000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00018000 },  // 0x4A 'J'
+    { 0x00000000, 0x00000000, 0x00010000, 0x00008000, 0x00008000, 0x00000000, 0x00010000, 0x00008000 },  // 0x4B 'K'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00018000 },  // 0x4C 'L'
+    { 0x00000000, 0x00010000, 0x00018000, 0x00008000, 0x00000000, 0x00010000, 0x00000000, 0x00008000 },  // 0x4D 'M'
+    { 0x00000000, 0x00010000, 0x00008000, 0x00008000, 0x00000000, 0x00010000, 0x00010000, 0x00008000 },  // 0x4E 'N'
+    { 0x00000000, 0x00018000, 0x00000000, 0x00008000, 0x00000000, 0x00010000, 0x00000000, 0x00018000 },  // 0x4F 'O'
+    { 0x00000000, 0x00018000, 0x00000000, 0x00008000, 0x00018000, 0x00000000, 0x00000000, 0x00008000 },  // 0x50 'P'
+    { 0x00000000, 0x00018000, 0x00000000, 0x00008000, 0x00000000, 0x00010000, 0x00010000, 0x00018000 },  // 0x51 'Q'
+    { 0x00000000, 0x00018000, 0x00000000, 0x00008000, 0x00018000, 0x00000000, 0x00010000, 0x00008000 },  // 0x52 'R'
+    { 0x00000000, 0x00008000, 0x00000000, 0x00008000, 0x00018000, 0x00010000, 0x00000000, 0x00010000 },  // 0x53 'S'
+    { 0x00000000, 0x00008000, 0x00000000, 0x00010000, 0x00000000, 0x00008000, 0x00000000, 0x00000000 },  // 0x54 'T'
+    { 0x00000000, 0x00010000, 0x00000000, 0x00008000, 0x00000000, 0x00010000, 0x00000000, 0x00018000 },  // 0x55 'U'
+    { 0x00000000, 0x00000000, 0x00010000, 0x00008000, 0x00000000, 0x00000000, 0x00008000, 0x00008000 },  // 0x56 'V'
+    { 0x00000000, 0x00010000, 0x00000000, 0x00008000, 0x00000000, 0x00010000, 0x00018000, 0x00008000 },  // 0x57 'W'
+    { 0x00000000, 0x00000000, 0x00018000, 0x00000000, 0x00000000, 0x00000000, 0x00018000, 0x00000000 },  // 0x58 'X'
+    { 0x00000000, 0x00010000, 0x00000000, 0x00008000, 0x00018000, 0x00010000, 0x00000000, 0x00010000 },  // 0x59 'Y'
+    { 0x00000000, 0x00008000, 0x00010000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00010000 },  // 0x5A 'Z'
+    { 0x00000000, 0x00008000, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00018000 },  // 0x5B '['
+    { 0x00000000, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000 },  // 0x5C
+    { 0x00000000, 0x00018000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00010000 },  // 0x5D ']'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00018000, 0x00000000 },  // 0x5E '^'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010000 },  // 0x5F '_'
+    { 0x00000000, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x60 '`'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00018000 },  // 0x61 'a'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00010000, 0x00018000 },  // 0x62 'b'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00018000, 0x00000000, 0x00000000, 0x00018000 },  // 0x63 'c'
+    { 0x00000000, 0x00010000, 0x00000000, 0x00000000, 0x00010000, 0x00010000, 0x00008000, 0x00010000 },  // 0x64 'd'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00000000, 0x00008000, 0x00018000 },  // 0x65 'e'
+    { 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00018000, 0x00008000, 0x00000000, 0x00000000 },  // 0x66 'f'
+    { 0x00000000, 0x00010000, 0x00010000, 0x00000000, 0x00010000, 0x00010000, 0x00000000, 0x00010000 },  // 0x67 'g'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00008000 },  // 0x68 'h'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00000000, 0x00000000 },  // 0x69 'i'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00000000, 0x00008000, 0x00008000 },  // 0x6A 'j'
+    { 0x00000000, 0x00000000, 0x00010000, 0x00010000, 0x00000000, 0x00008000, 0x00010000, 0x00000000 },  // 0x6B 'k'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00008000 },  // 0x6C 'l'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00018000, 0x00018000, 0x00000000, 0x00008000 },  // 0x6D 'm'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00008000 },  // 0x6E 'n'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00018000, 0x00010000, 0x00000000, 0x00018000 },  // 0x6F 'o'
+    { 0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00000000, 0x00008000 },  // 0x70 'p'
+    { 0x00000000, 0x00010000, 0x00010000, 0x00000000, 0x00010000, 0x00010000, 0x00000000, 0x00000000 },  // 0x71 'q'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00008000 },  // 0x72 'r'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00010000, 0x00010000 },  // 0x73 's'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00000000, 0x00018000 },  // 0x74 't'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00018000 },  // 0x75 'u'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00008000 },  // 0x76 'v'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00018000, 0x00008000 },  // 0x77 'w'
+    { 0x00000000, 0x00000000, 0x00018000, 0x00000000, 0x00000000, 0x00000000, 0x00018000, 0x00000000 },  // 0x78 'x'
+    { 0x00000000, 0x00010000, 0x00000000, 0x00010000, 0x00010000, 0x00010000, 0x00000000, 0x00010000 },  // 0x79 'y'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00000000, 0x00008000, 0x00010000 },  // 0x7A 'z'
+    { 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00008000, 0x00000000, 0x00008000, 0x00010000 },  // 0x7B '{'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00008000, 0x00000000, 0x00000000 },  // 0x7C '|'
+    { 0x00000000, 0x00008000, 0x00010000, 0x00000000, 0x00010000, 0x00000000, 0x00010000, 0x00010000 },  // 0x7D '}'
+    { 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00018000, 0x00000000, 0x00008000, 0x00000000 },  // 0x7E '~'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 }   // 0x7F
+  },
+  { // P03
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x20
+    { 0x00000000, 0x00040000, 0x00000000, 0x00000000, 0x00000000, 0x00041000, 0x00000000, 0x00000000 },  // 0x21 '!'
+    { 0x00000000, 0x00040000, 0x00000000, 0x00040000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x22 '"'
+    { 0x00000000, 0x00040000, 0x00000000, 0x00040000, 0x00060000, 0x00060000, 0x00000000, 0x00040000 },  // 0x23 '#'
+    { 0x00000000, 0x00020000, 0x00000000, 0x00060000, 0x00060000, 0x00060000, 0x00000000, 0x00040000 },  // 0x24 '$'
+    { 0x00000000, 0x00000000, 0x00060000, 0x00060000, 0x00060000, 0x00060000, 0x00060000, 0x00000000 },  // 0x25 '%'
+    { 0x00000000, 0x00020000, 0x00020000, 0x00040000, 0x00020000, 0x00000000, 0x00040000, 0x00060000 },  // 0x26 '&'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x27 '''
+    { 0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00000000, 0x00000000, 0x00040000, 0x00000000 },  // 0x28 '('
+    { 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000 },  // 0x29 ')'
+    { 0x00000000, 0x00000000, 0x00060000, 0x00040000, 0x00060000, 0x00020000, 0x00060000, 0x00000000 },  // 0x2A '*'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00040000, 0x00060000, 0x00020000, 0x00000000, 0x00000000 },  // 0x2B '+'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000 },  // 0x2C ','
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00060000, 0x00000000, 0x00000000, 0x00000000 },  // 0x2D '-'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001000, 0x00000000, 0x00000000 },  // 0x2E '.'
+    { 0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000 },  // 0x2F '/'
+    { 0x00000000, 0x00060000, 0x00040000, 0x00020000, 0x00000000, 0x00040000, 0x00020000, 0x00060000 },  // 0x30 '0'
+    { 0x00000000, 0x00040000, 0x00040000, 0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00000000 },  // 0x31 '1'
+    { 0x00000000, 0x00060000, 0x00000000, 0x00000000, 0x00060000, 0x00000000, 0x00000000, 0x00060000 },  // 0x32 '2'
+    { 0x00000000, 0x00060000, 0x00000000, 0x00000000, 0x00040000, 0x00040000, 0x00000000, 0x00040000 },  // 0x33 '3'
+    { 0x00000000, 0x00040000, 0x00000000, 0x00020000, 0x00060000, 0x00040000, 0x00000000, 0x00000000 },  // 0x34 '4'
+    { 0x00000000, 0x00020000, 0x00000000, 0x00020000, 0x00020000, 0x00000000, 0x00040000, 0x00040000 },  // 0x35 '5'
+    { 0x00000000, 0x00020000, 0x00000000, 0x00020000, 0x00060000, 0x00040000, 0x00000000, 0x00060000 },  // 0x36 '6'
+    { 0x00000000, 0x00060000, 0x00000000, 0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00000000 },  // 0x37 '7'
+    { 0x00000000, 0x00060000, 0x00000000, 0x00020000, 0x00060000, 0x00040000, 0x00000000, 0x00060000 },  // 0x38 '8'
+    { 0x00000000, 0x00060000, 0x00000000, 0x00020000, 0x00060000, 0x00040000, 0x00000000, 0x00040000 },  // 0x39 '9'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00020000, 0x00000000, 0x00000000 },  // 0x3A ':'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00000000, 0x00020000, 0x00000000 },  // 0x3B ';'
+    { 0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00020000, 0x00000000, 0x00040000, 0x00000000 },  // 0x3C '<'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00060000, 0x00000000, 0x00000000, 0x00040000 },  // 0x3D '='
+    { 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00040000, 0x00000000, 0x00020000, 0x00000000 },  // 0x3E '>'
+    { 0x00000000, 0x00060000, 0x00000000, 0x00000000, 0x00040000, 0x00021000, 0x00000000, 0x00000000 },  // 0x3F '?'
+    { 0x00000000, 0x00060000, 0x00000000, 0x00060000, 0x00040000, 0x00000000, 0x00000000, 0x00060000 },  // 0x40 '@'
+    { 0x00000000, 0x00060000, 0x00000000, 0x00020000, 0x00060000, 0x00040000, 0x00000000, 0x00020000 },  // 0x41 'A'
+    { 0x00000000, 0x00060000, 0x00000000, 0x00040000, 0x00040000, 0x00060000, 0x00000000, 0x00040000 },  // 0x42 'B'
+    { 0x00000000, 0x00020000, 0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00060000 },  // 0x43 'C'
+    { 0x00000000, 0x00060000, 0x00000000, 0x00040000, 0x00000000, 0x00060000, 0x00000000, 0x00040000 },  // 0x44 'D'
+    { 0x00000000, 0x00020000, 0x00000000, 0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00060000 },  // 0x45 'E'
+    { 0x00000000, 0x00020000, 0x00000000, 0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00020000 },  // 0x46 'F'
+    { 0x00000000, 0x00020000, 0x00000000, 0x00020000, 0x00040000, 0x00040000, 0x00000000, 0x00060000 },  // 0x47 'G'
+    { 0x00000000, 0x00040000, 0x00000000, 0x00020000, 0x00060000, 0x00040000, 0x00000000, 0x00020000 },  // 0x48 'H'
+    { 0x00000000, 0x00020000, 0x00000000, 0x00040000, 0x00000000, 0x00020000, 0x00000000, 0x00040000 },  // 0x49 'I'
+    { 0x00000000, 0x00040000, 0x00000000, 0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00060000 },  // 0x4A 'J'
+    { 0x00000000, 0x00000000, 0x00040000, 0x00020000, 0x00020000, 0x00000000, 0x00040000, 0x00020000 },  // 0x4B 'K'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00060000 },  // 0x4C 'L'
+    { 0x00000000, 0x00040000, 0x00060000, 0x00020000, 0x00000000, 0x00040000, 0x00000000, 0x00020000 },  // 0x4D 'M'
+    { 0x00000000, 0x00040000, 0x00020000, 0x00020000, 0x00000000, 0x00040000, 0x00040000, 0x00020000 },  // 0x4E 'N'
+    { 0x00000000, 0x00060000, 0x00000000, 0x00020000, 0x00000000, 0x00040000, 0x00000000, 0x00060000 },  // 0x4F 'O'
+    { 0x00000000, 0x00060000, 0x00000000, 0x00020000, 0x00060000, 0x00000000, 0x00000000, 0x00020000 },  // 0x50 'P'
+    { 0x00000000, 0x00060000, 0x00000000, 0x00020000, 0x00000000, 0x00040000, 0x00040000, 0x00060000 },  // 0x51 'Q'
+    { 0x00000000, 0x00060000, 0x00000000, 0x00020000, 0x00060000, 0x00000000, 0x00040000, 0x00020000 },  // 0x52 'R'
+    { 0x00000000, 0x00020000, 0x00000000, 0x00020000, 0x00060000, 0x00040000, 0x00000000, 0x00040000 },  // 0x53 'S'
+    { 0x00000000, 0x00020000, 0x00000000, 0x00040000, 0x00000000, 0x00020000, 0x00000000, 0x00000000 },  // 0x54 'T'
+    { 0x00000000, 0x00040000, 0x00000000, 0x00020000, 0x00000000, 0x00040000, 0x00000000, 0x00060000 },  // 0x55 'U'
+    { 0x00000000, 0x00000000, 0x00040000, 0x00020000, 0x00000000, 0x00000000, 0x00020000, 0x00020000 },  // 0x56 'V'
+    { 0x00000000, 0x00040000, 0x00000000, 0x00020000, 0x00000000, 0x00040000, 0x00060000, 0x00020000 },  // 0x57 'W'
+    { 0x00000000, 0x00000000, 0x00060000, 0x00000000, 0x00000000, 0x00000000, 0x00060000, 0x00000000 },  // 0x58 'X'
+    { 0x00000000, 0x00040000, 0x00000000, 0x00020000, 0x00060000, 0x00040000, 0x00000000, 0x00040000 },  // 0x59 'Y'
+    { 0x00000000, 0x00020000, 0x00040000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00040000 },  // 0x5A 'Z'
+    { 0x00000000, 0x00020000, 0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00060000 },  // 0x5B '['
+    { 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00040000, 0x00000000 },  // 0x5C
+    { 0x00000000, 0x00060000, 0x00000000, 0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00040000 },  // 0x5D ']'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00060000, 0x00000000 },  // 0x5E '^'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00040000 },  // 0x5F '_'
+    { 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x60 '`'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00000000, 0x00060000 },  // 0x61 'a'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00000000, 0x00040000, 0x00060000 },  // 0x62 'b'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00060000, 0x00000000, 0x00000000, 0x00060000 },  // 0x63 'c'
+    { 0x00000000, 0x00040000, 0x00000000, 0x00000000, 0x00040000, 0x00040000, 0x00020000, 0x00040000 },  // 0x64 'd'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00020000, 0x00060000 },  // 0x65 'e'
+    { 0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00060000, 0x00020000, 0x00000000, 0x00000000 },  // 0x66 'f'
+    { 0x00000000, 0x00040000, 0x00040000, 0x00000000, 0x00040000, 0x00040000, 0x00000000, 0x00040000 },  // 0x67 'g'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00000000, 0x00020000 },  // 0x68 'h'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00000000 },  // 0x69 'i'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00000000, 0x00020000, 0x00020000 },  // 0x6A 'j'
+    { 0x00000000, 0x00000000, 0x00040000, 0x00040000, 0x00000000, 0x00020000, 0x00040000, 0x00000000 },  // 0x6B 'k'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00020000 },  // 0x6C 'l'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00060000, 0x00060000, 0x00000000, 0x00020000 },  // 0x6D 'm'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00000000, 0x00020000 },  // 0x6E 'n'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00060000, 0x00040000, 0x00000000, 0x00060000 },  // 0x6F 'o'
+    { 0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00020000 },  // 0x70 'p'
+    { 0x00000000, 0x00040000, 0x00040000, 0x00000000, 0x00040000, 0x00040000, 0x00000000, 0x00000000 },  // 0x71 'q'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00020000 },  // 0x72 'r'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00040000, 0x00040000 },  // 0x73 's'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00020000, 0x00000000, 0x00000000, 0x00060000 },  // 0x74 't'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00060000 },  // 0x75 'u'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00020000 },  // 0x76 'v'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00040000, 0x00060000, 0x00020000 },  // 0x77 'w'
+    { 0x00000000, 0x00000000, 0x00060000, 0x00000000, 0x00000000, 0x00000000, 0x00060000, 0x00000000 },  // 0x78 'x'
+    { 0x00000000, 0x00040000, 0x00000000, 0x00040000, 0x00040000, 0x00040000, 0x00000000, 0x00040000 },  // 0x79 'y'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00020000, 0x00040000 },  // 0x7A 'z'
+    { 0x00000000, 0x00020000, 0x00020000, 0x00000000, 0x00020000, 0x00000000, 0x00020000, 0x00040000 },  // 0x7B '{'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00020000, 0x00000000, 0x00000000 },  // 0x7C '|'
+    { 0x00000000, 0x00020000, 0x00040000, 0x00000000, 0x00040000, 0x00000000, 0x00040000, 0x00040000 },  // 0x7D '}'
+    { 0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00060000, 0x00000000, 0x00020000, 0x00000000 },  // 0x7E '~'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 }   // 0x7F
+  },
+  { // P04
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x20
+    { 0x00000000, 0x10000000, 0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x00001000, 0x00000000 },  // 0x21 '!'
+    { 0x00000000, 0x10000000, 0x00000000, 0x10000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x22 '"'
+    { 0x00000000, 0x10000000, 0x00000000, 0x10000000, 0x10080000, 0x10080000, 0x00000000, 0x10000000 },  // 0x23 '#'
+    { 0x00000000, 0x00080000, 0x00000000, 0x10080000, 0x10080000, 0x10080000, 0x00000000, 0x10000000 },  // 0x24 '$'
+    { 0x00000000, 0x00000000, 0x10080000, 0x10080000, 0x10080000, 0x10080000, 0x10080000, 0x00000000 },  // 0x25 '%'
+    { 0x00000000, 0x00080000, 0x00080000, 0x10000000, 0x00080000, 0x00000000, 0x10000000, 0x10080000 },  // 0x26 '&'
+    { 0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x27 '''
+    { 0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x00000000 },  // 0x28 '('
+    { 0x00000000, 0x00000000, 0x00080000, 0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00000000 },  // 0x29 ')'
+    { 0x00000000, 0x00000000, 0x10080000, 0x10000000, 0x10080000, 0x00080000, 0x10080000, 0x00000000 },  // 0x2A '*'
+    { 0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x10080000, 0x00080000, 0x00000000, 0x00000000 },  // 0x2B '+'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00000000 },  // 0x2C ','
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10080000, 0x00000000, 0x00000000, 0x00000000 },  // 0x2D '-'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001000, 0x00000000 },  // 0x2E '.'
+    { 0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00000000 },  // 0x2F '/'
+    { 0x00000000, 0x10080000, 0x10000000, 0x00080000, 0x00000000, 0x10000000, 0x00080000, 0x10080000 },  // 0x30 '0'
+    { 0x00000000, 0x10000000, 0x10000000, 0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x00000000 },  // 0x31 '1'
+    { 0x00000000, 0x10080000, 0x00000000, 0x00000000, 0x10080000, 0x00000000, 0x00000000, 0x10080000 },  // 0x32 '2'
+    { 0x00000000, 0x10080000, 0x00000000, 0x00000000, 0x10000000, 0x10000000, 0x00000000, 0x10000000 },  // 0x33 '3'
+    { 0x00000000, 0x10000000, 0x00000000, 0x00080000, 0x10080000, 0x10000000, 0x00000000, 0x00000000 },  // 0x34 '4'
+    { 0x00000000, 0x00080000, 0x00000000, 0x00080000, 0x00080000, 0x00000000, 0x10000000, 0x10000000 },  // 0x35 '5'
+    { 0x00000000, 0x00080000, 0x00000000, 0x00080000, 0x10080000, 0x10000000, 0x00000000, 0x10080000 },  // 0x36 '6'
+    { 0x00000000, 0x10080000, 0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x00000000 },  // 0x37 '7'
+    { 0x00000000, 0x10080000, 0x00000000, 0x00080000, 0x10080000, 0x10000000, 0x00000000, 0x10080000 },  // 0x38 '8'
+    { 0x00000000, 0x10080000, 0x00000000, 0x00080000, 0x10080000, 0x10000000, 0x00000000, 0x10000000 },  // 0x39 '9'
+    { 0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x00080000, 0x00000000, 0x00000000 },  // 0x3A ':'
+    { 0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x00000000, 0x00080000, 0x00000000 },  // 0x3B ';'
+    { 0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x00080000, 0x00000000, 0x10000000, 0x00000000 },  // 0x3C '<'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10080000, 0x00000000, 0x00000000, 0x10000000 },  // 0x3D '='
+    { 0x00000000, 0x00000000, 0x00080000, 0x00000000, 0x10000000, 0x00000000, 0x00080000, 0x00000000 },  // 0x3E '>'
+    { 0x00000000, 0x10080000, 0x00000000, 0x00000000, 0x10000000, 0x00080000, 0x00001000, 0x00000000 },  // 0x3F '?'
+    { 0x00000000, 0x10080000, 0x00000000, 0x10080000, 0x10000000, 0x00000000, 0x00000000, 0x10080000 },  // 0x40 '@'
+    { 0x00000000, 0x10080000, 0x00000000, 0x00080000, 0x10080000, 0x10000000, 0x00000000, 0x00080000 },  // 0x41 'A'
+    { 0x00000000, 0x10080000, 0x00000000, 0x10000000, 0x10000000, 0x10080000, 0x00000000, 0x10000000 },  // 0x42 'B'
+    { 0x00000000, 0x00080000, 0x00000000, 0x00080000, 0x00000000, 0x00000000, 0x00000000, 0x10080000 },  // 0x43 'C'
+    { 0x00000000, 0x10080000, 0x00000000, 0x10000000, 0x00000000, 0x10080000, 0x00000000, 0x10000000 },  // 0x44 'D'
+    { 0x00000000, 0x00080000, 0x00000000, 0x00080000, 0x00080000, 0x00000000, 0x00000000, 0x10080000 },  // 0x45 'E'
+    { 0x00000000, 0x00080000, 0x00000000, 0x00080000, 0x00080000, 0x00000000, 0x00000000, 0x00080000 },  // 0x46 'F'
+    { 0x00000000, 0x00080000, 0x00000000, 0x00080000, 0x10000000, 0x10000000, 0x00000000, 0x10080000 },  // 0x47 'G'
+    { 0x00000000, 0x10000000, 0x00000000, 0x00080000, 0x10080000, 0x10000000, 0x00000000, 0x00080000 },  // 0x48 'H'
+    { 0x00000000, 0x00080000, 0x00000000, 0x10000000, 0x00000000, 0x00080000, 0x00000000, 0x10000000 },  // 0x49 'I'
+    { 0x00000000, 0x10000000, 0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x10080000 },  // 0x4A 'J'
+    { 0x00000000, 0x00000000, 0x10000000, 0x00080000, 0x00080000, 0x00000000, 0x10000000, 0x00080000 },  // 0x4B 'K'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00000000, 0x00000000, 0x00000000, 0x10080000 },  // 0x4C 'L'
+    { 0x00000000, 0x10000000, 0x10080000, 0x00080000, 0x00000000, 0x10000000, 0x00000000, 0x00080000 },  // 0x4D 'M'
+    { 0x00000000, 0x10000000, 0x00080000, 0x00080000, 0x00000000, 0x10000000, 0x10000000, 0x00080000 },  // 0x4E 'N'
+    { 0x00000000, 0x10080000, 0x00000000, 0x00080000, 0x00000000, 0x10000000, 0x00000000, 0x10080000 },  // 0x4F 'O'
+    { 0x00000000, 0x10080000, 0x00000000, 0x00080000, 0x10080000, 0x00000000, 0x00000000, 0x00080000 },  // 0x50 'P'
+    { 0x00000000, 0x10080000, 0x00000000, 0x00080000, 0x00000000, 0x10000000, 0x10000000, 0x10080000 },  // 0x51 'Q'
+    { 0x00000000, 0x10080000, 0x00000000, 0x00080000, 0x10080000, 0x00000000, 0x10000000, 0x00080000 },  // 0x52 'R'
+    { 0x00000000, 0x00080000, 0x00000000, 0x00080000, 0x10080000, 0x10000000, 0x00000000, 0x10000000 },  // 0x53 'S'
+    { 0x00000000, 0x00080000, 0x00000000, 0x10000000, 0x00000000, 0x00080000, 0x00000000, 0x00000000 },  // 0x54 'T'
+    { 0x00000000, 0x10000000, 0x00000000, 0x00080000, 0x00000000, 0x10000000, 0x00000000, 0x10080000 },  // 0x55 'U'
+    { 0x00000000, 0x00000000, 0x10000000, 0x00080000, 0x00000000, 0x00000000, 0x00080000, 0x00080000 },  // 0x56 'V'
+    { 0x00000000, 0x10000000, 0x00000000, 0x00080000, 0x00000000, 0x10000000, 0x10080000, 0x00080000 },  // 0x57 'W'
+    { 0x00000000, 0x00000000, 0x10080000, 0x00000000, 0x00000000, 0x00000000, 0x10080000, 0x00000000 },  // 0x58 'X'
+    { 0x00000000, 0x10000000, 0x00000000, 0x00080000, 0x10080000, 0x10000000, 0x00000000, 0x10000000 },  // 0x59 'Y'
+    { 0x00000000, 0x00080000, 0x10000000, 0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x10000000 },  // 0x5A 'Z'
+    { 0x00000000, 0x00080000, 0x00000000, 0x00080000, 0x00000000, 0x00000000, 0x00000000, 0x10080000 },  // 0x5B '['
+    { 0x00000000, 0x00000000, 0x00080000, 0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x00000000 },  // 0x5C
+    { 0x00000000, 0x10080000, 0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x10000000 },  // 0x5D ']'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10080000, 0x00000000 },  // 0x5E '^'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10000000 },  // 0x5F '_'
+    { 0x00000000, 0x00000000, 0x00080000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x60 '`'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00080000, 0x00000000, 0x10080000 },  // 0x61 'a'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00080000, 0x00000000, 0x10000000, 0x10080000 },  // 0x62 'b'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10080000, 0x00000000, 0x00000000, 0x10080000 },  // 0x63 'c'
+    { 0x00000000, 0x10000000, 0x00000000, 0x00000000, 0x10000000, 0x10000000, 0x00080000, 0x10000000 },  // 0x64 'd'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00000000, 0x00080000, 0x10080000 },  // 0x65 'e'
+    { 0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x10080000, 0x00080000, 0x00000000, 0x00000000 },  // 0x66 'f'
+    { 0x00000000, 0x10000000, 0x10000000, 0x00000000, 0x10000000, 0x10000000, 0x00000000, 0x10000000 },  // 0x67 'g'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00080000, 0x00080000, 0x00000000, 0x00080000 },  // 0x68 'h'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00000000, 0x00000000 },  // 0x69 'i'
+    { 0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x00000000, 0x00080000, 0x00080000 },  // 0x6A 'j'
+    { 0x00000000, 0x00000000, 0x10000000, 0x10000000, 0x00000000, 0x00080000, 0x10000000, 0x00000000 },  // 0x6B 'k'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00000000, 0x00000000, 0x00000000, 0x00080000 },  // 0x6C 'l'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10080000, 0x10080000, 0x00000000, 0x00080000 },  // 0x6D 'm'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00080000, 0x00000000, 0x00080000 },  // 0x6E 'n'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10080000, 0x10000000, 0x00000000, 0x10080000 },  // 0x6F 'o'
+    { 0x00000000, 0x00000000, 0x00080000, 0x00080000, 0x00080000, 0x00000000, 0x00000000, 0x00080000 },  // 0x70 'p'
+    { 0x00000000, 0x10000000, 0x10000000, 0x00000000, 0x10000000, 0x10000000, 0x00000000, 0x00000000 },  // 0x71 'q'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00000000, 0x00000000, 0x00080000 },  // 0x72 'r'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x10000000, 0x10000000 },  // 0x73 's'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00080000, 0x00000000, 0x00000000, 0x10080000 },  // 0x74 't'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x10080000 },  // 0x75 'u'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00080000 },  // 0x76 'v'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x10080000, 0x00080000 },  // 0x77 'w'
+    { 0x00000000, 0x00000000, 0x10080000, 0x00000000, 0x00000000, 0x00000000, 0x10080000, 0x00000000 },  // 0x78 'x'
+    { 0x00000000, 0x10000000, 0x00000000, 0x10000000, 0x10000000, 0x10000000, 0x00000000, 0x10000000 },  // 0x79 'y'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00000000, 0x00080000, 0x10000000 },  // 0x7A 'z'
+    { 0x00000000, 0x00080000, 0x00080000, 0x00000000, 0x00080000, 0x00000000, 0x00080000, 0x10000000 },  // 0x7B '{'
+    { 0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x00080000, 0x00000000, 0x00000000 },  // 0x7C '|'
+    { 0x00000000, 0x00080000, 0x10000000, 0x00000000, 0x10000000, 0x00000000, 0x10000000, 0x10000000 },  // 0x7D '}'
+    { 0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x10080000, 0x00000000, 0x00080000, 0x00000000 },  // 0x7E '~'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 }   // 0x7F
+  },
+  { // P05
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x20
+    { 0x00000000, 0x40000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x00000000, 0x20000000 },  // 0x21 '!'
+    { 0x00000000, 0x40000000, 0x00000000, 0x40000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x22 '"'
+    { 0x00000000, 0x40000000, 0x00000000, 0x60000000, 0x60000000, 0x40000000, 0x00000000, 0x40000000 },  // 0x23 '#'
+    { 0x20000000, 0x00000000, 0x20000000, 0x60000000, 0x60000000, 0x40000000, 0x00000000, 0x40000000 },  // 0x24 '$'
+    { 0x00000000, 0x20000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x40000000, 0x00000000 },  // 0x25 '%'
+    { 0x20000000, 0x20000000, 0x00000000, 0x60000000, 0x00000000, 0x00000000, 0x60000000, 0x40000000 },  // 0x26 '&'
+    { 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x27 '''
+    { 0x00000000, 0x00000000, 0x40000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x00000000 },  // 0x28 '('
+    { 0x00000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x00000000, 0x00000000 },  // 0x29 ')'
+    { 0x00000000, 0x20000000, 0x40000000, 0x60000000, 0x60000000, 0x20000000, 0x40000000, 0x00000000 },  // 0x2A '*'
+    { 0x00000000, 0x00000000, 0x00000000, 0x60000000, 0x60000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x2B '+'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x00000000, 0x00000000 },  // 0x2C ','
+    { 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x40000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x2D '-'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000 },  // 0x2E '.'
+    { 0x00000000, 0x00000000, 0x40000000, 0x00000000, 0x00000000, 0x20000000, 0x00000000, 0x00000000 },  // 0x2F '/'
+    { 0x20000000, 0x40000000, 0x60000000, 0x00000000, 0x00000000, 0x60000000, 0x20000000, 0x40000000 },  // 0x30 '0'
+    { 0x00000000, 0x40000000, 0x40000000, 0x00000000, 0x00000000, 0x40000000, 0x00000000, 0x00000000 },  // 0x31 '1'
+    { 0x20000000, 0x40000000, 0x00000000, 0x20000000, 0x40000000, 0x00000000, 0x20000000, 0x40000000 },  // 0x32 '2'
+    { 0x20000000, 0x40000000, 0x00000000, 0x00000000, 0x40000000, 0x40000000, 0x00000000, 0x40000000 },  // 0x33 '3'
+    { 0x00000000, 0x40000000, 0x20000000, 0x20000000, 0x40000000, 0x40000000, 0x00000000, 0x00000000 },  // 0x34 '4'
+    { 0x20000000, 0x00000000, 0x20000000, 0x20000000, 0x00000000, 0x00000000, 0x40000000, 0x40000000 },  // 0x35 '5'
+    { 0x20000000, 0x00000000, 0x20000000, 0x20000000, 0x40000000, 0x40000000, 0x20000000, 0x40000000 },  // 0x36 '6'
+    { 0x20000000, 0x40000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x00000000, 0x00000000 },  // 0x37 '7'
+    { 0x20000000, 0x40000000, 0x20000000, 0x20000000, 0x40000000, 0x40000000, 0x20000000, 0x40000000 },  // 0x38 '8'
+    { 0x20000000, 0x40000000, 0x20000000, 0x20000000, 0x40000000, 0x40000000, 0x00000000, 0x40000000 },  // 0x39 '9'
+    { 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x3A ':'
+    { 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x00000000, 0x20000000, 0x00000000, 0x00000000 },  // 0x3B ';'
+    { 0x00000000, 0x00000000, 0x40000000, 0x20000000, 0x00000000, 0x00000000, 0x40000000, 0x00000000 },  // 0x3C '<'
+    { 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x40000000, 0x00000000, 0x00000000, 0x40000000 },  // 0x3D '='
+    { 0x00000000, 0x20000000, 0x00000000, 0x00000000, 0x40000000, 0x20000000, 0x00000000, 0x00000000 },  // 0x3E '>'
+    { 0x20000000, 0x40000000, 0x00000000, 0x00000000, 0x60000000, 0x00000000, 0x00000000, 0x20000000 },  // 0x3F '?'
+    { 0x20000000, 0x40000000, 0x20000000, 0x40000000, 0x40000000, 0x00000000, 0x20000000, 0x40000000 },  // 0x40 '@'
+    { 0x20000000, 0x40000000, 0x20000000, 0x20000000, 0x40000000, 0x40000000, 0x20000000, 0x00000000 },  // 0x41 'A'
+    { 0x20000000, 0x40000000, 0x00000000, 0x40000000, 0x60000000, 0x40000000, 0x00000000, 0x40000000 },  // 0x42 'B'
+    { 0x20000000, 0x00000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x40000000 },  // 0x43 'C'
+    { 0x20000000, 0x40000000, 0x00000000, 0x40000000, 0x20000000, 0x40000000, 0x00000000, 0x40000000 },  // 0x44 'D'
+    { 0x20000000, 0x00000000, 0x20000000, 0x20000000, 0x00000000, 0x00000000, 0x20000000, 0x40000000 },  // 0x45 'E'
+    { 0x20000000, 0x00000000, 0x20000000, 0x20000000, 0x00000000, 0x00000000, 0x20000000, 0x00000000 },  // 0x46 'F'
+    { 0x20000000, 0x00000000, 0x20000000, 0x00000000, 0x40000000, 0x40000000, 0x20000000, 0x40000000 },  // 0x47 'G'
+    { 0x00000000, 0x40000000, 0x20000000, 0x20000000, 0x40000000, 0x40000000, 0x20000000, 0x00000000 },  // 0x48 'H'
+    { 0x20000000, 0x00000000, 0x00000000, 0x40000000, 0x20000000, 0x00000000, 0x00000000, 0x40000000 },  // 0x49 'I'
+    { 0x00000000, 0x40000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x20000000, 0x40000000 },  // 0x4A 'J'
+    { 0x00000000, 0x00000000, 0x60000000, 0x20000000, 0x00000000, 0x00000000, 0x60000000, 0x00000000 },  // 0x4B 'K'
+    { 0x00000000, 0x00000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x40000000 },  // 0x4C 'L'
+    { 0x00000000, 0x60000000, 0x60000000, 0x00000000, 0x00000000, 0x40000000, 0x20000000, 0x00000000 },  // 0x4D 'M'
+    { 0x00000000, 0x60000000, 0x20000000, 0x00000000, 0x00000000, 0x40000000, 0x60000000, 0x00000000 },  // 0x4E 'N'
+    { 0x20000000, 0x40000000, 0x20000000, 0x00000000, 0x00000000, 0x40000000, 0x20000000, 0x40000000 },  // 0x4F 'O'
+    { 0x20000000, 0x40000000, 0x20000000, 0x20000000, 0x40000000, 0x00000000, 0x20000000, 0x00000000 },  // 0x50 'P'
+    { 0x20000000, 0x40000000, 0x20000000, 0x00000000, 0x00000000, 0x40000000, 0x60000000, 0x40000000 },  // 0x51 'Q'
+    { 0x20000000, 0x40000000, 0x20000000, 0x20000000, 0x40000000, 0x00000000, 0x60000000, 0x00000000 },  // 0x52 'R'
+    { 0x20000000, 0x00000000, 0x20000000, 0x20000000, 0x40000000, 0x40000000, 0x00000000, 0x40000000 },  // 0x53 'S'
+    { 0x20000000, 0x00000000, 0x00000000, 0x40000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x54 'T'
+    { 0x00000000, 0x40000000, 0x20000000, 0x00000000, 0x00000000, 0x40000000, 0x20000000, 0x40000000 },  // 0x55 'U'
+    { 0x00000000, 0x00000000, 0x60000000, 0x00000000, 0x00000000, 0x20000000, 0x20000000, 0x00000000 },  // 0x56 'V'
+    { 0x00000000, 0x40000000, 0x20000000, 0x00000000, 0x00000000, 0x60000000, 0x60000000, 0x00000000 },  // 0x57 'W'
+    { 0x00000000, 0x20000000, 0x40000000, 0x00000000, 0x00000000, 0x20000000, 0x40000000, 0x00000000 },  // 0x58 'X'
+    { 0x00000000, 0x40000000, 0x20000000, 0x20000000, 0x40000000, 0x40000000, 0x00000000, 0x40000000 },  // 0x59 'Y'
+    { 0x20000000, 0x00000000, 0x40000000, 0x00000000, 0x00000000, 0x20000000, 0x00000000, 0x40000000 },  // 0x5A 'Z'
+    { 0x20000000, 0x00000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x40000000 },  // 0x5B '['
+    { 0x00000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x00000000 },  // 0x5C
+    { 0x20000000, 0x40000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x00000000, 0x40000000 },  // 0x5D ']'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x40000000, 0x00000000 },  // 0x5E '^'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000 },  // 0x5F '_'
+    { 0x00000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x60 '`'
+    { 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x20000000, 0x00000000, 0x20000000, 0x40000000 },  // 0x61 'a'
+    { 0x00000000, 0x00000000, 0x20000000, 0x20000000, 0x00000000, 0x00000000, 0x60000000, 0x40000000 },  // 0x62 'b'
+    { 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x40000000, 0x00000000, 0x20000000, 0x40000000 },  // 0x63 'c'
+    { 0x00000000, 0x40000000, 0x00000000, 0x00000000, 0x40000000, 0x60000000, 0x00000000, 0x40000000 },  // 0x64 'd'
+    { 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x00000000, 0x20000000, 0x20000000, 0x40000000 },  // 0x65 'e'
+    { 0x00000000, 0x00000000, 0x40000000, 0x20000000, 0x60000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x66 'f'
+    { 0x00000000, 0x40000000, 0x40000000, 0x00000000, 0x40000000, 0x40000000, 0x00000000, 0x40000000 },  // 0x67 'g'
+    { 0x00000000, 0x00000000, 0x20000000, 0x20000000, 0x20000000, 0x00000000, 0x20000000, 0x00000000 },  // 0x68 'h'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x69 'i'
+    { 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x00000000, 0x20000000, 0x20000000, 0x00000000 },  // 0x6A 'j'
+    { 0x00000000, 0x00000000, 0x40000000, 0x40000000, 0x20000000, 0x00000000, 0x40000000, 0x00000000 },  // 0x6B 'k'
+    { 0x00000000, 0x00000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x00000000 },  // 0x6C 'l'
+    { 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x60000000, 0x40000000, 0x20000000, 0x00000000 },  // 0x6D 'm'
+    { 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x20000000, 0x00000000, 0x20000000, 0x00000000 },  // 0x6E 'n'
+    { 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x40000000, 0x40000000, 0x20000000, 0x40000000 },  // 0x6F 'o'
+    { 0x00000000, 0x20000000, 0x20000000, 0x20000000, 0x00000000, 0x00000000, 0x20000000, 0x00000000 },  // 0x70 'p'
+    { 0x00000000, 0x40000000, 0x40000000, 0x00000000, 0x40000000, 0x40000000, 0x00000000, 0x00000000 },  // 0x71 'q'
+    { 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x00000000, 0x00000000, 0x20000000, 0x00000000 },  // 0x72 'r'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x00000000, 0x40000000, 0x40000000 },  // 0x73 's'
+    { 0x00000000, 0x00000000, 0x20000000, 0x20000000, 0x00000000, 0x00000000, 0x20000000, 0x40000000 },  // 0x74 't'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x20000000, 0x40000000 },  // 0x75 'u'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x20000000, 0x00000000 },  // 0x76 'v'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x60000000, 0x60000000, 0x00000000 },  // 0x77 'w'
+    { 0x00000000, 0x20000000, 0x40000000, 0x00000000, 0x00000000, 0x20000000, 0x40000000, 0x00000000 },  // 0x78 'x'
+    { 0x00000000, 0x40000000, 0x00000000, 0x40000000, 0x40000000, 0x40000000, 0x00000000, 0x40000000 },  // 0x79 'y'
+    { 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x00000000, 0x20000000, 0x00000000, 0x40000000 },  // 0x7A 'z'
+    { 0x20000000, 0x20000000, 0x00000000, 0x20000000, 0x00000000, 0x20000000, 0x00000000, 0x40000000 },  // 0x7B '{'
+    { 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x7C '|'
+    { 0x20000000, 0x00000000, 0x40000000, 0x00000000, 0x40000000, 0x00000000, 0x40000000, 0x40000000 },  // 0x7D '}'
+    { 0x00000000, 0x00000000, 0x40000000, 0x20000000, 0x40000000, 0x20000000, 0x00000000, 0x00000000 },  // 0x7E '~'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 }   // 0x7F
+  },
+  { // P06
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x20
+    { 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x80000000 },  // 0x21 '!'
+    { 0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x22 '"'
+    { 0x00000000, 0x00000001, 0x00000000, 0x80000001, 0x80000001, 0x00000001, 0x00000000, 0x00000001 },  // 0x23 '#'
+    { 0x80000000, 0x00000000, 0x80000000, 0x80000001, 0x80000001, 0x00000001, 0x00000000, 0x00000001 },  // 0x24 '$'
+    { 0x00000000, 0x80000000, 0x80000001, 0x80000001, 0x80000001, 0x80000001, 0x00000001, 0x00000000 },  // 0x25 '%'
+    { 0x80000000, 0x80000000, 0x00000000, 0x80000001, 0x00000000, 0x00000000, 0x80000001, 0x00000001 },  // 0x26 '&'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x27 '''
+    { 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000 },  // 0x28 '('
+    { 0x00000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000000, 0x00000000 },  // 0x29 ')'
+    { 0x00000000, 0x80000000, 0x00000001, 0x80000001, 0x80000001, 0x80000000, 0x00000001, 0x00000000 },  // 0x2A '*'
+    { 0x00000000, 0x00000000, 0x00000000, 0x80000001, 0x80000001, 0x00000000, 0x00000000, 0x00000000 },  // 0x2B '+'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000000, 0x00000000 },  // 0x2C ','
+    { 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000 },  // 0x2D '-'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000 },  // 0x2E '.'
+    { 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x80000000, 0x00000000, 0x00000000 },  // 0x2F '/'
+    { 0x80000000, 0x00000001, 0x80000001, 0x00000000, 0x00000000, 0x80000001, 0x80000000, 0x00000001 },  // 0x30 '0'
+    { 0x00000000, 0x00000001, 0x00000001, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000000 },  // 0x31 '1'
+    { 0x80000000, 0x00000001, 0x00000000, 0x80000000, 0x00000001, 0x00000000, 0x80000000, 0x00000001 },  // 0x32 '2'
+    { 0x80000000, 0x00000001, 0x00000000, 0x00000000, 0x00000001, 0x00000001, 0x00000000, 0x00000001 },  // 0x33 '3'
+    { 0x00000000, 0x00000001, 0x80000000, 0x80000000, 0x00000001, 0x00000001, 0x00000000, 0x00000000 },  // 0x34 '4'
+    { 0x80000000, 0x00000000, 0x80000000, 0x80000000, 0x00000000, 0x00000000, 0x00000001, 0x00000001 },  // 0x35 '5'
+    { 0x80000000, 0x00000000, 0x80000000, 0x80000000, 0x00000001, 0x00000001, 0x80000000, 0x00000001 },  // 0x36 '6'
+    { 0x80000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000000 },  // 0x37 '7'
+    { 0x80000000, 0x00000001, 0x80000000, 0x80000000, 0x00000001, 0x00000001, 0x80000000, 0x00000001 },  // 0x38 '8'
+    { 0x80000000, 0x00000001, 0x80000000, 0x80000000, 0x00000001, 0x00000001, 0x00000000, 0x00000001 },  // 0x39 '9'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x80000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x3A ':'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x80000000, 0x00000000, 0x00000000 },  // 0x3B ';'
+    { 0x00000000, 0x00000000, 0x00000001, 0x80000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000 },  // 0x3C '<'
+    { 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000001, 0x00000000, 0x00000000, 0x00000001 },  // 0x3D '='
+    { 0x00000000, 0x80000000, 0x00000000, 0x00000000, 0x00000001, 0x80000000, 0x00000000, 0x00000000 },  // 0x3E '>'
+    { 0x80000000, 0x00000001, 0x00000000, 0x00000000, 0x80000001, 0x00000000, 0x00000000, 0x80000000 },  // 0x3F '?'
+    { 0x80000000, 0x00000001, 0x80000000, 0x00000001, 0x00000001, 0x00000000, 0x80000000, 0x00000001 },  // 0x40 '@'
+    { 0x80000000, 0x00000001, 0x80000000, 0x80000000, 0x00000001, 0x00000001, 0x80000000, 0x00000000 },  // 0x41 'A'
+    { 0x80000000, 0x00000001, 0x00000000, 0x00000001, 0x80000001, 0x00000001, 0x00000000, 0x00000001 },  // 0x42 'B'
+    { 0x80000000, 0x00000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000001 },  // 0x43 'C'
+    { 0x80000000, 0x00000001, 0x00000000, 0x00000001, 0x80000000, 0x00000001, 0x00000000, 0x00000001 },  // 0x44 'D'
+    { 0x80000000, 0x00000000, 0x80000000, 0x80000000, 0x00000000, 0x00000000, 0x80000000, 0x00000001 },  // 0x45 'E'
+    { 0x80000000, 0x00000000, 0x80000000, 0x80000000, 0x00000000, 0x00000000, 0x80000000, 0x00000000 },  // 0x46 'F'
+    { 0x80000000, 0x00000000, 0x80000000, 0x00000000, 0x00000001, 0x00000001, 0x80000000, 0x00000001 },  // 0x47 'G'
+    { 0x00000000, 0x00000001, 0x80000000, 0x80000000, 0x00000001, 0x00000001, 0x80000000, 0x00000000 },  // 0x48 'H'
+    { 0x80000000, 0x00000000, 0x00000000, 0x00000001, 0x80000000, 0x00000000, 0x00000000, 0x00000001 },  // 0x49 'I'
+    { 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x80000000, 0x00000001 },  // 0x4A 'J'
+    { 0x00000000, 0x00000000, 0x80000001, 0x80000000, 0x00000000, 0x00000000, 0x80000001, 0x00000000 },  // 0x4B 'K'
+    { 0x00000000, 0x00000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000001 },  // 0x4C 'L'
+    { 0x00000000, 0x80000001, 0x80000001, 0x00000000, 0x00000000, 0x00000001, 0x80000000, 0x00000000 },  // 0x4D 'M'
+    { 0x00000000, 0x80000001, 0x80000000, 0x00000000, 0x00000000, 0x00000001, 0x80000001, 0x00000000 },  // 0x4E 'N'
+    { 0x80000000, 0x00000001, 0x80000000, 0x00000000, 0x00000000, 0x00000001, 0x80000000, 0x00000001 },  // 0x4F 'O'
+    { 0x80000000, 0x00000001, 0x80000000, 0x80000000, 0x00000001, 0x00000000, 0x80000000, 0x00000000 },  // 0x50 'P'
+    { 0x80000000, 0x00000001, 0x80000000, 0x00000000, 0x00000000, 0x00000001, 0x80000001, 0x00000001 },  // 0x51 'Q'
+    { 0x80000000, 0x00000001, 0x80000000, 0x80000000, 0x00000001, 0x00000000, 0x80000001, 0x00000000 },  // 0x52 'R'
+    { 0x80000000, 0x00000000, 0x80000000, 0x80000000, 0x00000001, 0x00000001, 0x00000000, 0x00000001 },  // 0x53 'S'
+    { 0x80000000, 0x00000000, 0x00000000, 0x00000001, 0x80000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x54 'T'
+    { 0x00000000, 0x00000001, 0x80000000, 0x00000000, 0x00000000, 0x00000001, 0x80000000, 0x00000001 },  // 0x55 'U'
+    { 0x00000000, 0x00000000, 0x80000001, 0x00000000, 0x00000000, 0x80000000, 0x80000000, 0x00000000 },  // 0x56 'V'
+    { 0x00000000, 0x00000001, 0x80000000, 0x00000000, 0x00000000, 0x80000001, 0x80000001, 0x00000000 },  // 0x57 'W'
+    { 0x00000000, 0x80000000, 0x00000001, 0x00000000, 0x00000000, 0x80000000, 0x00000001, 0x00000000 },  // 0x58 'X'
+    { 0x00000000, 0x00000001, 0x80000000, 0x80000000, 0x00000001, 0x00000001, 0x00000000, 0x00000001 },  // 0x59 'Y'
+    { 0x80000000, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x80000000, 0x00000000, 0x00000001 },  // 0x5A 'Z'
+    { 0x80000000, 0x00000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000001 },  // 0x5B '['
+    { 0x00000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000 },  // 0x5C
+    { 0x80000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000001 },  // 0x5D ']'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000001, 0x00000000 },  // 0x5E '^'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001 },  // 0x5F '_'
+    { 0x00000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x60 '`'
+    { 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x80000000, 0x00000000, 0x80000000, 0x00000001 },  // 0x61 'a'
+    { 0x00000000, 0x00000000, 0x80000000, 0x80000000, 0x00000000, 0x00000000, 0x80000001, 0x00000001 },  // 0x62 'b'
+    { 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000001, 0x00000000, 0x80000000, 0x00000001 },  // 0x63 'c'
+    { 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000001, 0x80000001, 0x00000000, 0x00000001 },  // 0x64 'd'
+    { 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000000, 0x80000000, 0x80000000, 0x00000001 },  // 0x65 'e'
+    { 0x00000000, 0x00000000, 0x00000001, 0x80000000, 0x80000001, 0x00000000, 0x00000000, 0x00000000 },  // 0x66 'f'
+    { 0x00000000, 0x00000001, 0x00000001, 0x00000000, 0x00000001, 0x00000001, 0x00000000, 0x00000001 },  // 0x67 'g'
+    { 0x00000000, 0x00000000, 0x80000000, 0x80000000, 0x80000000, 0x00000000, 0x80000000, 0x00000000 },  // 0x68 'h'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x69 'i'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x80000000, 0x80000000, 0x00000000 },  // 0x6A 'j'
+    { 0x00000000, 0x00000000, 0x00000001, 0x00000001, 0x80000000, 0x00000000, 0x00000001, 0x00000000 },  // 0x6B 'k'
+    { 0x00000000, 0x00000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000000 },  // 0x6C 'l'
+    { 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x80000001, 0x00000001, 0x80000000, 0x00000000 },  // 0x6D 'm'
+    { 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x80000000, 0x00000000, 0x80000000, 0x00000000 },  // 0x6E 'n'
+    { 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000001, 0x00000001, 0x80000000, 0x00000001 },  // 0x6F 'o'
+    { 0x00000000, 0x80000000, 0x80000000, 0x80000000, 0x00000000, 0x00000000, 0x80000000, 0x00000000 },  // 0x70 'p'
+    { 0x00000000, 0x00000001, 0x00000001, 0x00000000, 0x00000001, 0x00000001, 0x00000000, 0x00000000 },  // 0x71 'q'
+    { 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000000, 0x00000000, 0x80000000, 0x00000000 },  // 0x72 'r'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000001 },  // 0x73 's'
+    { 0x00000000, 0x00000000, 0x80000000, 0x80000000, 0x00000000, 0x00000000, 0x80000000, 0x00000001 },  // 0x74 't'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x80000000, 0x00000001 },  // 0x75 'u'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x80000000, 0x00000000 },  // 0x76 'v'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000001, 0x80000001, 0x00000000 },  // 0x77 'w'
+    { 0x00000000, 0x80000000, 0x00000001, 0x00000000, 0x00000000, 0x80000000, 0x00000001, 0x00000000 },  // 0x78 'x'
+    { 0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000001, 0x00000001, 0x00000000, 0x00000001 },  // 0x79 'y'
+    { 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000000, 0x80000000, 0x00000000, 0x00000001 },  // 0x7A 'z'
+    { 0x80000000, 0x80000000, 0x00000000, 0x80000000, 0x00000000, 0x80000000, 0x00000000, 0x00000001 },  // 0x7B '{'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x80000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x7C '|'
+    { 0x80000000, 0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000001 },  // 0x7D '}'
+    { 0x00000000, 0x00000000, 0x00000001, 0x80000000, 0x00000001, 0x80000000, 0x00000000, 0x00000000 },  // 0x7E '~'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 }   // 0x7F
+  },
+  { // P07
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x20
+    { 0x00000000, 0x00000004, 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00001000 },  // 0x21 '!'
+    { 0x00000000, 0x00000004, 0x00000000, 0x00000004, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x22 '"'
+    { 0x00000000, 0x00000004, 0x00000000, 0x00000004, 0x00000006, 0x00000006, 0x00000000, 0x00000004 },  // 0x23 '#'
+    { 0x00000000, 0x00000002, 0x00000000, 0x00000006, 0x00000006, 0x00000006, 0x00000000, 0x00000004 },  // 0x24 '$'
+    { 0x00000000, 0x00000000, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000000 },  // 0x25 '%'
+    { 0x00000000, 0x00000002, 0x00000002, 0x00000004, 0x00000002, 0x00000000, 0x00000004, 0x00000006 },  // 0x26 '&'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x27 '''
+    { 0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000 },  // 0x28 '('
+    { 0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000000 },  // 0x29 ')'
+    { 0x00000000, 0x00000000, 0x00000006, 0x00000004, 0x00000006, 0x00000002, 0x00000006, 0x00000000 },  // 0x2A '*'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000006, 0x00000002, 0x00000000, 0x00000000 },  // 0x2B '+'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000000 },  // 0x2C ','
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000006, 0x00000000, 0x00000000, 0x00000000 },  // 0x2D '-'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001000 },  // 0x2E '.'
+    { 0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000000 },  // 0x2F '/'
+    { 0x00000000, 0x00000006, 0x00000004, 0x00000002, 0x00000000, 0x00000004, 0x00000002, 0x00000006 },  // 0x30 '0'
+    { 0x00000000, 0x00000004, 0x00000004, 0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000000 },  // 0x31 '1'
+    { 0x00000000, 0x00000006, 0x00000000, 0x00000000, 0x00000006, 0x00000000, 0x00000000, 0x00000006 },  // 0x32 '2'
+    { 0x00000000, 0x00000006, 0x00000000, 0x00000000, 0x00000004, 0x00000004, 0x00000000, 0x00000004 },  // 0x33 '3'
+    { 0x00000000, 0x00000004, 0x00000000, 0x00000002, 0x00000006, 0x00000004, 0x00000000, 0x00000000 },  // 0x34 '4'
+    { 0x00000000, 0x00000002, 0x00000000, 0x00000002, 0x00000002, 0x00000000, 0x00000004, 0x00000004 },  // 0x35 '5'
+    { 0x00000000, 0x00000002, 0x00000000, 0x00000002, 0x00000006, 0x00000004, 0x00000000, 0x00000006 },  // 0x36 '6'
+    { 0x00000000, 0x00000006, 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000000 },  // 0x37 '7'
+    { 0x00000000, 0x00000006, 0x00000000, 0x00000002, 0x00000006, 0x00000004, 0x00000000, 0x00000006 },  // 0x38 '8'
+    { 0x00000000, 0x00000006, 0x00000000, 0x00000002, 0x00000006, 0x00000004, 0x00000000, 0x00000004 },  // 0x39 '9'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000002, 0x00000000, 0x00000000 },  // 0x3A ':'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000000, 0x00000002, 0x00000000 },  // 0x3B ';'
+    { 0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000002, 0x00000000, 0x00000004, 0x00000000 },  // 0x3C '<'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000006, 0x00000000, 0x00000000, 0x00000004 },  // 0x3D '='
+    { 0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x00000004, 0x00000000, 0x00000002, 0x00000000 },  // 0x3E '>'
+    { 0x00000000, 0x00000006, 0x00000000, 0x00000000, 0x00000004, 0x00000002, 0x00000000, 0x00001000 },  // 0x3F '?'
+    { 0x00000000, 0x00000006, 0x00000000, 0x00000006, 0x00000004, 0x00000000, 0x00000000, 0x00000006 },  // 0x40 '@'
+    { 0x00000000, 0x00000006, 0x00000000, 0x00000002, 0x00000006, 0x00000004, 0x00000000, 0x00000002 },  // 0x41 'A'
+    { 0x00000000, 0x00000006, 0x00000000, 0x00000004, 0x00000004, 0x00000006, 0x00000000, 0x00000004 },  // 0x42 'B'
+    { 0x00000000, 0x00000002, 0x00000000, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000006 },  // 0x43 'C'
+    { 0x00000000, 0x00000006, 0x00000000, 0x00000004, 0x00000000, 0x00000006, 0x00000000, 0x00000004 },  // 0x44 'D'
+    { 0x00000000, 0x00000002, 0x00000000, 0x00000002, 0x00000002, 0x00000000, 0x00000000, 0x00000006 },  // 0x45 'E'
+    { 0x00000000, 0x00000002, 0x00000000, 0x00000002, 0x00000002, 0x00000000, 0x00000000, 0x00000002 },  // 0x46 'F'
+    { 0x00000000, 0x00000002, 0x00000000, 0x00000002, 0x00000004, 0x00000004, 0x00000000, 0x00000006 },  // 0x47 'G'
+    { 0x00000000, 0x00000004, 0x00000000, 0x00000002, 0x00000006, 0x00000004, 0x00000000, 0x00000002 },  // 0x48 'H'
+    { 0x00000000, 0x00000002, 0x00000000, 0x00000004, 0x00000000, 0x00000002, 0x00000000, 0x00000004 },  // 0x49 'I'
+    { 0x00000000, 0x00000004, 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000006 },  // 0x4A 'J'
+    { 0x00000000, 0x00000000, 0x00000004, 0x00000002, 0x00000002, 0x00000000, 0x00000004, 0x00000002 },  // 0x4B 'K'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000006 },  // 0x4C 'L'
+    { 0x00000000, 0x00000004, 0x00000006, 0x00000002, 0x00000000, 0x00000004, 0x00000000, 0x00000002 },  // 0x4D 'M'
+    { 0x00000000, 0x00000004, 0x00000002, 0x00000002, 0x00000000, 0x00000004, 0x00000004, 0x00000002 },  // 0x4E 'N'
+    { 0x00000000, 0x00000006, 0x00000000, 0x00000002, 0x00000000, 0x00000004, 0x00000000, 0x00000006 },  // 0x4F 'O'
+    { 0x00000000, 0x00000006, 0x00000000, 0x00000002, 0x00000006, 0x00000000, 0x00000000, 0x00000002 },  // 0x50 'P'
+    { 0x00000000, 0x00000006, 0x00000000, 0x00000002, 0x00000000, 0x00000004, 0x00000004, 0x00000006 },  // 0x51 'Q'
+    { 0x00000000, 0x00000006, 0x00000000, 0x00000002, 0x00000006, 0x00000000, 0x00000004, 0x00000002 },  // 0x52 'R'
+    { 0x00000000, 0x00000002, 0x00000000, 0x00000002, 0x00000006, 0x00000004, 0x00000000, 0x00000004 },  // 0x53 'S'
+    { 0x00000000, 0x00000002, 0x00000000, 0x00000004, 0x00000000, 0x00000002, 0x00000000, 0x00000000 },  // 0x54 'T'
+    { 0x00000000, 0x00000004, 0x00000000, 0x00000002, 0x00000000, 0x00000004, 0x00000000, 0x00000006 },  // 0x55 'U'
+    { 0x00000000, 0x00000000, 0x00000004, 0x00000002, 0x00000000, 0x00000000, 0x00000002, 0x00000002 },  // 0x56 'V'
+    { 0x00000000, 0x00000004, 0x00000000, 0x00000002, 0x00000000, 0x00000004, 0x00000006, 0x00000002 },  // 0x57 'W'
+    { 0x00000000, 0x00000000, 0x00000006, 0x00000000, 0x00000000, 0x00000000, 0x00000006, 0x00000000 },  // 0x58 'X'
+    { 0x00000000, 0x00000004, 0x00000000, 0x00000002, 0x00000006, 0x00000004, 0x00000000, 0x00000004 },  // 0x59 'Y'
+    { 0x00000000, 0x00000002, 0x00000004, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000004 },  // 0x5A 'Z'
+    { 0x00000000, 0x00000002, 0x00000000, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000006 },  // 0x5B '['
+    { 0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000 },  // 0x5C
+    { 0x00000000, 0x00000006, 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000004 },  // 0x5D ']'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000006, 0x00000000 },  // 0x5E '^'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000004 },  // 0x5F '_'
+    { 0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x60 '`'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000002, 0x00000000, 0x00000006 },  // 0x61 'a'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000002, 0x00000000, 0x00000004, 0x00000006 },  // 0x62 'b'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000006, 0x00000000, 0x00000000, 0x00000006 },  // 0x63 'c'
+    { 0x00000000, 0x00000004, 0x00000000, 0x00000000, 0x00000004, 0x00000004, 0x00000002, 0x00000004 },  // 0x64 'd'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x00000002, 0x00000006 },  // 0x65 'e'
+    { 0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000006, 0x00000002, 0x00000000, 0x00000000 },  // 0x66 'f'
+    { 0x00000000, 0x00000004, 0x00000004, 0x00000000, 0x00000004, 0x00000004, 0x00000000, 0x00000004 },  // 0x67 'g'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000002, 0x00000002, 0x00000000, 0x00000002 },  // 0x68 'h'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x00000000 },  // 0x69 'i'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000000, 0x00000002, 0x00000002 },  // 0x6A 'j'
+    { 0x00000000, 0x00000000, 0x00000004, 0x00000004, 0x00000000, 0x00000002, 0x00000004, 0x00000000 },  // 0x6B 'k'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000002 },  // 0x6C 'l'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000006, 0x00000006, 0x00000000, 0x00000002 },  // 0x6D 'm'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000002, 0x00000000, 0x00000002 },  // 0x6E 'n'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000006, 0x00000004, 0x00000000, 0x00000006 },  // 0x6F 'o'
+    { 0x00000000, 0x00000000, 0x00000002, 0x00000002, 0x00000002, 0x00000000, 0x00000000, 0x00000002 },  // 0x70 'p'
+    { 0x00000000, 0x00000004, 0x00000004, 0x00000000, 0x00000004, 0x00000004, 0x00000000, 0x00000000 },  // 0x71 'q'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x00000000, 0x00000002 },  // 0x72 'r'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000004, 0x00000004 },  // 0x73 's'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000002, 0x00000000, 0x00000000, 0x00000006 },  // 0x74 't'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000006 },  // 0x75 'u'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000002 },  // 0x76 'v'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000006, 0x00000002 },  // 0x77 'w'
+    { 0x00000000, 0x00000000, 0x00000006, 0x00000000, 0x00000000, 0x00000000, 0x00000006, 0x00000000 },  // 0x78 'x'
+    { 0x00000000, 0x00000004, 0x00000000, 0x00000004, 0x00000004, 0x00000004, 0x00000000, 0x00000004 },  // 0x79 'y'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x00000002, 0x00000004 },  // 0x7A 'z'
+    { 0x00000000, 0x00000002, 0x00000002, 0x00000000, 0x00000002, 0x00000000, 0x00000002, 0x00000004 },  // 0x7B '{'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000002, 0x00000000, 0x00000000 },  // 0x7C '|'
+    { 0x00000000, 0x00000002, 0x00000004, 0x00000000, 0x00000004, 0x00000000, 0x00000004, 0x00000004 },  // 0x7D '}'
+    { 0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000006, 0x00000000, 0x00000002, 0x00000000 },  // 0x7E '~'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 }   // 0x7F
+  },
+  { // P08
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x20
+    { 0x00000080, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000 },  // 0x21 '!'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000000 },  // 0x22 '"'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000000 },  // 0x23 '#'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000040 },  // 0x24 '$'
+    { 0x00000080, 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000000 },  // 0x25 '%'
+    { 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000000 },  // 0x26 '&'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000 },  // 0x27 '''
+    { 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000040 },  // 0x28 '('
+    { 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000040 },  // 0x29 ')'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000040 },  // 0x2A '*'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000000 },  // 0x2B '+'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x2C ','
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000000 },  // 0x2D '-'
+    { 0x00000080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x2E '.'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000000 },  // 0x2F '/'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000040 },  // 0x30 '0'
+    { 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000 },  // 0x31 '1'
+    { 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000040 },  // 0x32 '2'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000040 },  // 0x33 '3'
+    { 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000000 },  // 0x34 '4'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000040 },  // 0x35 '5'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000040 },  // 0x36 '6'
+    { 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000040 },  // 0x37 '7'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040 },  // 0x38 '8'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040 },  // 0x39 '9'
+    { 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000040 },  // 0x3A ':'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000040 },  // 0x3B ';'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000040 },  // 0x3C '<'
+    { 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000000 },  // 0x3D '='
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000040 },  // 0x3E '>'
+    { 0x00000080, 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000040 },  // 0x3F '?'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000040 },  // 0x40 '@'
+    { 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040 },  // 0x41 'A'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000000 },  // 0x42 'B'
+    { 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000040, 0x00000040 },  // 0x43 'C'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000000 },  // 0x44 'D'
+    { 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000040 },  // 0x45 'E'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000040 },  // 0x46 'F'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000000, 0x00000040, 0x00000040 },  // 0x47 'G'
+    { 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000000 },  // 0x48 'H'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000040, 0x00000000 },  // 0x49 'I'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000000, 0x00000000 },  // 0x4A 'J'
+    { 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000040 },  // 0x4B 'K'
+    { 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000040, 0x00000000 },  // 0x4C 'L'
+    { 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000040 },  // 0x4D 'M'
+    { 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000040 },  // 0x4E 'N'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000040 },  // 0x4F 'O'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040 },  // 0x50 'P'
+    { 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040 },  // 0x51 'Q'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000040 },  // 0x52 'R'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000040 },  // 0x53 'S'
+    { 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000000 },  // 0x54 'T'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000000 },  // 0x55 'U'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000000 },  // 0x56 'V'
+    { 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000000 },  // 0x57 'W'
+    { 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000000 },  // 0x58 'X'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000000 },  // 0x59 'Y'
+    { 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000040 },  // 0x5A 'Z'
+    { 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000040, 0x00000040 },  // 0x5B '['
+    { 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000000 },  // 0x5C
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000040 },  // 0x5D ']'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000040 },  // 0x5E '^'
+    { 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x5F '_'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000 },  // 0x60 '`'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000040 },  // 0x61 'a'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000000 },  // 0x62 'b'
+    { 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000000, 0x00000000 },  // 0x63 'c'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000000 },  // 0x64 'd'
+    { 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040 },  // 0x65 'e'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000040 },  // 0x66 'f'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040 },  // 0x67 'g'
+    { 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000000 },  // 0x68 'h'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x69 'i'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x6A 'j'
+    { 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000040 },  // 0x6B 'k'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000040, 0x00000000 },  // 0x6C 'l'
+    { 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x6D 'm'
+    { 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000000, 0x00000000 },  // 0x6E 'n'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000000, 0x00000000 },  // 0x6F 'o'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040 },  // 0x70 'p'
+    { 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040 },  // 0x71 'q'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000000, 0x00000000 },  // 0x72 'r'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000040 },  // 0x73 's'
+    { 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000000 },  // 0x74 't'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x75 'u'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x76 'v'
+    { 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x77 'w'
+    { 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000040, 0x00000000 },  // 0x78 'x'
+    { 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000000 },  // 0x79 'y'
+    { 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000040, 0x00000000, 0x00000040 },  // 0x7A 'z'
+    { 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000000 },  // 0x7B '{'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000040, 0x00000000 },  // 0x7C '|'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000040, 0x00000000, 0x00000040, 0x00000000 },  // 0x7D '}'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000040 },  // 0x7E '~'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 }   // 0x7F
+  },
+  { // P09
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x20
+    { 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00001000, 0x00000020, 0x00000000, 0x00000000 },  // 0x21 '!'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000000 },  // 0x22 '"'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000000 },  // 0x23 '#'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000020 },  // 0x24 '$'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00001020, 0x00000020, 0x00000000, 0x00000000 },  // 0x25 '%'
+    { 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000000 },  // 0x26 '&'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000000 },  // 0x27 '''
+    { 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000020 },  // 0x28 '('
+    { 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000020 },  // 0x29 ')'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000020 },  // 0x2A '*'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000000 },  // 0x2B '+'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x2C ','
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000000 },  // 0x2D '-'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001000, 0x00000000, 0x00000000, 0x00000000 },  // 0x2E '.'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000000 },  // 0x2F '/'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000020 },  // 0x30 '0'
+    { 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000000 },  // 0x31 '1'
+    { 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000020 },  // 0x32 '2'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000020 },  // 0x33 '3'
+    { 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000000 },  // 0x34 '4'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000020 },  // 0x35 '5'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000020 },  // 0x36 '6'
+    { 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000020 },  // 0x37 '7'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020 },  // 0x38 '8'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020 },  // 0x39 '9'
+    { 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000020 },  // 0x3A ':'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000020 },  // 0x3B ';'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000020 },  // 0x3C '<'
+    { 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000000 },  // 0x3D '='
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000020 },  // 0x3E '>'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00001020, 0x00000020, 0x00000000, 0x00000020 },  // 0x3F '?'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000020 },  // 0x40 '@'
+    { 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020 },  // 0x41 'A'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000000 },  // 0x42 'B'
+    { 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000020, 0x00000020 },  // 0x43 'C'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000000 },  // 0x44 'D'
+    { 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000020 },  // 0x45 'E'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000020 },  // 0x46 'F'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000000, 0x00000020, 0x00000020 },  // 0x47 'G'
+    { 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000000 },  // 0x48 'H'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000020, 0x00000000 },  // 0x49 'I'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000000, 0x00000000 },  // 0x4A 'J'
+    { 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000020 },  // 0x4B 'K'
+    { 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000020, 0x00000000 },  // 0x4C 'L'
+    { 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000020 },  // 0x4D 'M'
+    { 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000020 },  // 0x4E 'N'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000020 },  // 0x4F 'O'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020 },  // 0x50 'P'
+    { 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020 },  // 0x51 'Q'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000020 },  // 0x52 'R'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000020 },  // 0x53 'S'
+    { 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000000 },  // 0x54 'T'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000000 },  // 0x55 'U'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000000 },  // 0x56 'V'
+    { 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000000 },  // 0x57 'W'
+    { 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000000 },  // 0x58 'X'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000000 },  // 0x59 'Y'
+    { 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000020 },  // 0x5A 'Z'
+    { 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000020, 0x00000020 },  // 0x5B '['
+    { 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000000 },  // 0x5C
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000020 },  // 0x5D ']'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000020 },  // 0x5E '^'
+    { 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x5F '_'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000000 },  // 0x60 '`'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000020 },  // 0x61 'a'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000000 },  // 0x62 'b'
+    { 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000000, 0x00000000 },  // 0x63 'c'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000000 },  // 0x64 'd'
+    { 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020 },  // 0x65 'e'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000020 },  // 0x66 'f'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020 },  // 0x67 'g'
+    { 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000000 },  // 0x68 'h'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x69 'i'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x6A 'j'
+    { 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000020 },  // 0x6B 'k'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000020, 0x00000000 },  // 0x6C 'l'
+    { 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x6D 'm'
+    { 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000000, 0x00000000 },  // 0x6E 'n'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000000, 0x00000000 },  // 0x6F 'o'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020 },  // 0x70 'p'
+    { 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020 },  // 0x71 'q'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000000, 0x00000000 },  // 0x72 'r'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000020 },  // 0x73 's'
+    { 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000000 },  // 0x74 't'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x75 'u'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x76 'v'
+    { 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x77 'w'
+    { 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000000 },  // 0x78 'x'
+    { 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000000 },  // 0x79 'y'
+    { 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000020, 0x00000000, 0x00000020 },  // 0x7A 'z'
+    { 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000000 },  // 0x7B '{'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000020, 0x00000000 },  // 0x7C '|'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000020, 0x00000000, 0x00000020, 0x00000000 },  // 0x7D '}'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000020 },  // 0x7E '~'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 }   // 0x7F
+  },
+  { // P10
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x20
+    { 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00001000 },  // 0x21 '!'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000000 },  // 0x22 '"'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000000 },  // 0x23 '#'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000010 },  // 0x24 '$'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00001000 },  // 0x25 '%'
+    { 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000000 },  // 0x26 '&'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000000 },  // 0x27 '''
+    { 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000010 },  // 0x28 '('
+    { 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000010 },  // 0x29 ')'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000010 },  // 0x2A '*'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000000 },  // 0x2B '+'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x2C ','
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000000 },  // 0x2D '-'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001000 },  // 0x2E '.'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000000 },  // 0x2F '/'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000010 },  // 0x30 '0'
+    { 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000000 },  // 0x31 '1'
+    { 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000010 },  // 0x32 '2'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000010 },  // 0x33 '3'
+    { 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000000 },  // 0x34 '4'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000010 },  // 0x35 '5'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000010 },  // 0x36 '6'
+    { 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000010 },  // 0x37 '7'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010 },  // 0x38 '8'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010 },  // 0x39 '9'
+    { 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000010 },  // 0x3A ':'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000010 },  // 0x3B ';'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000010 },  // 0x3C '<'
+    { 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000000 },  // 0x3D '='
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000010 },  // 0x3E '>'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00001010 },  // 0x3F '?'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000010 },  // 0x40 '@'
+    { 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010 },  // 0x41 'A'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000000 },  // 0x42 'B'
+    { 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000010, 0x00000010 },  // 0x43 'C'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000000 },  // 0x44 'D'
+    { 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000010 },  // 0x45 'E'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000010 },  // 0x46 'F'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000000, 0x00000010, 0x00000010 },  // 0x47 'G'
+    { 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000000 },  // 0x48 'H'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000010, 0x00000000 },  // 0x49 'I'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000000, 0x00000000 },  // 0x4A 'J'
+    { 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000010 },  // 0x4B 'K'
+    { 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000010, 0x00000000 },  // 0x4C 'L'
+    { 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000010 },  // 0x4D 'M'
+    { 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000010 },  // 0x4E 'N'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000010 },  // 0x4F 'O'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010 },  // 0x50 'P'
+    { 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010 },  // 0x51 'Q'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000010 },  // 0x52 'R'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000010 },  // 0x53 'S'
+    { 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000000 },  // 0x54 'T'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000000 },  // 0x55 'U'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000000 },  // 0x56 'V'
+    { 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000000 },  // 0x57 'W'
+    { 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000000 },  // 0x58 'X'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000000 },  // 0x59 'Y'
+    { 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000010 },  // 0x5A 'Z'
+    { 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000010, 0x00000010 },  // 0x5B '['
+    { 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000000 },  // 0x5C
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000010 },  // 0x5D ']'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000010 },  // 0x5E '^'
+    { 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x5F '_'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000000 },  // 0x60 '`'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000010 },  // 0x61 'a'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000000 },  // 0x62 'b'
+    { 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000000, 0x00000000 },  // 0x63 'c'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000000 },  // 0x64 'd'
+    { 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010 },  // 0x65 'e'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000010 },  // 0x66 'f'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010 },  // 0x67 'g'
+    { 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000000 },  // 0x68 'h'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x69 'i'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x6A 'j'
+    { 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000010 },  // 0x6B 'k'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000010, 0x00000000 },  // 0x6C 'l'
+    { 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x6D 'm'
+    { 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000000, 0x00000000 },  // 0x6E 'n'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000000, 0x00000000 },  // 0x6F 'o'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010 },  // 0x70 'p'
+    { 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010 },  // 0x71 'q'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000000, 0x00000000 },  // 0x72 'r'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000010 },  // 0x73 's'
+    { 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000000 },  // 0x74 't'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x75 'u'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x76 'v'
+    { 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x77 'w'
+    { 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000000 },  // 0x78 'x'
+    { 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000000 },  // 0x79 'y'
+    { 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000010 },  // 0x7A 'z'
+    { 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000000 },  // 0x7B '{'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000010, 0x00000000 },  // 0x7C '|'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000000, 0x00000010, 0x00000000 },  // 0x7D '}'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000010 },  // 0x7E '~'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 }   // 0x7F
+  },
+  { // P11
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x20
+    { 0x00080000, 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000000 },  // 0x21 '!'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000000 },  // 0x22 '"'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000000 },  // 0x23 '#'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000008 },  // 0x24 '$'
+    { 0x00080000, 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000000 },  // 0x25 '%'
+    { 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000000 },  // 0x26 '&'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000000 },  // 0x27 '''
+    { 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000008 },  // 0x28 '('
+    { 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000008 },  // 0x29 ')'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000008 },  // 0x2A '*'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000000 },  // 0x2B '+'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x2C ','
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000000 },  // 0x2D '-'
+    { 0x00080000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x2E '.'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000000 },  // 0x2F '/'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000008 },  // 0x30 '0'
+    { 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000000 },  // 0x31 '1'
+    { 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000008 },  // 0x32 '2'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000008 },  // 0x33 '3'
+    { 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000000 },  // 0x34 '4'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000008 },  // 0x35 '5'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000008 },  // 0x36 '6'
+    { 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000008 },  // 0x37 '7'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008 },  // 0x38 '8'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008 },  // 0x39 '9'
+    { 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000008 },  // 0x3A ':'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000008 },  // 0x3B ';'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000008 },  // 0x3C '<'
+    { 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000000 },  // 0x3D '='
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000008 },  // 0x3E '>'
+    { 0x00080000, 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000008 },  // 0x3F '?'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000008 },  // 0x40 '@'
+    { 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008 },  // 0x41 'A'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000000 },  // 0x42 'B'
+    { 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000008, 0x00000008 },  // 0x43 'C'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000000 },  // 0x44 'D'
+    { 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000008 },  // 0x45 'E'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000008 },  // 0x46 'F'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000000, 0x00000008, 0x00000008 },  // 0x47 'G'
+    { 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000000 },  // 0x48 'H'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000008, 0x00000000 },  // 0x49 'I'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000000, 0x00000000 },  // 0x4A 'J'
+    { 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000008 },  // 0x4B 'K'
+    { 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000008, 0x00000000 },  // 0x4C 'L'
+    { 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000008 },  // 0x4D 'M'
+    { 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000008 },  // 0x4E 'N'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000008 },  // 0x4F 'O'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008 },  // 0x50 'P'
+    { 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008 },  // 0x51 'Q'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000008 },  // 0x52 'R'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000008 },  // 0x53 'S'
+    { 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000000 },  // 0x54 'T'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000000 },  // 0x55 'U'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000000 },  // 0x56 'V'
+    { 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000000 },  // 0x57 'W'
+    { 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000000 },  // 0x58 'X'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000000 },  // 0x59 'Y'
+    { 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000008 },  // 0x5A 'Z'
+    { 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000008, 0x00000008 },  // 0x5B '['
+    { 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000000 },  // 0x5C
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000008 },  // 0x5D ']'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000008 },  // 0x5E '^'
+    { 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x5F '_'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000000 },  // 0x60 '`'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000008 },  // 0x61 'a'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000000 },  // 0x62 'b'
+    { 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000000, 0x00000000 },  // 0x63 'c'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000000 },  // 0x64 'd'
+    { 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008 },  // 0x65 'e'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000008 },  // 0x66 'f'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008 },  // 0x67 'g'
+    { 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000000 },  // 0x68 'h'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x69 'i'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x6A 'j'
+    { 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000008 },  // 0x6B 'k'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000008, 0x00000000 },  // 0x6C 'l'
+    { 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x6D 'm'
+    { 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000000, 0x00000000 },  // 0x6E 'n'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000000, 0x00000000 },  // 0x6F 'o'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008 },  // 0x70 'p'
+    { 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008 },  // 0x71 'q'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000000, 0x00000000 },  // 0x72 'r'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000008 },  // 0x73 's'
+    { 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000000 },  // 0x74 't'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x75 'u'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x76 'v'
+    { 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 0x77 'w'
+    { 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000000 },  // 0x78 'x'
+    { 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000000 },  // 0x79 'y'
+    { 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000008, 0x00000000, 0x00000008 },  // 0x7A 'z'
+    { 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000000 },  // 0x7B '{'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000008, 0x00000000 },  // 0x7C '|'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x00000000, 0x00000008, 0x00000000 },  // 0x7D '}'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000008 },  // 0x7E '~'
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 }   // 0x7F
+  }
+};
+
+/**
+ * @brief   Bits used by the masks in the low and high registers
+ */
+#define LCDMASKS_LOBITS 0xF00FF000UL
+#define LCDMASKS_HIBITS 0x000000FFUL
+
+#endif // LCDMASKS_H
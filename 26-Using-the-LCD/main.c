@@ -66,6 +66,10 @@ char *n = numstring;
     LCD_ClearAll();
     Delay(DELAYVAL);
 
+    /* A segment turning in the ring, done by the LCD controller */
+    LCD_SetAnimationRate(16);
+    LCD_StartRingAnimation(0x01,0x00,LCD_ANIM_LEFT_A);
+
     /* Blink loop */
     while (1) {
 
@@ -0,0 +1,89 @@
+/**
+ * @file    lcdbench.c
+ * @brief   Host benchmark of LCD_WriteChar with and without the mask tables
+ * @version 1.0
+ *
+ * @note    Like lcdgen.c, it includes lcd.c compiled with LCD_EMULATION. It is built
+ *          twice (or use make maskbench):
+ *              gcc -O2 -o lcdbench-table tools/lcdbench.c
+ *              gcc -O2 -DLCD_NO_MASK_TABLE -o lcdbench-bits tools/lcdbench.c
+ *
+ * @note    Each round writes all 96 characters in all positions 1 to 11 (the ones
+ *          covered by lcdmasks.h), with auto commit and only into the shadow. The
+ *          checksum of the emulated registers after each write must be the same for both
+ *          versions.
+ */
+
+#define LCD_EMULATION
+
+#include <stdio.h>
+#include <time.h>
+
+#include "../lcd.c"
+
+#define POSITIONS   11
+#define CHARS       96
+#define ROUNDS      10000
+
+volatile uint32_t sink;
+
+#ifdef LCD_NO_MASK_TABLE
+#define METHOD      "bit by bit (LCD_NO_MASK_TABLE)"
+#else
+#define METHOD      "mask table"
+#endif
+
+static double Now(void) {
+struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC,&ts);
+    return ts.tv_sec*1e9+ts.tv_nsec;
+}
+
+/**
+ * @brief   Sum of the emulated segment registers
+ */
+static uint32_t Checksum(void) {
+uint32_t sum = 0;
+int comn;
+
+    for(comn=0;comn<8;comn++)
+        sum = sum*31+lcd[comn].lo*7+lcd[comn].hi;
+    return sum;
+}
+
+int main(void) {
+uint32_t check = 0;
+double start,ns[2];
+int pos,c,r,a;
+
+    LCD_Init();
+    LCD_ClearAll();
+
+    // Reference checksum (one round)
+    for(pos=1;pos<=POSITIONS;pos++) {
+        for(c=' ';c<' '+CHARS;c++) {
+            LCD_WriteChar(c,pos);
+            check = check*17+Checksum();
+        }
+    }
+
+    for(a=1;a>=0;a--) {
+        LCD_SetAutoCommit(a);
+        start = Now();
+        for(r=0;r<ROUNDS;r++) {
+            for(pos=1;pos<=POSITIONS;pos++) {
+                for(c=' ';c<' '+CHARS;c++)
+                    LCD_WriteChar(c,pos);
+            }
+        }
+        ns[a] = (Now()-start)/((double) ROUNDS*POSITIONS*CHARS);
+        LCD_Commit();
+        sink = Checksum();                      // registers are used after the loop
+    }
+
+    printf("%-32s %6.1f ns/char (%.1f ns without commit)  checksum %08lX\n",
+                METHOD,ns[1],ns[0],(unsigned long) check);
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+/**
+ * @file    lcdgen.c
+ * @brief   Host program to generate the segment mask tables used by lcd.c
+ * @version 1.0
+ *
+ * @note    It includes lcd.c compiled with LCD_EMULATION, so the masks are generated
+ *          from the same tables used by the two step encoding. For each position and
+ *          character, the character is written into an empty display and the emulated
+ *          segment registers are read back.
+ *
+ * @note    Build and run it on the host (or use make masks):
+ *              gcc -o lcdgen tools/lcdgen.c
+ *              ./lcdgen > lcdmasks.h
+ *
+ * @note    Controller segments 12-19 and 28-31 are in the low register and 32-39 in
+ *          bits 0-7 of the high register. Since bits 0-7 of the low register are not
+ *          used, both are packed in one word: lo = mask&~0xFF and hi = mask&0xFF.
+ */
+
+#define LCD_EMULATION
+#define LCD_NO_MASK_TABLE
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../lcd.c"
+
+#define POSITIONS   11
+#define CHARS       96
+
+// Bits used by all masks in the low and high registers
+static uint32_t lobits = 0;
+static uint32_t hibits = 0;
+
+/**
+ * @brief   Pack low and high register masks in one word
+ *
+ * @note    Stops if the masks use bits that cannot be packed
+ */
+static uint32_t Pack(uint32_t lo, uint32_t hi) {
+
+    if( (lo&0xFF) != 0 || (hi&~0xFFUL) != 0 ) {
+        fprintf(stderr,"lcdgen: cannot pack lo=%08lX hi=%08lX\n",
+                        (unsigned long) lo, (unsigned long) hi);
+        exit(1);
+    }
+    lobits |= lo;
+    hibits |= hi;
+    return lo|hi;
+}
+
+int main(void) {
+int pos,c,comn;
+SegEncoding_t clr;
+
+    LCD_Init();
+
+    printf("/**\n");
+    printf(" * @file    lcdmasks.h\n");
+    printf(" * @brief   Segment masks for positions 1 to 11\n");
+    printf(" *\n");
+    printf(" * @note    Generated by tools/lcdgen.c. Do not edit\n");
+    printf(" * @note    Indexed by position-1, character-' ' and controller common number\n");
+    printf(" * @note    Low register mask is mask&~0xFF, high register mask is mask&0xFF\n");
+    printf(" */\n");
+    printf("#ifndef LCDMASKS_H\n");
+    printf("#define LCDMASKS_H\n\n");
+
+    printf("/**\n");
+    printf(" * @brief   Bits to be cleared before writing a character at a position\n");
+    printf(" */\n");
+    printf("static const uint32_t lcdclearmask[%d][8] = {\n",POSITIONS);
+    for(pos=1;pos<=POSITIONS;pos++) {
+        printf("    {");
+        for(comn=0;comn<8;comn++) {
+            clr = tablcdclear[pos][com_encoding[comn]];
+            printf(" 0x%08lX%s",(unsigned long) Pack(clr.lo,clr.hi),comn<7?",":" ");
+        }
+        printf("}%s  // P%02d\n",pos<POSITIONS?",":" ",pos);
+    }
+    printf("};\n\n");
+
+    printf("/**\n");
+    printf(" * @brief   Bits to be set to show a character at a position\n");
+    printf(" */\n");
+    printf("static const uint32_t lcdcharmask[%d][%d][8] = {\n",POSITIONS,CHARS);
+    for(pos=1;pos<=POSITIONS;pos++) {
+        printf("  { // P%02d\n",pos);
+        for(c=' ';c<' '+CHARS;c++) {
+            LCD_ClearAll();
+            LCD_WriteChar(c,pos);
+            printf("    {");
+            for(comn=0;comn<8;comn++) {
+                printf(" 0x%08lX%s",(unsigned long) Pack(lcd[comn].lo,lcd[comn].hi),
+                                    comn<7?",":" ");
+            }
+            printf("}%s  // 0x%02X",c<' '+CHARS-1?",":" ",c);
+            if( c > ' ' && c < 0x7F && c != '\\' )  // backslash would continue comment
+                printf(" '%c'",c);
+            printf("\n");
+        }
+        printf("  }%s\n",pos<POSITIONS?",":"");
+    }
+    printf("};\n\n");
+
+    printf("/**\n");
+    printf(" * @brief   Bits used by the masks in the low and high registers\n");
+    printf(" */\n");
+    printf("#define LCDMASKS_LOBITS 0x%08lXUL\n",(unsigned long) lobits);
+    printf("#define LCDMASKS_HIBITS 0x%08lXUL\n\n",(unsigned long) hibits);
+
+    printf("#endif // LCDMASKS_H\n");
+
+    return 0;
+}
@@ -0,0 +1,214 @@
+/**
+ * @file    multiquad.c
+ * @brief   HAL for up to 8 position encoders with quadrature outputs
+ *
+ * @version 1.0
+ *
+ * @note   All A and B inputs must be on the same GPIO port. All encoders are
+ *         sampled with one read of the port and processed in one call.
+ *
+ * @note   Debouncing uses vertical counters, i.e., a 2-bit counter per pin
+ *         stored in two words (ct0 and ct1). A pin is considered changed after
+ *         4 consecutive identical readings that differ from the debounced
+ *         value. All pins are debounced in parallel with a few logical
+ *         operations, independent of the number of encoders.
+ *
+ * @note   Decoding uses a 16 entry table indexed by the previous and the
+ *         current AB values. Illegal transitions (both signals changed at
+ *         the same time) do not change the position but are counted as errors.
+ *
+ * @note   Must be called at constant intervals, that must be much less than the
+ *         input period. Only the encoders whose inputs have changed are
+ *         processed.
+ */
+
+
+#include  <stdint.h>
+
+#include "em_device.h"
+
+#include "gpio.h"
+#include "multiquad.h"
+
+/**
+ * @brief   Transition table
+ *
+ * @note    Index is (previous AB)<<2 | (current AB), where A is bit 1 and B bit 0.
+ *          Sequence 00 -> 01 -> 11 -> 10 -> 00 counts up (same as quadrature.c)
+ */
+static const int8_t transitiontable[16] = {
+/*            to 00   01   10   11  */
+/* from 00 */     0,  +1,  -1,   0,
+/* from 01 */    -1,   0,   0,  +1,
+/* from 10 */    +1,   0,   0,  -1,
+/* from 11 */     0,  -1,  +1,   0
+};
+
+/**
+ * @brief   Illegal transitions (00<->11 and 01<->10) as a bit mask of table indexes
+ */
+#define ILLEGALTRANSITIONS  ((1U<<3)|(1U<<6)|(1U<<9)|(1U<<12))
+
+/**
+ * @brief   Information about each encoder
+ */
+typedef struct {
+    uint32_t    mask;                               /**< mask for A and B     */
+    uint8_t     pina;                               /**< pin position for A   */
+    uint8_t     pinb;                               /**< pin position for B   */
+    uint8_t     ab;                                 /**< last AB value        */
+    int         counter;                            /**< position counter     */
+    uint32_t    errors;                             /**< illegal transitions  */
+} EncoderInfo;
+
+/**
+ * @brief   static variables
+ */
+///@{
+static GPIO_t       qgpio = 0;                      /**< GPIO port            */
+static uint32_t     qmask = 0;                      /**< all used pins        */
+static uint32_t     qnow  = 0;                      /**< debounced input      */
+static uint32_t     ct0   = ~0U;                    /**< vertical counter b0  */
+static uint32_t     ct1   = ~0U;                    /**< vertical counter b1  */
+static int          qn    = 0;                      /**< number of encoders   */
+static EncoderInfo  encoders[MULTIQUAD_MAX];
+///@}
+
+/**
+ * @brief   Extract AB value of encoder from the port value
+ */
+static inline uint32_t GetAB(const EncoderInfo *e, uint32_t v) {
+
+    return (((v>>e->pina)&1)<<1)|((v>>e->pinb)&1);
+}
+
+/**
+ * @brief   Initialize the decoder
+ *
+ * @param   gpio:   GPIO port where all encoders are connected
+ * @param   pins:   array with the pin positions of A and B of each encoder
+ * @param   n:      number of encoders (up to MULTIQUAD_MAX)
+ *
+ * @return  0 if OK, -1 if parameters are invalid
+ */
+int MultiQuad_Init(GPIO_t gpio, const MultiQuad_PinsType *pins, int n) {
+
+    if( n <= 0 || n > MULTIQUAD_MAX )
+        return -1;
+
+    qmask = 0;
+    for(int i=0;i<n;i++) {
+        if( pins[i].pina > 15 || pins[i].pinb > 15 || pins[i].pina == pins[i].pinb )
+            return -1;
+        encoders[i].pina    = pins[i].pina;
+        encoders[i].pinb    = pins[i].pinb;
+        encoders[i].mask    = (1U<<pins[i].pina)|(1U<<pins[i].pinb);
+        encoders[i].counter = 0;
+        encoders[i].errors  = 0;
+        qmask |= encoders[i].mask;
+    }
+    qgpio = gpio;
+    qn    = n;
+
+    GPIO_Init(qgpio,qmask,0);
+// Pullup for quadrature inputs
+    GPIO_ConfigPins(qgpio,qmask,GPIO_MODE_INPUTPULLFILTER);
+    GPIO_WritePins(qgpio,0,qmask);
+
+// Start with current input as debounced value
+    qnow = GPIO_ReadPins(qgpio)&qmask;
+    ct0  = ~0U;
+    ct1  = ~0U;
+    for(int i=0;i<n;i++) {
+        encoders[i].ab = GetAB(&encoders[i],qnow);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief   Decoding process for all encoders
+ *
+ * @note    Must be called at constant intervals, that must be much less than the
+ *          input period
+ */
+void MultiQuad_Process(void) {
+uint32_t changed;
+
+    if( qn == 0 )
+        return;
+
+    changed = (GPIO_ReadPins(qgpio)&qmask)^qnow;
+
+    // Vertical counter: counts down while input differs, reset when equal
+    ct0 = ~(ct0&changed);
+    ct1 = ct0^(ct1&changed);
+    changed &= ct0&ct1;          // set when counter rolls over (4 samples)
+
+    if( changed == 0 )
+        return;
+
+    qnow ^= changed;
+
+    for(int i=0;i<qn;i++) {
+        EncoderInfo *e = &encoders[i];
+        if( (changed&e->mask) == 0 )
+            continue;
+        uint32_t ab  = GetAB(e,qnow);
+        uint32_t idx = (e->ab<<2)|ab;
+        if( (ILLEGALTRANSITIONS>>idx)&1 ) {
+            e->errors++;
+        } else {
+            e->counter += transitiontable[idx];
+        }
+        e->ab = ab;
+    }
+}
+
+/**
+ * @brief   Return position of encoder
+ */
+int MultiQuad_GetPosition(int enc) {
+
+    if( enc < 0 || enc >= qn )
+        return 0;
+    return encoders[enc].counter;
+}
+
+/**
+ * @brief   Set position of encoder
+ */
+void MultiQuad_Load(int enc, int v) {
+
+    if( enc < 0 || enc >= qn )
+        return;
+    encoders[enc].counter = v;
+}
+
+/**
+ * @brief   Set position of encoder to zero
+ */
+void MultiQuad_Reset(int enc) {
+
+    MultiQuad_Load(enc,0);
+}
+
+/**
+ * @brief   Return number of illegal transitions detected for encoder
+ */
+uint32_t MultiQuad_GetErrors(int enc) {
+
+    if( enc < 0 || enc >= qn )
+        return 0;
+    return encoders[enc].errors;
+}
+
+/**
+ * @brief   Clear number of illegal transitions detected for encoder
+ */
+void MultiQuad_ClearErrors(int enc) {
+
+    if( enc < 0 || enc >= qn )
+        return;
+    encoders[enc].errors = 0;
+}
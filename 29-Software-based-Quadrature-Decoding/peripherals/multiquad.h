@@ -0,0 +1,32 @@
+#ifndef MULTIQUAD_H
+/** ***************************************************************************
+ * @file    multiquad.h
+ * @brief   HAL for many quadrature encoders on the same GPIO port
+ * @version 1.0
+******************************************************************************/
+#define MULTIQUAD_H
+#include <stdint.h>
+#include "gpio.h"
+
+/**
+ * @brief   Maximal number of encoders decoded in one call
+ */
+#define MULTIQUAD_MAX   8
+
+/**
+ * @brief   Pins (position in port) of the A and B signals of one encoder
+ */
+typedef struct {
+    uint8_t     pina;
+    uint8_t     pinb;
+} MultiQuad_PinsType;
+
+int         MultiQuad_Init(GPIO_t gpio, const MultiQuad_PinsType *pins, int n);
+void        MultiQuad_Process(void);
+int         MultiQuad_GetPosition(int enc);
+void        MultiQuad_Load(int enc, int v);
+void        MultiQuad_Reset(int enc);
+uint32_t    MultiQuad_GetErrors(int enc);
+void        MultiQuad_ClearErrors(int enc);
+
+#endif // MULTIQUAD_H
@@ -12,6 +12,11 @@
  *
  * @note   It uses a debouncing algorithm. At start, it needs N cycles to stabilize.
  *
+ * @note   A third implementation (USING_A_B_INTERRUPTS) decodes A and B at each
+ *         edge. The edges are timestamped by the input capture unit of a
+ *         free running TIMER, so Quadrature_Process is only needed to update
+ *         the velocity and acceleration estimates (M/T method).
+ *
  */
 
 
@@ -26,10 +31,12 @@
 
 #define USING_PULSE_DIR_SIGNALS
 //#define USING_A_B_SIGNALS
+//#define USING_A_B_INTERRUPTS
 
 
 // Default
-#if !defined(USING_A_B_SIGNALS) && !defined(USING_PULSE_DIR_SIGNALS)
+#if !defined(USING_A_B_SIGNALS) && !defined(USING_PULSE_DIR_SIGNALS) && \
+    !defined(USING_A_B_INTERRUPTS)
 #define USING_A_B_SIGNALS
 #endif
 
@@ -64,14 +71,20 @@
  * @brief   static variables
  */
 ///@{
-static int      qcounter = 0;                       /**< position counter   */
+static volatile int qcounter = 0;                   /**< position counter   */
 static uint32_t qnow = 0;                           /**@< debounced input   */
+#ifndef USING_A_B_INTERRUPTS
 static uint32_t qlast[QUADRATURE_DEBOUNCE_N];       /**@< circular buffer   */
 static int      qi = 0;                             /**@< buffer pointer    */
+#endif
 ///@}
 
 
 
+#ifdef USING_A_B_INTERRUPTS
+static void InitCapture(void);
+#endif
+
 // These routines are identical for each deboding method
 
 void Quadrature_Init(void) {
@@ -85,6 +98,9 @@ void Quadrature_Init(void) {
     GPIO_ConfigPins(QUADRATURE_GPIO,QUADRATURE_M,GPIO_MODE_INPUTPULLFILTER);
     GPIO_WritePins(QUADRATURE_GPIO,0,QUADRATURE_M);
 
+#ifdef USING_A_B_INTERRUPTS
+    InitCapture();
+#endif
 }
 
 int Quadrature_GetPosition(void) {
@@ -246,3 +262,311 @@ uint32_t qread;
 }
 #endif
 
+
+#ifdef USING_A_B_INTERRUPTS
+/*
+ *  Configuration for A and B decoding by interrupts
+ *
+ *  TIMER1 runs free and its capture channels are routed to the encoder
+ *  pins (Location 4: CC0=PD6=B, CC1=PD7=A). Both edges are captured, so
+ *  each transition generates an interrupt with a precise timestamp.
+ *  The 16 bit counter is extended to 32 bits by counting overflows.
+ */
+#define QUADRATURE_TIMER        TIMER1
+#define QUADRATURE_TIMER_IRQn   TIMER1_IRQn
+#define QUADRATURE_CLOCKEN      CMU_HFPERCLKEN0_TIMER1
+#define QUADRATURE_LOC          4
+#define QUADRATURE_CC_A         1
+#define QUADRATURE_CC_B         0
+#define QUADRATURE_PRESC        TIMER_CTRL_PRESC_DIV16
+#define QUADRATURE_PRESC_DIV    16
+#define QUADRATURE_INT_LEVEL    2
+
+#define QUADRATURE_PIN_A        QUADRATURE_PIN0
+#define QUADRATURE_PIN_B        QUADRATURE_PIN1
+
+/**
+ * @brief   Transition table
+ *
+ * @note    Index is (previous AB)<<2 | (current AB), where A is bit 1 and B bit 0.
+ *          Sequence 00 -> 01 -> 11 -> 10 -> 00 counts up. Illegal transitions
+ *          (both signals changed) are marked with 2.
+ */
+static const int8_t transitiontable[16] = {
+/*            to 00   01   10   11  */
+/* from 00 */     0,  +1,  -1,   2,
+/* from 01 */    -1,   0,   2,  +1,
+/* from 10 */    +1,   2,   0,  -1,
+/* from 11 */     2,  -1,  +1,   0
+};
+
+/**
+ * @brief   If no edge is detected during this interval, the speed is zero
+ *
+ * @note    In timer ticks (3 MHz with 48 MHz clock): 0,5 s
+ */
+#define QUADRATURE_STOPPED_TICKS    (qtimerfreq/2)
+
+/**
+ * @brief   Variables updated by the interrupt routine
+ */
+///@{
+static volatile uint32_t    qovf        = 0;    /**< timer overflows          */
+static volatile uint32_t    qab         = 0;    /**< last AB value            */
+static volatile uint32_t    qedgetime   = 0;    /**< timestamp of last edge   */
+static volatile uint32_t    qerrors     = 0;    /**< illegal transitions      */
+///@}
+
+/**
+ * @brief   Variables used by the estimator
+ */
+///@{
+static uint32_t     qtimerfreq  = 0;            /**< timer frequency          */
+static int          qpos0       = 0;            /**< position at last sample  */
+static uint32_t     qedge0      = 0;            /**< last edge at last sample */
+static uint32_t     qtime0      = 0;            /**< time of last sample      */
+static int          qvelocity   = 0;            /**< counts per second        */
+static int          qaccel      = 0;            /**< counts per second^2      */
+///@}
+
+/**
+ * @brief   Read AB from GPIO
+ */
+static inline uint32_t ReadAB(void) {
+uint32_t v = GPIO_ReadPins(QUADRATURE_GPIO);
+
+    return (((v>>QUADRATURE_PIN_A)&1)<<1)|((v>>QUADRATURE_PIN_B)&1);
+}
+
+/**
+ * @brief   Update counter with a transition
+ */
+static inline void Decode(uint32_t ab) {
+int d = transitiontable[(qab<<2)|ab];
+
+    if( d == 2 ) {
+        qerrors++;
+    } else {
+        qcounter += d;
+    }
+    qab = ab;
+}
+
+/**
+ * @brief   Get 32 bit timestamp of a capture
+ *
+ * @note    If an overflow is pending and the captured value is in the lower
+ *          half, the capture happened after the overflow.
+ */
+static inline uint32_t Timestamp(uint32_t ccv, uint32_t ovf, uint32_t flags) {
+
+    if( (flags&TIMER_IF_OF) && (ccv < 0x8000) )
+        ovf++;
+    return (ovf<<16)|ccv;
+}
+
+/**
+ * @brief   Current 32 bit time
+ */
+static uint32_t GetTime(void) {
+uint32_t ovf,cnt;
+
+    __disable_irq();
+    ovf = qovf;
+    cnt = QUADRATURE_TIMER->CNT;
+    if( (QUADRATURE_TIMER->IF&TIMER_IF_OF) && (cnt < 0x8000) )
+        ovf++;
+    __enable_irq();
+    return (ovf<<16)|cnt;
+}
+
+/**
+ * @brief   TIMER interrupt handler
+ *
+ * @note    When both channels were captured, the edges are processed in the
+ *          order of their timestamps, so the direction is not lost.
+ */
+void TIMER1_IRQHandler(void) {
+uint32_t flags;
+uint32_t ta = 0, tb = 0;
+uint32_t ab;
+
+    flags = QUADRATURE_TIMER->IF;
+    QUADRATURE_TIMER->IFC = flags;
+
+    if( flags&(TIMER_IF_ICBOF0|TIMER_IF_ICBOF1) )
+        qerrors++;
+
+    if( flags&(TIMER_IF_CC0<<QUADRATURE_CC_A) )
+        ta = Timestamp(QUADRATURE_TIMER->CC[QUADRATURE_CC_A].CCV,qovf,flags);
+    if( flags&(TIMER_IF_CC0<<QUADRATURE_CC_B) )
+        tb = Timestamp(QUADRATURE_TIMER->CC[QUADRATURE_CC_B].CCV,qovf,flags);
+
+    if( flags&TIMER_IF_OF )
+        qovf++;
+
+    ab = ReadAB();
+    if( (flags&(TIMER_IF_CC0<<QUADRATURE_CC_A))
+     && (flags&(TIMER_IF_CC0<<QUADRATURE_CC_B)) ) {
+        // Two edges: process first the older one
+        if( (int32_t) (ta-tb) < 0 ) {
+            Decode(qab^2);
+            qedgetime = tb;
+        } else {
+            Decode(qab^1);
+            qedgetime = ta;
+        }
+        Decode(ab);
+    } else if( flags&(TIMER_IF_CC0<<QUADRATURE_CC_A) ) {
+        Decode(ab);
+        qedgetime = ta;
+    } else if( flags&(TIMER_IF_CC0<<QUADRATURE_CC_B) ) {
+        Decode(ab);
+        qedgetime = tb;
+    }
+}
+
+/**
+ * @brief   Configure TIMER for capture of both edges on A and B
+ */
+static void InitCapture(void) {
+
+    CMU->HFPERCLKEN0 |= QUADRATURE_CLOCKEN;             // Enable HFPERCLK for TIMERx
+
+    qtimerfreq = SystemCoreClock/QUADRATURE_PRESC_DIV;
+
+    QUADRATURE_TIMER->CMD = TIMER_CMD_STOP;
+
+    // Free running up counter
+    QUADRATURE_TIMER->CTRL  = (QUADRATURE_TIMER->CTRL
+                                    &~(_TIMER_CTRL_MODE_MASK
+                                      |_TIMER_CTRL_CLKSEL_MASK
+                                      |_TIMER_CTRL_PRESC_MASK))
+                              |TIMER_CTRL_MODE_UP
+                              |TIMER_CTRL_CLKSEL_PRESCHFPERCLK
+                              |QUADRATURE_PRESC;
+    QUADRATURE_TIMER->TOP = 0xFFFF;
+    QUADRATURE_TIMER->CNT = 0;
+
+    // Capture on both edges with filter
+    QUADRATURE_TIMER->CC[QUADRATURE_CC_A].CTRL = TIMER_CC_CTRL_MODE_INPUTCAPTURE
+                                                |TIMER_CC_CTRL_ICEDGE_BOTH
+                                                |TIMER_CC_CTRL_ICEVCTRL_EVERYEDGE
+                                                |TIMER_CC_CTRL_FILT;
+    QUADRATURE_TIMER->CC[QUADRATURE_CC_B].CTRL = TIMER_CC_CTRL_MODE_INPUTCAPTURE
+                                                |TIMER_CC_CTRL_ICEDGE_BOTH
+                                                |TIMER_CC_CTRL_ICEVCTRL_EVERYEDGE
+                                                |TIMER_CC_CTRL_FILT;
+
+    // Configure pins
+    QUADRATURE_TIMER->ROUTE = (QUADRATURE_TIMER->ROUTE
+                                &~(_TIMER_ROUTE_LOCATION_MASK
+                                    |_TIMER_ROUTE_CC0PEN_MASK
+                                    |_TIMER_ROUTE_CC1PEN_MASK))
+                             |(QUADRATURE_LOC<<_TIMER_ROUTE_LOCATION_SHIFT)
+                             |TIMER_ROUTE_CC0PEN
+                             |TIMER_ROUTE_CC1PEN;
+
+    // Initial state
+    qab       = ReadAB();
+    qovf      = 0;
+    qedgetime = 0;
+    qerrors   = 0;
+    qedge0    = 0;
+    qtime0    = 0;
+    qpos0     = qcounter;
+    qvelocity = 0;
+    qaccel    = 0;
+
+    // Enable interrupts
+    QUADRATURE_TIMER->IFC = _TIMER_IFC_MASK;
+    QUADRATURE_TIMER->IEN = TIMER_IEN_OF|TIMER_IEN_CC0|TIMER_IEN_CC1
+                           |TIMER_IEN_ICBOF0|TIMER_IEN_ICBOF1;
+    NVIC_SetPriority(QUADRATURE_TIMER_IRQn,QUADRATURE_INT_LEVEL);
+    NVIC_ClearPendingIRQ(QUADRATURE_TIMER_IRQn);
+    NVIC_EnableIRQ(QUADRATURE_TIMER_IRQn);
+
+    // Start timer
+    QUADRATURE_TIMER->CMD = TIMER_CMD_START;
+}
+
+/**
+ * @brief   Velocity and acceleration estimation (M/T method)
+ *
+ * @note    Must be called at constant intervals. The position change M is
+ *          divided by the time T between the last edges of this and of the
+ *          previous interval, measured by the TIMER. So the result is exact
+ *          at high speed (many edges per interval) and at low speed (few edges).
+ *
+ * @note    When there is no edge in the interval, the velocity can not be
+ *          greater than one count divided by the time since the last edge.
+ */
+void Quadrature_Process(void) {
+int      pos;
+uint32_t edge;
+uint32_t now;
+int      v;
+
+    __disable_irq();
+    pos  = qcounter;
+    edge = qedgetime;
+    __enable_irq();
+    now = GetTime();
+
+    // Button is filtered by hardware
+    qnow = GPIO_ReadPins(QUADRATURE_GPIO);
+
+    if( pos != qpos0 && edge != qedge0 ) {
+        v = (int) (((int64_t) (pos-qpos0)*qtimerfreq)/(uint32_t) (edge-qedge0));
+        qpos0  = pos;
+        qedge0 = edge;
+    } else {
+        uint32_t elapsed = now-qedge0;
+        if( elapsed > QUADRATURE_STOPPED_TICKS ) {
+            v = 0;
+        } else {
+            int vmax;
+            // Edge in the same timer tick (or counter not advanced)
+            if( elapsed == 0 )
+                elapsed = 1;
+            vmax = (int) (qtimerfreq/elapsed);
+            v = qvelocity;
+            if( v > vmax )
+                v = vmax;
+            else if( v < -vmax )
+                v = -vmax;
+        }
+    }
+
+    if( now != qtime0 ) {
+        qaccel = (int) (((int64_t) (v-qvelocity)*qtimerfreq)/(uint32_t) (now-qtime0));
+    }
+    qvelocity = v;
+    qtime0    = now;
+}
+
+/**
+ * @brief   Return velocity in counts per second
+ */
+int Quadrature_GetVelocity(void) {
+
+    return qvelocity;
+}
+
+/**
+ * @brief   Return acceleration in counts per second^2
+ */
+int Quadrature_GetAcceleration(void) {
+
+    return qaccel;
+}
+
+/**
+ * @brief   Return the number of illegal transitions and capture overflows
+ */
+uint32_t Quadrature_GetErrors(void) {
+
+    return qerrors;
+}
+
+#endif
@@ -14,4 +14,9 @@ void    Quadrature_Reset(void);
 void    Quadrature_Load(int v);
 void    Quadrature_Process(void);
 
+// Only when using interrupts (USING_A_B_INTERRUPTS)
+int         Quadrature_GetVelocity(void);
+int         Quadrature_GetAcceleration(void);
+uint32_t    Quadrature_GetErrors(void);
+
 #endif // LCD_H
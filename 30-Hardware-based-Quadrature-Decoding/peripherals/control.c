@@ -0,0 +1,374 @@
+/**
+ * @file    control.c
+ * @brief   Fixed-point PID control loops run by a timer interrupt
+ *
+ * @version 1.0
+ *
+ * @note   All loops run in the overflow interrupt of a dedicated TIMER, so the
+ *         sampling rate is defined by hardware and does not depend on the main loop
+ *         or on SysTick. Each loop reads its measurement by a source callback
+ *         (e.g. encoder or ADC) and writes the output by a sink callback (e.g. PWM).
+ *
+ * @note   Signals are integers (e.g. Q15) and gains are Q15. Products are calculated
+ *         with 64 bits, so there is no loss of resolution. The integral term is kept
+ *         with 15 additional fractional bits, so small errors are integrated.
+ *
+ *              u = kp*e + I + D + kff*setpoint + ff
+ *              I = I + ki*e                    (not when the output is saturated)
+ *              D = D + dfilter*(-kd*(y-y[n-1]) - D)
+ *
+ * @note   Anti-windup uses conditional integration: the error is not integrated when
+ *         the output is saturated in the direction of the error. The integral term is
+ *         also limited to the output range.
+ *
+ * @note   The derivative is calculated on the measurement, so setpoint steps do not
+ *         cause output spikes.
+ *
+ * @note   The number of core cycles used by each loop is measured with the DWT cycle
+ *         counter. The timer count at the interrupt entry gives the latency.
+ */
+
+
+#include  <stdint.h>
+
+
+#include "em_device.h"
+#include "clock_efm32gg2.h"
+
+#include "control.h"
+
+/*****************************************************************************
+ * @brief  Control timer
+ *****************************************************************************/
+
+///@{
+#define CONTROL_TIMER               TIMER3
+#define CONTROL_CLOCKEN             CMU_HFPERCLKEN0_TIMER3
+#define CONTROL_IRQn                TIMER3_IRQn
+#define CONTROL_INT_LEVEL           2       // Same as quadrature, so it is not preempted
+///@}
+
+/**
+ * @brief   Loop information
+ */
+typedef struct {
+    Control_ConfigType      config;
+    uint8_t                 used;
+    volatile uint8_t        enabled;
+    uint32_t                count;                  /**< for divider              */
+    volatile int32_t        setpoint;
+    volatile int32_t        ff;
+    int64_t                 integ;                  /**< integral << QSHIFT       */
+    int32_t                 dterm;                  /**< filtered derivative      */
+    int32_t                 lasty;                  /**< previous measurement     */
+    uint8_t                 first;                  /**< no previous measurement  */
+    volatile int32_t        output;
+    Control_StatsType       stats;
+} LoopInfo;
+
+static LoopInfo loops[CONTROL_MAXLOOPS];             /**< cleared at startup only  */
+
+static uint8_t  latencyshift = 0;                   /**< timer prescaler (2^n)    */
+
+/**
+ * @brief   Disable the control interrupt and return its previous state
+ *
+ * @note    Control_Add calls Control_Reset before Control_Init, so the interrupt
+ *          must not be enabled when it was not
+ */
+static inline uint32_t DisableControlIRQ(void) {
+uint32_t on;
+
+    on = (NVIC->ISER[((uint32_t) CONTROL_IRQn)>>5]>>(((uint32_t) CONTROL_IRQn)&0x1F))&1;
+    NVIC_DisableIRQ(CONTROL_IRQn);
+    return on;
+}
+
+/**
+ * @brief   Enable the control interrupt again when it was enabled before
+ */
+static inline void RestoreControlIRQ(uint32_t on) {
+
+    if( on )
+        NVIC_EnableIRQ(CONTROL_IRQn);
+}
+
+/**
+ * @brief   Saturate a value
+ */
+static inline int32_t Saturate(int64_t v, int32_t min, int32_t max) {
+
+    if( v > max )
+        return max;
+    if( v < min )
+        return min;
+    return (int32_t) v;
+}
+
+/**
+ * @brief   One iteration of a PID controller
+ */
+static int32_t PID(LoopInfo *p, int32_t y) {
+const Control_ConfigType *c = &p->config;
+int32_t e,d;
+int64_t u,integ,inc;
+
+    e = p->setpoint-y;
+
+    // Derivative on measurement with first order filter
+    if( p->first ) {
+        p->lasty = y;
+        p->first = 0;
+    }
+    d = Saturate(-((int64_t) c->kd*(y-p->lasty))>>CONTROL_QSHIFT,INT32_MIN/2,INT32_MAX/2);
+    p->dterm += (int32_t) (((int64_t) c->dfilter*(d-p->dterm))>>CONTROL_QSHIFT);
+    p->lasty = y;
+
+    // Integral is kept with QSHIFT fractional bits
+    inc   = (int64_t) c->ki*e;
+    integ = p->integ+inc;
+    if( integ > ((int64_t) c->outmax<<CONTROL_QSHIFT) )
+        integ = (int64_t) c->outmax<<CONTROL_QSHIFT;
+    if( integ < ((int64_t) c->outmin<<CONTROL_QSHIFT) )
+        integ = (int64_t) c->outmin<<CONTROL_QSHIFT;
+
+    u = (((int64_t) c->kp*e)>>CONTROL_QSHIFT)
+       +(integ>>CONTROL_QSHIFT)
+       +p->dterm
+       +(((int64_t) c->kff*p->setpoint)>>CONTROL_QSHIFT)
+       +p->ff;
+
+    // Conditional integration
+    if( (u > c->outmax && e > 0) || (u < c->outmin && e < 0) ) {
+        u -= (integ>>CONTROL_QSHIFT)-(p->integ>>CONTROL_QSHIFT);
+    } else {
+        p->integ = integ;
+    }
+
+    return Saturate(u,c->outmin,c->outmax);
+}
+
+/**
+ * @brief   Interrupt handler for control timer
+ *
+ * @note    Runs all enabled loops whose divider has expired
+ */
+void TIMER3_IRQHandler(void) {
+uint32_t latency;
+uint32_t start;
+int32_t  y;
+int i;
+
+    latency = CONTROL_TIMER->CNT<<latencyshift;
+    CONTROL_TIMER->IFC = TIMER_IFC_OF;
+
+    for(i=0;i<CONTROL_MAXLOOPS;i++) {
+        LoopInfo *p = &loops[i];
+        if( !p->used || !p->enabled )
+            continue;
+        if( ++p->count < p->config.divider )
+            continue;
+        p->count = 0;
+
+        start = DWT->CYCCNT;
+        y = p->config.source ? p->config.source() : 0;
+        p->output = PID(p,y);
+        if( p->config.sink )
+            p->config.sink(p->output);
+        p->stats.cycles = DWT->CYCCNT-start;
+
+        p->stats.runs++;
+        if( p->stats.cycles > p->stats.maxcycles )
+            p->stats.maxcycles = p->stats.cycles;
+        if( latency > p->stats.maxlatency )
+            p->stats.maxlatency = latency;
+    }
+
+    // Next overflow already happened: at least one period lost
+    if( CONTROL_TIMER->IF&TIMER_IF_OF ) {
+        for(i=0;i<CONTROL_MAXLOOPS;i++) {
+            if( loops[i].used && loops[i].enabled )
+                loops[i].stats.overruns++;
+        }
+    }
+}
+
+/**
+ * @brief   Initialize control timer
+ *
+ * @param   freq: interrupt frequency in Hz
+ *
+ * @note    Timer is not started. Use Control_Start after adding the loops
+ * @note    Loops can be added before or after it. Loops already added are kept, so
+ *          it can be called again to change the frequency
+ *
+ * @return  0 if OK, -1 if the frequency cannot be generated
+ */
+int Control_Init(uint32_t freq) {
+uint32_t fclk;
+uint32_t div;
+int p;
+
+    if( freq == 0 )
+        return -1;
+
+    fclk = ClockGetPeripheralClockFrequency();
+    div  = fclk/freq;
+    for(p=0;p<=10&&(div>>p)>0x10000;p++) {}
+    if( p > 10 || div == 0 )
+        return -1;
+
+    CMU->HFPERCLKDIV |= CMU_HFPERCLKDIV_HFPERCLKEN;
+    CMU->HFPERCLKEN0 |= CONTROL_CLOCKEN;
+
+    // Cycle counter
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+
+    CONTROL_TIMER->CMD  = TIMER_CMD_STOP;
+    CONTROL_TIMER->CTRL = TIMER_CTRL_MODE_UP
+                         |TIMER_CTRL_CLKSEL_PRESCHFPERCLK
+                         |(p<<_TIMER_CTRL_PRESC_SHIFT);
+    latencyshift = p;
+    CONTROL_TIMER->TOP  = (div>>p)-1;
+    CONTROL_TIMER->CNT  = 0;
+    CONTROL_TIMER->IFC  = _TIMER_IFC_MASK;
+    CONTROL_TIMER->IEN  = TIMER_IEN_OF;
+
+    NVIC_SetPriority(CONTROL_IRQn,CONTROL_INT_LEVEL);
+    NVIC_ClearPendingIRQ(CONTROL_IRQn);
+    NVIC_EnableIRQ(CONTROL_IRQn);
+
+    return 0;
+}
+
+/**
+ * @brief   Add a loop
+ *
+ * @note    Loop is added disabled. Use Control_Enable
+ *
+ * @return  loop number or -1 if there is no space or configuration is invalid
+ */
+int Control_Add(const Control_ConfigType *config) {
+int i;
+
+    if( config == 0 || config->outmin > config->outmax )
+        return -1;
+
+    for(i=0;i<CONTROL_MAXLOOPS&&loops[i].used;i++) {}
+    if( i == CONTROL_MAXLOOPS )
+        return -1;
+
+    loops[i].enabled  = 0;
+    loops[i].config   = *config;
+    loops[i].setpoint = 0;
+    loops[i].ff       = 0;
+    Control_Reset(i);
+    loops[i].used     = 1;
+
+    return i;
+}
+
+/**
+ * @brief   Set setpoint of a loop
+ */
+int Control_SetSetpoint(int loop, int32_t setpoint) {
+
+    if( loop < 0 || loop >= CONTROL_MAXLOOPS || !loops[loop].used )
+        return -1;
+    loops[loop].setpoint = setpoint;
+    return 0;
+}
+
+/**
+ * @brief   Set an additional feed-forward term (added to the output)
+ */
+int Control_SetFeedForward(int loop, int32_t ff) {
+
+    if( loop < 0 || loop >= CONTROL_MAXLOOPS || !loops[loop].used )
+        return -1;
+    loops[loop].ff = ff;
+    return 0;
+}
+
+/**
+ * @brief   Enable or disable a loop
+ *
+ * @note    When disabled, the sink is not called and the output keeps the last value
+ */
+int Control_Enable(int loop, int on) {
+
+    if( loop < 0 || loop >= CONTROL_MAXLOOPS || !loops[loop].used )
+        return -1;
+    loops[loop].count   = 0;
+    loops[loop].enabled = on != 0;
+    return 0;
+}
+
+/**
+ * @brief   Clear state (integral and derivative terms) and statistics of a loop
+ */
+int Control_Reset(int loop) {
+LoopInfo *p;
+uint32_t irq;
+
+    if( loop < 0 || loop >= CONTROL_MAXLOOPS )
+        return -1;
+
+    p = &loops[loop];
+    irq = DisableControlIRQ();
+    p->count  = 0;
+    p->integ  = 0;
+    p->dterm  = 0;
+    p->lasty  = 0;
+    p->first  = 1;
+    p->output = 0;
+    p->stats.runs       = 0;
+    p->stats.cycles     = 0;
+    p->stats.maxcycles  = 0;
+    p->stats.maxlatency = 0;
+    p->stats.overruns   = 0;
+    RestoreControlIRQ(irq);
+    return 0;
+}
+
+/**
+ * @brief   Return last output of a loop
+ */
+int32_t Control_GetOutput(int loop) {
+
+    if( loop < 0 || loop >= CONTROL_MAXLOOPS )
+        return 0;
+    return loops[loop].output;
+}
+
+/**
+ * @brief   Get timing statistics of a loop
+ */
+int Control_GetStats(int loop, Control_StatsType *stats) {
+uint32_t irq;
+
+    if( loop < 0 || loop >= CONTROL_MAXLOOPS || !loops[loop].used || stats == 0 )
+        return -1;
+    irq = DisableControlIRQ();
+    *stats = loops[loop].stats;
+    RestoreControlIRQ(irq);
+    return 0;
+}
+
+/**
+ * @brief   Start control timer
+ */
+void Control_Start(void) {
+
+    CONTROL_TIMER->CMD = TIMER_CMD_START;
+}
+
+/**
+ * @brief   Stop control timer
+ */
+void Control_Stop(void) {
+
+    CONTROL_TIMER->CMD = TIMER_CMD_STOP;
+}
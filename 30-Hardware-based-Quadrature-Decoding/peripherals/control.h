@@ -0,0 +1,72 @@
+#ifndef CONTROL_H
+/** ***************************************************************************
+ * @file    control.h
+ * @brief   Fixed-point PID control loops run by a timer interrupt
+ * @version 1.0
+******************************************************************************/
+#define CONTROL_H
+#include <stdint.h>
+
+/**
+ * @brief   Maximal number of control loops
+ */
+#define CONTROL_MAXLOOPS        4
+
+/**
+ * @brief   Number of fractional bits of gains and filter coefficient (Q15)
+ */
+#define CONTROL_QSHIFT          15
+#define CONTROL_Q(X)            ((int32_t) ((X)*(1<<CONTROL_QSHIFT)))
+
+/**
+ * @brief   Loop configuration
+ *
+ * @note    Gains are in Q15, i.e, CONTROL_Q(1.5) is 1.5. They can be greater than 1
+ *
+ * @note    ki and kd already include the sampling period (ki = Ki*T and kd = Kd/T)
+ *
+ * @note    dfilter is the coefficient of the first order filter of the derivative
+ *          term (CONTROL_Q(1.0) means no filter)
+ *
+ * @note    The loop runs every divider interrupts (0 or 1 means all of them)
+ */
+typedef struct {
+    int32_t     kp;                                 /**< proportional gain        */
+    int32_t     ki;                                 /**< integral gain            */
+    int32_t     kd;                                 /**< derivative gain          */
+    int32_t     kff;                                /**< setpoint feed-forward    */
+    int32_t     dfilter;                            /**< derivative filter        */
+    int32_t     outmin;                             /**< output lower limit       */
+    int32_t     outmax;                             /**< output upper limit       */
+    uint32_t    divider;                            /**< run every n interrupts   */
+    int32_t     (*source)(void);                    /**< reads measurement        */
+    void        (*sink)(int32_t);                   /**< writes output            */
+} Control_ConfigType;
+
+/**
+ * @brief   Timing statistics
+ *
+ * @note    Cycles are core clock cycles spent in the loop (source, PID and sink).
+ *          Latency is the timer count at interrupt entry scaled to HFPERCLK cycles
+ *          (the resolution is the timer prescaler, set by Control_Init).
+ */
+typedef struct {
+    uint32_t    runs;                               /**< number of iterations     */
+    uint32_t    cycles;                             /**< last iteration           */
+    uint32_t    maxcycles;                          /**< longest iteration        */
+    uint32_t    maxlatency;                         /**< longest interrupt latency*/
+    uint32_t    overruns;                           /**< interrupts lost          */
+} Control_StatsType;
+
+int     Control_Init(uint32_t freq);
+int     Control_Add(const Control_ConfigType *config);
+int     Control_SetSetpoint(int loop, int32_t setpoint);
+int     Control_SetFeedForward(int loop, int32_t ff);
+int     Control_Enable(int loop, int on);
+int     Control_Reset(int loop);
+int32_t Control_GetOutput(int loop);
+int     Control_GetStats(int loop, Control_StatsType *stats);
+void    Control_Start(void);
+void    Control_Stop(void);
+
+#endif // CONTROL_H
@@ -12,6 +12,14 @@
  *
  * @note   It uses a debouncing algorithm. At start, it needs N cycles to stabilize.
  *
+ * @note   In the A and B mode (USING_A_B_SIGNALS), the 16 bit counter of the
+ *         TIMER is extended to 32 bits by the overflow and underflow
+ *         interrupts. The A signal is also routed by PRS to a second TIMER,
+ *         that captures its rising edges for the speed measurement. An index
+ *         pulse, routed by PRS to CC2 of the decoding TIMER, captures the
+ *         position for homing. When not homing, CC2 is used to generate an
+ *         interrupt at a target position.
+ *
  */
 
 
@@ -27,12 +35,12 @@
 
 //#define USING_PULSE_DIR_SIGNALS_TIMER
 //#define USING_A_B_SIGNALS
-#define USING_PULSE_DIR_SIGNALS_PCNT
+//#define USING_PULSE_DIR_SIGNALS_PCNT
 
-// Default
+// Default (another mode can be set in the command line, e.g. -DUSING_A_B_SIGNALS)
 #if !defined(USING_A_B_SIGNALS) && !defined(USING_PULSE_DIR_SIGNALS_TIMER)&& \
     !defined(USING_PULSE_DIR_SIGNALS_PCNT)
-#define USING_A_B_SIGNALS
+#define USING_PULSE_DIR_SIGNALS_PCNT
 #endif
 
 /*****************************************************************************
@@ -85,11 +93,19 @@ static int16_t pcnt_cnt_ref = 0;
 #define QUADRATURE_M                ((1<<QUADRATURE_PIN0)|(1<<QUADRATURE_PIN1))
 #define QUADRATURE_BUTTON           (1<<QUADRATURE_PINBUTTON)
 
+#if defined(USING_A_B_SIGNALS)
+static int32_t GetRawPosition(void);
+static int32_t qoffset = 0;                 /**< raw position of zero      */
+#endif
+
 // These routines are identical for each deboding method
 
 
 int Quadrature_GetPosition(void) {
-#if defined(USING_PULSE_DIR_SIGNALS_TIMER) || defined(USING_A_B_SIGNALS)
+#if defined(USING_A_B_SIGNALS)
+    return GetRawPosition()-qoffset;
+#endif
+#if defined(USING_PULSE_DIR_SIGNALS_TIMER)
     return (int16_t) QUADRATURE_TIMER->CNT;
 #endif
 #if defined(USING_PULSE_DIR_SIGNALS_PCNT)
@@ -98,7 +114,10 @@ int Quadrature_GetPosition(void) {
 }
 
 void Quadrature_Reset(void) {
-#if defined(USING_PULSE_DIR_SIGNALS_TIMER) || defined(USING_A_B_SIGNALS)
+#if defined(USING_A_B_SIGNALS)
+    qoffset = GetRawPosition();
+#endif
+#if defined(USING_PULSE_DIR_SIGNALS_TIMER)
     QUADRATURE_TIMER->CNT = 0;
 #endif
 #if defined(USING_PULSE_DIR_SIGNALS_PCNT)
@@ -122,6 +141,329 @@ void QuadratureProcess(void) {}
  *  Configuration for A and B decoding
  */
 
+/**
+ * @brief   Speed measurement and index
+ *
+ * @note    A (PD7) is routed by PRS channel QUADRATURE_PRSCH_A to CC0 of the
+ *          QUADRATURE_SPEEDTIMER. The index pulse (PD3) is routed by PRS
+ *          channel QUADRATURE_PRSCH_INDEX to CC2 of QUADRATURE_TIMER.
+ */
+///@{
+#define QUADRATURE_SPEEDTIMER       TIMER2
+#define QUADRATURE_SPEEDCLOCKEN     CMU_HFPERCLKEN0_TIMER2
+#define QUADRATURE_SPEEDPRESC       TIMER_CTRL_PRESC_DIV16
+#define QUADRATURE_SPEEDPRESC_DIV   16
+#define QUADRATURE_PININDEX         3
+#define QUADRATURE_PRSCH_A          0
+#define QUADRATURE_PRSCH_INDEX      1
+#define QUADRATURE_INT_LEVEL        2
+#define QUADRATURE_COUNTSPERCYCLE   4   // X4 mode
+///@}
+
+#define QUADRATURE_INDEX            (1<<QUADRATURE_PININDEX)
+
+/**
+ * @brief   Usage of CC2 of QUADRATURE_TIMER
+ */
+typedef enum { CC2_OFF, CC2_HOMING, CC2_TARGET } CC2Mode_t;
+
+/**
+ * @brief   Variables updated by the interrupt routines
+ */
+///@{
+static volatile int32_t     qext        = 0;        /**< upper 16 bits of position */
+static volatile CC2Mode_t   cc2mode     = CC2_OFF;
+static volatile int         qhomed      = 0;        /**< index was found           */
+static volatile int32_t     qtarget     = 0;        /**< raw target position       */
+static void               (*homingcallback)(void)         = 0;
+static void               (*targetcallback)(int position) = 0;
+
+static volatile uint32_t    qspeedovf   = 0;        /**< overflows of speed timer  */
+static volatile uint32_t    qlastedge   = 0;        /**< timestamp of last A edge  */
+static volatile uint32_t    qperiod     = 0;        /**< period of A in ticks      */
+static uint32_t             qspeedfreq  = 0;        /**< speed timer frequency     */
+///@}
+
+/**
+ * @brief   Extend a 16 bit value of the counter using the upper part and
+ *          pending overflow/underflow flags
+ *
+ * @note    A pending flag means that the upper part was not updated yet. Only
+ *          values near the wrap around point are affected.
+ */
+static inline int32_t Extend(uint32_t v, int32_t ext, uint32_t flags) {
+
+    if( (flags&TIMER_IF_OF) && (v < 0x8000) )
+        ext++;
+    else if( (flags&TIMER_IF_UF) && (v >= 0x8000) )
+        ext--;
+    return (int32_t) (((uint32_t) ext<<16)|v);
+}
+
+/**
+ * @brief   Get 32 bit raw position
+ */
+static int32_t GetRawPosition(void) {
+int32_t pos;
+
+    __disable_irq();
+    pos = Extend(QUADRATURE_TIMER->CNT,qext,QUADRATURE_TIMER->IF);
+    __enable_irq();
+    return pos;
+}
+
+/**
+ * @brief   Configure CC2 to generate an interrupt at the target position
+ */
+static void ArmTarget(void) {
+
+    QUADRATURE_TIMER->CC[2].CTRL = TIMER_CC_CTRL_MODE_OUTPUTCOMPARE;
+    QUADRATURE_TIMER->CC[2].CCV  = (uint32_t) qtarget&0xFFFF;
+    QUADRATURE_TIMER->IFC        = TIMER_IF_CC2;
+    QUADRATURE_TIMER->IEN       |= TIMER_IEN_CC2;
+    cc2mode = CC2_TARGET;
+}
+
+/**
+ * @brief   Configure CC2 to capture the position at the index pulse
+ */
+static void ArmHoming(void) {
+
+    QUADRATURE_TIMER->CC[2].CTRL = TIMER_CC_CTRL_MODE_INPUTCAPTURE
+                                  |TIMER_CC_CTRL_INSEL_PRS
+                                  |(QUADRATURE_PRSCH_INDEX<<_TIMER_CC_CTRL_PRSSEL_SHIFT)
+                                  |TIMER_CC_CTRL_ICEDGE_RISING;
+    QUADRATURE_TIMER->IFC        = TIMER_IF_CC2;
+    QUADRATURE_TIMER->IEN       |= TIMER_IEN_CC2;
+    cc2mode = CC2_HOMING;
+}
+
+/**
+ * @brief   Disable CC2
+ */
+static void DisarmCC2(void) {
+
+    QUADRATURE_TIMER->IEN       &= ~TIMER_IEN_CC2;
+    QUADRATURE_TIMER->CC[2].CTRL = TIMER_CC_CTRL_MODE_OFF;
+    cc2mode = CC2_OFF;
+}
+
+/**
+ * @brief   Interrupt handler for decoding timer
+ *
+ * @note    Overflow and underflow update the upper 16 bits of position.
+ *          CC2 is used for the index capture or for the target compare.
+ */
+void TIMER1_IRQHandler(void) {
+uint32_t flags;
+int32_t  ext;
+
+    flags = QUADRATURE_TIMER->IF;
+    QUADRATURE_TIMER->IFC = flags;
+
+    ext = qext;
+    if( flags&TIMER_IF_OF )
+        qext++;
+    if( flags&TIMER_IF_UF )
+        qext--;
+
+    if( flags&TIMER_IF_CC2 ) {
+        int32_t pos = Extend(QUADRATURE_TIMER->CC[2].CCV,ext,flags);
+        if( cc2mode == CC2_HOMING ) {
+            // Index position is the new zero. Target is relative to it
+            qtarget += pos-qoffset;
+            qoffset = pos;
+            qhomed  = 1;
+            if( targetcallback )
+                ArmTarget();
+            else
+                DisarmCC2();
+            if( homingcallback )
+                homingcallback();
+        } else if ( cc2mode == CC2_TARGET ) {
+            // Only lower 16 bits are compared by hardware
+            if( pos == qtarget ) {
+                void (*callback)(int) = targetcallback;
+                targetcallback = 0;
+                DisarmCC2();
+                if( callback )
+                    callback(pos-qoffset);
+            }
+        }
+    }
+}
+
+/**
+ * @brief   Interrupt handler for speed timer
+ *
+ * @note    CC0 captures the rising edges of A
+ */
+void TIMER2_IRQHandler(void) {
+uint32_t flags;
+uint32_t ovf;
+uint32_t ccv;
+uint32_t t;
+
+    flags = QUADRATURE_SPEEDTIMER->IF;
+    QUADRATURE_SPEEDTIMER->IFC = flags;
+
+    ovf = qspeedovf;
+    if( flags&TIMER_IF_OF )
+        qspeedovf++;
+
+    if( flags&TIMER_IF_CC0 ) {
+        ccv = QUADRATURE_SPEEDTIMER->CC[0].CCV;
+        if( (flags&TIMER_IF_OF) && (ccv < 0x8000) )
+            ovf++;
+        t = (ovf<<16)|ccv;
+        // First edge after stop has no valid period
+        if( qlastedge != 0 && (t-qlastedge) < qspeedfreq )
+            qperiod = t-qlastedge;
+        else
+            qperiod = 0;
+        qlastedge = t;
+    }
+}
+
+/**
+ * @brief   Configure the speed timer
+ */
+static void InitSpeed(void) {
+
+    CMU->HFPERCLKEN0 |= QUADRATURE_SPEEDCLOCKEN|CMU_HFPERCLKEN0_PRS;
+
+    qspeedfreq = SystemCoreClock/QUADRATURE_SPEEDPRESC_DIV;
+
+    // Route A and INDEX to PRS
+    GPIO->EXTIPSELL = (GPIO->EXTIPSELL
+                        &~(_GPIO_EXTIPSELL_EXTIPSEL7_MASK
+                          |_GPIO_EXTIPSELL_EXTIPSEL3_MASK))
+                     |GPIO_EXTIPSELL_EXTIPSEL7_PORTD
+                     |GPIO_EXTIPSELL_EXTIPSEL3_PORTD;
+    GPIO->INSENSE  |= GPIO_INSENSE_PRS;
+
+    PRS->CH[QUADRATURE_PRSCH_A].CTRL     = PRS_CH_CTRL_SOURCESEL_GPIOL
+                                          |PRS_CH_CTRL_SIGSEL_GPIOPIN7
+                                          |PRS_CH_CTRL_EDSEL_OFF;
+    PRS->CH[QUADRATURE_PRSCH_INDEX].CTRL = PRS_CH_CTRL_SOURCESEL_GPIOL
+                                          |PRS_CH_CTRL_SIGSEL_GPIOPIN3
+                                          |PRS_CH_CTRL_EDSEL_OFF;
+
+    // Free running timer
+    QUADRATURE_SPEEDTIMER->CTRL = (QUADRATURE_SPEEDTIMER->CTRL
+                                    &~(_TIMER_CTRL_MODE_MASK
+                                      |_TIMER_CTRL_CLKSEL_MASK
+                                      |_TIMER_CTRL_PRESC_MASK))
+                                  |TIMER_CTRL_MODE_UP
+                                  |TIMER_CTRL_CLKSEL_PRESCHFPERCLK
+                                  |QUADRATURE_SPEEDPRESC;
+    QUADRATURE_SPEEDTIMER->TOP  = 0xFFFF;
+
+    // Capture rising edges of A
+    QUADRATURE_SPEEDTIMER->CC[0].CTRL = TIMER_CC_CTRL_MODE_INPUTCAPTURE
+                                       |TIMER_CC_CTRL_INSEL_PRS
+                                       |(QUADRATURE_PRSCH_A<<_TIMER_CC_CTRL_PRSSEL_SHIFT)
+                                       |TIMER_CC_CTRL_ICEDGE_RISING;
+
+    qspeedovf = 0;
+    qlastedge = 0;
+    qperiod   = 0;
+
+    QUADRATURE_SPEEDTIMER->IFC = _TIMER_IFC_MASK;
+    QUADRATURE_SPEEDTIMER->IEN = TIMER_IEN_OF|TIMER_IEN_CC0;
+    NVIC_SetPriority(TIMER2_IRQn,QUADRATURE_INT_LEVEL);
+    NVIC_ClearPendingIRQ(TIMER2_IRQn);
+    NVIC_EnableIRQ(TIMER2_IRQn);
+
+    QUADRATURE_SPEEDTIMER->CMD = TIMER_CMD_START;
+}
+
+/**
+ * @brief   Return speed in counts per second
+ *
+ * @note    It is calculated from the period of A, measured by the speed
+ *          timer. The direction is given by the decoding timer. When there is
+ *          no edge for a period longer than the last one, the speed is
+ *          bounded by the time since the last edge. After one second without
+ *          edges, the speed is zero.
+ */
+int Quadrature_GetSpeed(void) {
+uint32_t period,last,now,ovf,cnt;
+int speed;
+
+    __disable_irq();
+    period = qperiod;
+    last   = qlastedge;
+    ovf    = qspeedovf;
+    cnt    = QUADRATURE_SPEEDTIMER->CNT;
+    if( (QUADRATURE_SPEEDTIMER->IF&TIMER_IF_OF) && (cnt < 0x8000) )
+        ovf++;
+    __enable_irq();
+    now = (ovf<<16)|cnt;
+
+    if( period == 0 || (now-last) >= qspeedfreq )
+        return 0;
+    if( (now-last) > period )
+        period = now-last;
+
+    speed = (int) (((uint64_t) QUADRATURE_COUNTSPERCYCLE*qspeedfreq)/period);
+    if( QUADRATURE_TIMER->STATUS&TIMER_STATUS_DIR )
+        speed = -speed;
+    return speed;
+}
+
+/**
+ * @brief   Start search of the index pulse
+ *
+ * @note    At the next rising edge of the index, the position is set to zero
+ *          and the callback (if not null) is called from the interrupt routine.
+ *          While homing, the target interrupt is suspended.
+ */
+void Quadrature_StartHoming(void (*callback)(void)) {
+
+    __disable_irq();
+    homingcallback = callback;
+    qhomed = 0;
+    ArmHoming();
+    __enable_irq();
+}
+
+/**
+ * @brief   Return 1 if the index pulse was found since the last
+ *          Quadrature_StartHoming
+ */
+int Quadrature_IsHomed(void) {
+
+    return qhomed;
+}
+
+/**
+ * @brief   Generate an interrupt when position reaches target
+ *
+ * @note    The callback is called (once) from the interrupt routine.
+ */
+void Quadrature_SetTarget(int position, void (*callback)(int position)) {
+
+    __disable_irq();
+    qtarget = position+qoffset;
+    targetcallback = callback;
+    if( cc2mode != CC2_HOMING ) {
+        if( callback )
+            ArmTarget();
+        else
+            DisarmCC2();
+    }
+    __enable_irq();
+}
+
+/**
+ * @brief   Cancel target interrupt
+ */
+void Quadrature_CancelTarget(void) {
+
+    Quadrature_SetTarget(0,0);
+}
+
 void Quadrature_Init(void) {
 
     /* Enable Clock for GPIO and TIMER */
@@ -159,11 +501,29 @@ void Quadrature_Init(void) {
     QUADRATURE_TIMER->ROUTE = (QUADRATURE_TIMER->ROUTE
                                 &~(_TIMER_ROUTE_LOCATION_MASK
                                     |_TIMER_ROUTE_CC0PEN_MASK
-                                    |_TIMER_ROUTE_CC0PEN_MASK))
+                                    |_TIMER_ROUTE_CC1PEN_MASK))
                              |(QUADRATURE_LOC<<_TIMER_ROUTE_LOCATION_SHIFT)
                              |TIMER_ROUTE_CC0PEN
                              |TIMER_ROUTE_CC1PEN;
 
+    // Full 16 bit range. Overflow and underflow extend it to 32 bits
+    QUADRATURE_TIMER->TOP = 0xFFFF;
+    QUADRATURE_TIMER->CNT = 0;
+    qext    = 0;
+    qoffset = 0;
+    DisarmCC2();
+
+    // Index input
+    GPIO_Init(QUADRATURE_GPIO,QUADRATURE_INDEX,0);
+
+    InitSpeed();
+
+    QUADRATURE_TIMER->IFC = _TIMER_IFC_MASK;
+    QUADRATURE_TIMER->IEN = TIMER_IEN_OF|TIMER_IEN_UF;
+    NVIC_SetPriority(TIMER1_IRQn,QUADRATURE_INT_LEVEL);
+    NVIC_ClearPendingIRQ(TIMER1_IRQn);
+    NVIC_EnableIRQ(TIMER1_IRQn);
+
     // Start timer
     QUADRATURE_TIMER->CMD = TIMER_CMD_START;
 
@@ -11,4 +11,11 @@ void    Quadrature_Init(void);
 int     Quadrature_GetPosition(void);
 int     Quadrature_GetButtonStatus(void);
 void     Quadrature_Reset(void);
+
+// Only when using A and B signals with TIMER (USING_A_B_SIGNALS)
+int     Quadrature_GetSpeed(void);
+void    Quadrature_StartHoming(void (*callback)(void));
+int     Quadrature_IsHomed(void);
+void    Quadrature_SetTarget(int position, void (*callback)(int position));
+void    Quadrature_CancelTarget(void);
 #endif // LCD_H
@@ -0,0 +1,617 @@
+/**
+ * @file    stepper.c
+ * @brief   Step/direction pulse generator for stepper motors
+ *
+ * @version 1.0
+ *
+ * @note   The STEP pulses are generated by a TIMER. Each timer period generates one
+ *         pulse: the CC0 output is set at overflow and cleared at compare (pulse width).
+ *         The period (TOP) is the interval to the next step. It is written into TOPB
+ *         in the overflow interrupt, one step ahead, so the interrupt latency does not
+ *         change the pulse timing. The interrupt must only end before the next step.
+ *
+ * @note   Trapezoidal profiles use the algorithm of D. Austin (Generate stepper-motor
+ *         speed profiles in real time, 2005), also used in Atmel AVR446. Each interval
+ *         is calculated from the previous one with only one division
+ *
+ *              c(n) = c(n-1) - 2*c(n-1)/(4n+1)
+ *
+ *         and the remainder is carried to the next step, so there is no drift.
+ *         Negative n are used for deceleration.
+ *
+ * @note   S-curve profiles use a table with the intervals of the acceleration ramp,
+ *         calculated when the profile is set. The velocity follows the polynomial
+ *         v(t) = V*(3u^2-2u^3), u = t/T, so the acceleration starts and ends at zero.
+ *         For long ramps, the table has one entry every 2^k steps and the intervals
+ *         between them are linearly interpolated. The same table in reverse order is
+ *         used for deceleration. Moves too short to reach the speed use only the
+ *         beginning of the ramp.
+ *
+ * @note   The prescaler of the TIMER is chosen when the profile is set, so that the
+ *         first (longest) interval fits in 16 bits, unless the interval at full speed
+ *         would have less than STEPPER_MINTICKS ticks. In this case, longer intervals
+ *         are clipped to 16 bits, i.e., the motor starts at a small nonzero speed.
+ *
+ * @note   When USE_QUADRATURE is defined, the completion callback receives the
+ *         difference between the encoder position and the step position, scaled by
+ *         STEPPER_COUNTS_NUM/STEPPER_COUNTS_DEN (encoder counts per step).
+ */
+
+
+#include  <stdint.h>
+
+
+#include "em_device.h"
+#include "clock_efm32gg2.h"
+
+#include "gpio.h"
+#include "stepper.h"
+
+#define USE_QUADRATURE
+
+#ifdef USE_QUADRATURE
+#include "quadrature.h"
+#endif
+
+/*****************************************************************************
+ * @brief  Stepper configuration
+ *****************************************************************************/
+
+///@{
+#define STEPPER_TIMER               TIMER0
+#define STEPPER_CLOCKEN             CMU_HFPERCLKEN0_TIMER0
+#define STEPPER_IRQn                TIMER0_IRQn
+#define STEPPER_LOC                 3               // CC0 in PD1
+#define STEPPER_GPIO                GPIOD
+#define STEPPER_PINSTEP             1
+#define STEPPER_PINDIR              2
+#define STEPPER_PULSEWIDTH_US       2
+#define STEPPER_MINTICKS            256             // Resolution at full speed
+#define STEPPER_INT_LEVEL           3               // Lower than quadrature
+#define STEPPER_COUNTS_NUM          1               // Encoder counts per step is
+#define STEPPER_COUNTS_DEN          1               //     NUM/DEN
+///@}
+
+/**
+ * @brief   Compare configuration
+ *
+ * @note    COIST is zero, so the output is cleared when the timer is stopped
+ */
+///@{
+#define CC_PULSE    (TIMER_CC_CTRL_MODE_OUTPUTCOMPARE|TIMER_CC_CTRL_CMOA_CLEAR \
+                    |TIMER_CC_CTRL_COFOA_SET)
+#define CC_NOPULSE  (TIMER_CC_CTRL_MODE_OUTPUTCOMPARE|TIMER_CC_CTRL_CMOA_CLEAR \
+                    |TIMER_CC_CTRL_COFOA_NONE)
+///@}
+
+/**
+ * @brief   Interval generator states (trapezoidal profile)
+ */
+typedef enum { STATE_STOP, STATE_ACCEL, STATE_RUN, STATE_DECEL } State_t;
+
+/**
+ * @brief   Profile
+ */
+///@{
+static unsigned     ptype       = STEPPER_PROFILE_TRAPEZOIDAL;
+static uint32_t     pspeed      = 0;                /**< steps/s                  */
+static uint32_t     paccel      = 0;                /**< steps/s^2                */
+static uint32_t     pdecel      = 0;                /**< steps/s^2                */
+static uint32_t     presc       = 0;                /**< prescaler encoding       */
+static uint32_t     c0          = 0;                /**< first interval           */
+static uint32_t     cmin        = 0;                /**< interval at speed        */
+static uint32_t     pulsewidth  = 1;                /**< STEP pulse width         */
+static uint16_t     ramptable[STEPPER_RAMPMAX];     /**< S-curve ramp intervals   */
+static uint32_t     rampn       = 0;                /**< steps in ramp            */
+static uint32_t     rampshift   = 0;                /**< steps per entry (log2)   */
+///@}
+
+/**
+ * @brief   Move
+ */
+///@{
+static volatile int32_t     position    = 0;
+static volatile int         running     = 0;
+static int32_t              dir         = 1;
+static uint32_t             stepcount   = 0;
+static uint32_t             nsteps      = 0;
+static void                 (*donecallback)(int32_t,int32_t) = 0;
+///@}
+
+/**
+ * @brief   Interval generator
+ */
+///@{
+static State_t      state           = STATE_STOP;
+static uint32_t     genindex        = 0;
+static uint32_t     delay           = 0;
+static uint32_t     lastacceldelay  = 0;
+static uint32_t     decelstart      = 0;
+static uint32_t     rampuse         = 0;
+static int32_t      accelcount      = 0;
+static int32_t      decelval        = 0;
+static int32_t      rest            = 0;
+///@}
+
+/**
+ * @brief   Integer square root
+ */
+static uint32_t ISqrt(uint64_t v) {
+uint64_t r = 0;
+uint64_t b = (uint64_t) 1<<62;
+
+    while( b > v )
+        b >>= 2;
+    while( b ) {
+        if( v >= r+b ) {
+            v -= r+b;
+            r = (r>>1)+b;
+        } else {
+            r >>= 1;
+        }
+        b >>= 2;
+    }
+    return (uint32_t) r;
+}
+
+/**
+ * @brief   Limit interval to timer range
+ */
+static inline uint32_t Clip(uint32_t d) {
+
+    if( d > 0xFFFF )
+        return 0xFFFF;
+    if( d < cmin )
+        return cmin;
+    return d;
+}
+
+/**
+ * @brief   Following error measured by the encoder
+ */
+static int32_t GetError(void) {
+
+#ifdef USE_QUADRATURE
+    return Quadrature_GetPosition()-position*STEPPER_COUNTS_NUM/STEPPER_COUNTS_DEN;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief   One step of the Austin algorithm
+ */
+static inline uint32_t Austin(uint32_t d) {
+int32_t num = 2*(int32_t) d+rest;
+int32_t den = 4*accelcount+1;
+
+    rest = num%den;
+    return (uint32_t) ((int32_t) d-num/den);
+}
+
+/**
+ * @brief   Interval after step i of the S-curve ramp
+ */
+static inline uint32_t RampInterval(uint32_t i) {
+uint32_t j = i>>rampshift;
+int32_t  r = (int32_t) (i&((1U<<rampshift)-1));
+int32_t  a = ramptable[j];
+int32_t  b = ramptable[j+1];
+
+    return (uint32_t) (a+(b-a)*r/(1<<rampshift));
+}
+
+/**
+ * @brief   Return the next interval of the current move
+ */
+static uint32_t NextInterval(void) {
+uint32_t d;
+uint32_t n;
+
+    if( ptype == STEPPER_PROFILE_SCURVE ) {
+        n = genindex++;
+        if( n < rampuse )
+            return RampInterval(n);
+        if( n >= nsteps-rampuse )
+            return RampInterval(nsteps-1-n);
+        return rampuse < rampn ? RampInterval(rampuse) : cmin;
+    }
+
+    d = delay;
+    switch(state) {
+    case STATE_ACCEL:
+        genindex++;
+        accelcount++;
+        delay = Austin(delay);
+        if( genindex >= decelstart ) {
+            accelcount = decelval;
+            state = STATE_DECEL;
+        } else if( delay <= cmin ) {
+            lastacceldelay = delay;
+            delay = cmin;
+            rest = 0;
+            state = STATE_RUN;
+        }
+        break;
+    case STATE_RUN:
+        genindex++;
+        if( genindex >= decelstart ) {
+            accelcount = decelval;
+            delay = lastacceldelay;
+            state = STATE_DECEL;
+        }
+        break;
+    case STATE_DECEL:
+        genindex++;
+        accelcount++;
+        delay = Austin(delay);
+        if( accelcount >= 0 )
+            state = STATE_STOP;
+        break;
+    default:
+        break;
+    }
+    return d;
+}
+
+/**
+ * @brief   Prepare interval generator for a move of n steps
+ */
+static void Plan(uint32_t n) {
+uint64_t maxslim;
+uint64_t accellim;
+
+    genindex = 0;
+
+    if( ptype == STEPPER_PROFILE_SCURVE ) {
+        rampuse = n/2;
+        if( rampuse > rampn )
+            rampuse = rampn;
+        return;
+    }
+
+    rest           = 0;
+    accelcount     = 0;
+    delay          = c0;                // Not clipped. Only values written to TOP are
+    lastacceldelay = cmin;
+
+    if( n == 1 ) {
+        accelcount = -1;
+        state = STATE_DECEL;
+        return;
+    }
+
+    // Steps to reach speed and steps before deceleration must start
+    maxslim = (uint64_t) pspeed*pspeed/(2*paccel);
+    if( maxslim == 0 )
+        maxslim = 1;
+    accellim = (uint64_t) n*pdecel/(paccel+pdecel);
+    if( accellim == 0 )
+        accellim = 1;
+
+    if( accellim <= maxslim )
+        decelval = (int32_t) accellim-(int32_t) n;
+    else
+        decelval = -(int32_t) (maxslim*paccel/pdecel);
+    if( decelval == 0 )
+        decelval = -1;
+    decelstart = n+decelval;
+
+    if( delay <= cmin ) {
+        delay = cmin;
+        state = STATE_RUN;
+    } else {
+        state = STATE_ACCEL;
+    }
+}
+
+/**
+ * @brief   Choose prescaler for the longest interval (in HFPERCLK cycles)
+ *
+ * @note    Resolution at full speed has precedence
+ */
+static int FindPrescaler(uint64_t longest, uint32_t fclk) {
+int p;
+
+    for(p=0;p<10&&(longest>>p)>0xFFFF;p++) {}
+    while( p > 0 && (fclk>>p)/pspeed < STEPPER_MINTICKS )
+        p--;
+    return p;
+}
+
+/**
+ * @brief   Solve 2u^3-u^4 = g for u in [lo,1]
+ *
+ * @note    Newton iterations. The function is increasing and convex in [0,1], so
+ *          after the first iteration the approximation stays at the right side
+ */
+static float SolveRamp(float g, float u) {
+float f,df;
+
+    if( u < 0.05f ) {
+        u = 0.5f;
+        while( u*u*u*(2.0f-u) > g && u > 1e-4f )
+            u *= 0.5f;
+        u *= 2.0f;
+    }
+    for(int k=0;k<6;k++) {
+        f  = u*u*u*(2.0f-u)-g;
+        df = u*u*(6.0f-4.0f*u);
+        if( df <= 0.0f )
+            break;
+        u -= f/df;
+        if( u > 1.0f )
+            u = 1.0f;
+    }
+    return u;
+}
+
+/**
+ * @brief   Calculate the S-curve ramp table
+ *
+ * @note    Peak acceleration of v = V*(3u^2-2u^3) is 1.5*V/T and the ramp length is V*T/2.
+ *          Position is V*T*(u^3-u^4/2), so step i is at u where 2u^3-u^4 = i/length.
+ */
+static void BuildRamp(uint32_t fclk) {
+float v,a,t,ramp,ua,ub,ftimer;
+uint32_t n,i,j,d,entries;
+int p;
+
+    v    = (float) pspeed;
+    a    = (float) paccel;
+    ramp = 0.75f*v*v/a;
+    t    = 1.5f*v/a;
+    n    = (uint32_t) ramp;
+    if( n == 0 )
+        n = 1;
+
+    // One entry every 2^rampshift steps plus one for interpolation
+    for(rampshift=0;((n-1)>>rampshift)+2>STEPPER_RAMPMAX;rampshift++) {}
+    entries = ((n-1)>>rampshift)+2;
+
+    // First interval defines prescaler
+    ub = SolveRamp(1.0f/ramp,0.0f);
+    p = FindPrescaler((uint64_t) (ub*t*(float) fclk),fclk);
+    presc  = p;
+    ftimer = (float) (fclk>>p);
+    cmin   = (fclk>>p)/pspeed;
+
+    ub = 0.0f;
+    for(j=0;j<entries;j++) {
+        i = j<<rampshift;
+        if( i > n-1 )
+            i = n-1;
+        ua = (i==0) ? 0.0f : SolveRamp((float) i/ramp,ub);
+        ub = SolveRamp((float) (i+1)/ramp,ua);
+        d  = (uint32_t) ((ub-ua)*t*ftimer+0.5f);
+        ramptable[j] = Clip(d);
+    }
+    rampn = n;
+}
+
+/**
+ * @brief   Set motion profile
+ *
+ * @param   type:   STEPPER_PROFILE_TRAPEZOIDAL or STEPPER_PROFILE_SCURVE
+ * @param   speed:  maximal speed in steps/s
+ * @param   accel:  acceleration in steps/s^2 (peak acceleration for S-curve)
+ * @param   decel:  deceleration in steps/s^2 (ignored for S-curve, that uses accel)
+ *
+ * @note    It can not be changed while the motor is running
+ *
+ * @note    For S-curve, the table is calculated here (using floating point), so it
+ *          should be called once for each profile and not before each move
+ *
+ * @return  0 if OK, negative if parameters are invalid
+ */
+int Stepper_SetProfile(unsigned type, uint32_t speed, uint32_t accel, uint32_t decel) {
+uint32_t fclk;
+uint64_t c0full;
+int p;
+
+    if( running )
+        return -1;
+    if( type > STEPPER_PROFILE_SCURVE || speed == 0 || accel == 0 )
+        return -2;
+    if( decel == 0 )
+        decel = accel;
+
+    ptype  = type;
+    pspeed = speed;
+    paccel = accel;
+    pdecel = decel;
+    fclk   = ClockGetPeripheralClockFrequency();
+
+    if( type == STEPPER_PROFILE_SCURVE ) {
+        BuildRamp(fclk);
+    } else {
+        // c0 = 0.676*f*sqrt(2/a)
+        c0full = (uint64_t) fclk*676*ISqrt(20000000000ULL/accel)/100000000;
+        p = FindPrescaler(c0full,fclk);
+        presc = p;
+        c0    = (uint32_t) (c0full>>p);
+        cmin  = (fclk>>p)/speed;
+    }
+
+    pulsewidth = (uint32_t) ((uint64_t) (fclk>>presc)*STEPPER_PULSEWIDTH_US/1000000)+1;
+    if( cmin < 2*pulsewidth )
+        return -3;                      // Speed too high for this acceleration
+
+    return 0;
+}
+
+/**
+ * @brief   Initialize stepper driver
+ *
+ * @note    Default profile is trapezoidal with 1000 steps/s and 5000 steps/s^2
+ */
+int Stepper_Init(void) {
+
+    CMU->HFPERCLKDIV |= CMU_HFPERCLKDIV_HFPERCLKEN;
+    CMU->HFPERCLKEN0 |= STEPPER_CLOCKEN;
+
+    GPIO_Init(STEPPER_GPIO,0,(1<<STEPPER_PINSTEP)|(1<<STEPPER_PINDIR));
+    GPIO_WritePins(STEPPER_GPIO,(1<<STEPPER_PINSTEP)|(1<<STEPPER_PINDIR),0);
+
+    STEPPER_TIMER->CMD        = TIMER_CMD_STOP;
+    STEPPER_TIMER->CTRL       = TIMER_CTRL_MODE_UP|TIMER_CTRL_CLKSEL_PRESCHFPERCLK;
+    STEPPER_TIMER->CC[0].CTRL = CC_PULSE;
+    STEPPER_TIMER->ROUTE      = TIMER_ROUTE_CC0PEN|(STEPPER_LOC<<_TIMER_ROUTE_LOCATION_SHIFT);
+    STEPPER_TIMER->IEN        = 0;
+    STEPPER_TIMER->IFC        = _TIMER_IFC_MASK;
+
+    running = 0;
+
+    NVIC_SetPriority(STEPPER_IRQn,STEPPER_INT_LEVEL);
+    NVIC_ClearPendingIRQ(STEPPER_IRQn);
+    NVIC_EnableIRQ(STEPPER_IRQn);
+
+    return Stepper_SetProfile(STEPPER_PROFILE_TRAPEZOIDAL,1000,5000,5000);
+}
+
+/**
+ * @brief   Move a number of steps
+ *
+ * @param   steps:    number of steps (negative for reverse direction)
+ * @param   callback: called (in interrupt) when the move ends with the position and
+ *                    the following error measured by the encoder. Can be null
+ *
+ * @return  0 if OK, -1 if the motor is running
+ */
+int Stepper_Move(int32_t steps, void (*callback)(int32_t position, int32_t error)) {
+uint32_t n;
+uint32_t top;
+
+    if( running )
+        return -1;
+
+    if( steps == 0 ) {
+        if( callback )
+            callback(position,GetError());
+        return 0;
+    }
+
+    if( steps > 0 ) {
+        dir = 1;
+        n   = steps;
+        GPIO_WritePins(STEPPER_GPIO,0,1<<STEPPER_PINDIR);
+    } else {
+        dir = -1;
+        n   = -steps;
+        GPIO_WritePins(STEPPER_GPIO,1<<STEPPER_PINDIR,0);
+    }
+
+    nsteps       = n;
+    stepcount    = 0;
+    donecallback = callback;
+    Plan(n);
+
+    STEPPER_TIMER->CMD  = TIMER_CMD_STOP;
+    STEPPER_TIMER->CTRL = (STEPPER_TIMER->CTRL&~_TIMER_CTRL_PRESC_MASK)
+                         |(presc<<_TIMER_CTRL_PRESC_SHIFT);
+    STEPPER_TIMER->CNT  = 0;
+
+    // First interval to TOP, second to TOPB
+    top = Clip(NextInterval());
+    STEPPER_TIMER->TOP  = top;
+    if( n > 1 )
+        top = Clip(NextInterval());
+    STEPPER_TIMER->TOPB = top;
+
+    STEPPER_TIMER->CC[0].CCV  = pulsewidth;
+    STEPPER_TIMER->CC[0].CTRL = CC_PULSE;
+
+    STEPPER_TIMER->IFC  = _TIMER_IFC_MASK;
+    STEPPER_TIMER->IEN  = TIMER_IEN_OF;
+
+    running = 1;
+    STEPPER_TIMER->CMD  = TIMER_CMD_START;
+
+    return 0;
+}
+
+/**
+ * @brief   Move to an absolute position
+ */
+int Stepper_MoveTo(int32_t pos, void (*callback)(int32_t position, int32_t error)) {
+
+    return Stepper_Move(pos-position,callback);
+}
+
+/**
+ * @brief   Stop immediately
+ *
+ * @note    No deceleration. Callback is not called
+ */
+void Stepper_Stop(void) {
+
+    STEPPER_TIMER->IEN &= ~TIMER_IEN_OF;
+    STEPPER_TIMER->CMD  = TIMER_CMD_STOP;       // STEP output is cleared
+    STEPPER_TIMER->IFC  = _TIMER_IFC_MASK;
+    donecallback = 0;
+    running = 0;
+}
+
+/**
+ * @brief   Return 1 if a move is in progress
+ */
+int Stepper_IsRunning(void) {
+
+    return running;
+}
+
+/**
+ * @brief   Return position (in steps)
+ */
+int32_t Stepper_GetPosition(void) {
+
+    return position;
+}
+
+/**
+ * @brief   Set position (in steps)
+ */
+void Stepper_SetPosition(int32_t pos) {
+
+    if( !running )
+        position = pos;
+}
+
+/**
+ * @brief   Interrupt handler for stepper timer
+ *
+ * @note    Each overflow starts a STEP pulse. The interval after the next step is
+ *          written into TOPB. After the last step, the overflow does not generate a
+ *          pulse and the timer is stopped at the next one.
+ */
+void TIMER0_IRQHandler(void) {
+uint32_t flags;
+void (*callback)(int32_t,int32_t);
+
+    flags = STEPPER_TIMER->IF;
+    STEPPER_TIMER->IFC = flags;
+
+    if( (flags&TIMER_IF_OF) == 0 || !running )
+        return;
+
+    if( stepcount == nsteps ) {
+        // Period after the last step has ended
+        STEPPER_TIMER->IEN &= ~TIMER_IEN_OF;
+        STEPPER_TIMER->CMD  = TIMER_CMD_STOP;
+        running  = 0;
+        callback = donecallback;
+        donecallback = 0;
+        if( callback )
+            callback(position,GetError());
+        return;
+    }
+
+    stepcount++;
+    position += dir;
+
+    if( stepcount+1 < nsteps ) {
+        STEPPER_TIMER->TOPB = Clip(NextInterval());
+    } else if( stepcount == nsteps ) {
+        STEPPER_TIMER->CC[0].CTRL = CC_NOPULSE;
+    }
+}
@@ -0,0 +1,34 @@
+#ifndef STEPPER_H
+/** ***************************************************************************
+ * @file    stepper.h
+ * @brief   Step/direction pulse generator for stepper motors
+ * @version 1.0
+******************************************************************************/
+#define STEPPER_H
+#include <stdint.h>
+
+/**
+ * @brief   Profile types
+ */
+///@{
+#define STEPPER_PROFILE_TRAPEZOIDAL     0
+#define STEPPER_PROFILE_SCURVE          1
+///@}
+
+/**
+ * @brief   Size of the S-curve ramp table
+ *
+ * @note    Longer ramps use one entry every 2^k steps
+ */
+#define STEPPER_RAMPMAX                 256
+
+int     Stepper_Init(void);
+int     Stepper_SetProfile(unsigned type, uint32_t speed, uint32_t accel, uint32_t decel);
+int     Stepper_Move(int32_t steps, void (*callback)(int32_t position, int32_t error));
+int     Stepper_MoveTo(int32_t position, void (*callback)(int32_t position, int32_t error));
+void    Stepper_Stop(void);
+int     Stepper_IsRunning(void);
+int32_t Stepper_GetPosition(void);
+void    Stepper_SetPosition(int32_t position);
+
+#endif // STEPPER_H
@@ -14,6 +14,12 @@
  *   UIF_TOUCH1  |  PC9          |    ACMP1/CH1
  *   UIF_TOUCH2  |  PC10         |    ACMP1/CH2
  *   UIF_TOUCH3  |  PC11         |    ACMP1/CH3
+ *
+ * @note    When TOUCH_USE_LESENSE is defined, the channels are scanned by the
+ *          LESENSE module (ACMP1 channels 0-3 are LESENSE channels 8-11). The
+ *          counts are compared against thresholds by hardware and the CPU
+ *          is only woken when a touch is detected. While touched, the scan rate
+ *          is increased and the counts are read at each scan. It works in EM2.
  */
 
 
@@ -37,6 +43,7 @@
 #define TOUCH_P2           10
 #define TOUCH_P3           11
 #define TOUCH_INVERTSEQUENCE 1
+//#define TOUCH_USE_LESENSE
 /**
  * Configuration in GeckoSDK for EFM32GG-STK3700
  *  fullBias = false
@@ -76,6 +83,24 @@
 // Threshold to detect touch (NUM/DEN)
 #define THRESHOLD_NUM       8
 #define THRESHOLD_DEN       10
+// Threshold to detect release (NUM/DEN). Must be greater than THRESHOLD_NUM
+#define THRESHOLD_OFF_NUM   9
+
+// Baseline IIR filter: b += (m-b)/2^BASELINE_SHIFT. Baseline has BASELINE_FRAC
+// fractional bits
+#define BASELINE_SHIFT      5
+#define BASELINE_FRAC       6
+
+// Position range: 0 (channel 0) to POSITION_MAX (channel TOUCH_N-1)
+#define POSITION_MAX        255
+
+// Number of scans to calibrate the baselines. The first scan is discarded, as the
+// first TIMER count can be partial
+#define TOUCH_CALIBSCANS    8
+
+// Swipe: minimal travel (in position units) and maximal duration (in scans)
+#define SWIPE_MIN           (POSITION_MAX/2)
+#define SWIPE_MAXSCANS      50
 
 
 
@@ -124,27 +149,80 @@ static uint16_t measurements_max[TOUCH_N];
 static int channelindex = 0;
 static int pollcompleted = 0;
 
+/*
+ *  Baseline tracking and position
+ */
+static uint32_t baseline[TOUCH_N];          // untouched count, BASELINE_FRAC bits
+static int      calibscans  = -1;           // calibration scans (-1: discard first)
+static unsigned touchstate  = 0;            // bit i = channel i touched
+static int      position    = -1;           // 0..POSITION_MAX or -1
+static int      startpos    = 0;            // position at start of touch
+static int      touchscans  = 0;            // duration of touch in scans
+static int      velocity    = 0;            // position units per scan (filtered)
+static int      swipe       = TOUCH_SWIPE_NONE;
+
+static int  CalibrateScan(void);
+static void ProcessScan(void);
+static unsigned ResultToMask(unsigned r);
+
+#ifdef TOUCH_USE_LESENSE
+/*
+ * LESENSE configuration
+ *
+ * Scan period = (PCTOP+1)*2^PCPRESC/LFACLK (LFRCO = 32768 Hz)
+ *
+ * There is no excitation phase. Each channel counts the ACMP oscillations during
+ * SAMPLEDLY+1 LFACLK cycles, so a scan takes TOUCH_N*(SAMPLEDLY+1) = 128 cycles
+ * (3.9 ms), less than half of the fast scan period (328 cycles, 10 ms).
+ */
+#define TOUCH_LESCH0        8       // ACMP1/CH0 = LESENSE CH8
+#define TOUCH_LESCHMASK     (((1<<TOUCH_N)-1)<<TOUCH_LESCH0)
+#define TOUCH_SLOW_PCPRESC  3       // 2^3: 8 Hz when idle
+#define TOUCH_SLOW_PCTOP    511
+#define TOUCH_FAST_PCPRESC  0       // 2^0: 100 Hz when touched
+#define TOUCH_FAST_PCTOP    327
+#define TOUCH_SAMPLEDLY     0x1F    // counting window in LFACLK cycles (0.98 ms)
+#define TOUCH_INT_LEVEL     3
+// Number of scans without touch to return to slow scan
+#define TOUCH_IDLESCANS     50
+
+#if TOUCH_N*(TOUCH_SAMPLEDLY+1) > (TOUCH_FAST_PCTOP+1)/2
+#error "Touch scan does not fit in the fast scan period"
+#endif
+
+typedef enum { STATE_CALIBRATING, STATE_IDLE, STATE_TOUCHED } LESENSEState_t;
+
+static volatile LESENSEState_t  lesensestate = STATE_CALIBRATING;
+static int                      scancounter = 0;
+static void                   (*touchcallback)(unsigned) = 0;
+
+static void InitLESENSE(void);
+#endif
+
 /**
  * @brief   Returns status of all channels as a bit vector in a unsigned int
  */
 
 void
 Touch_PeriodicProcess(void) {
+#ifndef TOUCH_USE_LESENSE
 uint16_t v;
 
     v = TOUCH_TIMER->CNT;
 
-    if( v > measurements_max[channelindex] )
-        measurements_max[channelindex] = v;
-
     measurements[channelindex++] = v;
 
     if( channelindex >= TOUCH_N ) {
         channelindex = 0;
         pollcompleted = 1;
+        if( calibscans < TOUCH_CALIBSCANS )
+            (void) CalibrateScan();
+        else
+            ProcessScan();
     }
 
     Touch_Restart();
+#endif
 
     return;
 }
@@ -204,6 +282,7 @@ Touch_Init(void) {
     else
         return -1;
 
+#ifndef TOUCH_USE_LESENSE
     /* Enable clock for Peripheral Reflex Systems (PRS) */
     CMU->HFPERCLKEN0 |= CMU_HFPERCLKEN0_PRS;
 
@@ -253,6 +332,7 @@ Touch_Init(void) {
     } else {
         return -3;
     }
+#endif
 
 
     // Set bias for fast response (higher power consumption))
@@ -290,7 +370,11 @@ Touch_Init(void) {
     TOUCH_ACMP->CTRL |= ACMP_CTRL_EN;
 
     //while( (TOUCH_ACMP->STATUS&ACMP_STATUS_ACMPACT) == 0 ) {} // Timeout??
+#ifdef TOUCH_USE_LESENSE
+    InitLESENSE();
+#else
     Touch_Start();
+#endif
 
     return 0;
 }
@@ -301,29 +385,12 @@ Touch_Init(void) {
 
 unsigned
 Touch_Read(void) {
-int i;
-unsigned m;
-
-#ifdef TOUCH_INVERTSEQUENCE
-    m = 0;
-    for(i=0;i<TOUCH_N;i++) {
-        m <<= 1;
-        if( measurements[i] < measurements_max[i]*THRESHOLD_NUM/THRESHOLD_DEN )
-            m |= 1;
-    }
-#else
-    m = 0;
-    for(i=TOUCH_N-1;i>=0;i--) {
-        m <<= 1;
-        if( measurements[i] < measurements_max[i]*THRESHOLD_NUM/THRESHOLD_DEN )
-            m |= 1;
-    }
-#endif
-
 
+#ifndef TOUCH_USE_LESENSE
     pollcompleted = 1;
+#endif
 
-    return m;
+    return ResultToMask(touchstate);
 }
 
 
@@ -336,7 +403,7 @@ unsigned
 Touch_ReadChannel(int ch){
 uint32_t v = 0;
 
-    v = measurements[ch] < measurements_max[ch]*THRESHOLD_NUM/THRESHOLD_DEN;
+    v = (touchstate>>ch)&1;
     return v;
 }
 
@@ -386,3 +453,384 @@ int k;
     return 1<<(k-1);
 }
 
+/**
+ * @brief   Convert a result (bit i = channel i) to the order used by Touch_Read
+ */
+static unsigned
+ResultToMask(unsigned r) {
+#ifdef TOUCH_INVERTSEQUENCE
+int i;
+unsigned m;
+
+    m = 0;
+    for(i=0;i<TOUCH_N;i++) {
+        m <<= 1;
+        if( r&(1<<i) )
+            m |= 1;
+    }
+    return m;
+#else
+    return r;
+#endif
+}
+
+/**
+ * @brief   Calibration with a complete scan
+ *
+ * @note    The baseline of each channel is the maximal count (the least touched)
+ *          of TOUCH_CALIBSCANS scans, after the first one is discarded. When the
+ *          slider is touched during the calibration, the baseline is too low. It is
+ *          raised by the IIR filter in ProcessScan, as a count above the baseline
+ *          is not a touch.
+ *
+ * @return  1 when the calibration is complete
+ */
+static int
+CalibrateScan(void) {
+int i;
+
+    if( calibscans++ < 0 ) {
+        for(i=0;i<TOUCH_N;i++)
+            measurements_max[i] = 0;
+        return 0;
+    }
+    for(i=0;i<TOUCH_N;i++) {
+        if( measurements[i] > measurements_max[i] )
+            measurements_max[i] = measurements[i];
+    }
+    if( calibscans < TOUCH_CALIBSCANS )
+        return 0;
+
+    for(i=0;i<TOUCH_N;i++)
+        baseline[i] = (uint32_t) measurements_max[i]<<BASELINE_FRAC;
+    return 1;
+}
+
+/**
+ * @brief   Process the counts of a complete scan
+ *
+ * @note    For each channel, the difference between the baseline and the
+ *          count is compared against thresholds with hysteresis. The baseline
+ *          follows slow changes (temperature, humidity) of untouched channels
+ *          with a first order IIR filter.
+ *
+ * @note    The position is the centroid of the differences, weighted by
+ *          the channel position, in the range 0..POSITION_MAX.
+ */
+static void
+ProcessScan(void) {
+int i;
+uint32_t m,base,delta;
+uint32_t sum,wsum;
+unsigned state;
+
+    state = touchstate;
+    sum   = 0;
+    wsum  = 0;
+    for(i=0;i<TOUCH_N;i++) {
+        m = measurements[i];
+        base  = baseline[i]>>BASELINE_FRAC;
+        delta = (base > m) ? base-m : 0;
+
+        if( state&(1<<i) ) {
+            if( m > base*THRESHOLD_OFF_NUM/THRESHOLD_DEN )
+                state &= ~(1<<i);
+        } else {
+            if( m < base*THRESHOLD_NUM/THRESHOLD_DEN )
+                state |= (1<<i);
+        }
+
+        if( (state&(1<<i)) == 0 ) {
+            uint32_t mf = m<<BASELINE_FRAC;
+            if( mf > baseline[i] )
+                baseline[i] += (mf-baseline[i])>>BASELINE_SHIFT;
+            else
+                baseline[i] -= (baseline[i]-mf)>>BASELINE_SHIFT;
+        }
+
+        sum  += delta;
+        wsum += delta*i;
+    }
+    touchstate = state;
+
+    if( state && sum ) {
+        int p = (int) ((wsum*POSITION_MAX+sum*(TOUCH_N-1)/2)/(sum*(TOUCH_N-1)));
+        if( position < 0 ) {
+            // Start of touch
+            startpos   = p;
+            touchscans = 0;
+            velocity   = 0;
+        } else {
+            velocity   = (velocity+(p-position))/2;
+            touchscans++;
+        }
+        position = p;
+    } else if( position >= 0 ) {
+        // End of touch
+        int travel = position-startpos;
+        if( touchscans <= SWIPE_MAXSCANS ) {
+            if( travel >= SWIPE_MIN )
+                swipe = TOUCH_SWIPE_UP;
+            else if( travel <= -SWIPE_MIN )
+                swipe = TOUCH_SWIPE_DOWN;
+        }
+        position = -1;
+        velocity = 0;
+    }
+}
+
+/**
+ * @brief   Return position of touch
+ *
+ * @note    Returns -1 when there is no touch, or 0 (channel 0) to
+ *          POSITION_MAX (channel TOUCH_N-1)
+ */
+int
+Touch_GetPosition(void) {
+
+    return position;
+}
+
+/**
+ * @brief   Return velocity of touch in position units per scan
+ */
+int
+Touch_GetVelocity(void) {
+
+    return velocity;
+}
+
+/**
+ * @brief   Return last swipe detected and clear it
+ *
+ * @note    Returns TOUCH_SWIPE_NONE, TOUCH_SWIPE_UP (from channel 0 to
+ *          channel TOUCH_N-1) or TOUCH_SWIPE_DOWN
+ */
+int
+Touch_GetSwipe(void) {
+int s;
+
+    __disable_irq();
+    s = swipe;
+    swipe = TOUCH_SWIPE_NONE;
+    __enable_irq();
+    return s;
+}
+
+/**
+ * @brief   Return baseline (untouched count) of channel
+ */
+unsigned
+Touch_GetBaseline(int ch) {
+
+    return baseline[ch]>>BASELINE_FRAC;
+}
+
+
+#ifdef TOUCH_USE_LESENSE
+
+/**
+ * @brief   Wait until command register is synchronized to LF clock domain
+ */
+static inline void
+WaitSync(void) {
+
+    while( LESENSE->SYNCBUSY&LESENSE_SYNCBUSY_CMD ) {}
+}
+
+/**
+ * @brief   Set scan rate and interrupts
+ *
+ * @note    Idle: slow scan, interrupt when a channel is below the hardware
+ *          threshold or when the buffer has two scans (baseline tracking).
+ *          Touched/Calibrating: fast scan, interrupt at end of each scan.
+ */
+static void
+SetScanMode(LESENSEState_t st) {
+uint32_t presc,top;
+
+    if( st == STATE_IDLE ) {
+        presc = TOUCH_SLOW_PCPRESC;
+        top   = TOUCH_SLOW_PCTOP;
+    } else {
+        presc = TOUCH_FAST_PCPRESC;
+        top   = TOUCH_FAST_PCTOP;
+    }
+
+    WaitSync();
+    LESENSE->CMD = LESENSE_CMD_STOP;
+    while( LESENSE->STATUS&LESENSE_STATUS_SCANACTIVE ) {}
+
+    LESENSE->TIMCTRL = (LESENSE->TIMCTRL
+                        &~(_LESENSE_TIMCTRL_PCPRESC_MASK
+                          |_LESENSE_TIMCTRL_PCTOP_MASK))
+                      |(presc<<_LESENSE_TIMCTRL_PCPRESC_SHIFT)
+                      |(top<<_LESENSE_TIMCTRL_PCTOP_SHIFT);
+
+    LESENSE->IFC = _LESENSE_IFC_MASK;
+    if( st == STATE_IDLE )
+        LESENSE->IEN = TOUCH_LESCHMASK|LESENSE_IEN_BUFLEVEL;
+    else
+        LESENSE->IEN = LESENSE_IEN_SCANCOMPLETE;
+
+    scancounter  = 0;
+    lesensestate = st;
+
+    WaitSync();
+    LESENSE->CMD = LESENSE_CMD_CLEARBUF;
+    WaitSync();
+    LESENSE->CMD = LESENSE_CMD_START;
+}
+
+/**
+ * @brief   Set thresholds from the base (untouched) counts
+ */
+static void
+SetThresholds(void) {
+int i;
+uint32_t thres;
+
+    for(i=0;i<TOUCH_N;i++) {
+        thres = (baseline[i]>>BASELINE_FRAC)*THRESHOLD_NUM/THRESHOLD_DEN;
+        LESENSE->CH[TOUCH_LESCH0+i].EVAL = (LESENSE->CH[TOUCH_LESCH0+i].EVAL
+                                            &~_LESENSE_CH_EVAL_COMPTHRES_MASK)
+                                          |(thres<<_LESENSE_CH_EVAL_COMPTHRES_SHIFT);
+    }
+}
+
+/**
+ * @brief   LESENSE interrupt handler
+ *
+ * @note    The counts of all complete scans in the buffer are processed. So the
+ *          baselines are also updated by the idle scans. The touch state always
+ *          comes from the hysteresis in ProcessScan. The hardware comparison
+ *          only wakes the CPU to leave the idle scan rate.
+ */
+void
+LESENSE_IRQHandler(void) {
+uint32_t flags;
+unsigned before;
+int n;
+
+    flags = LESENSE->IF;
+    LESENSE->IFC = flags;
+
+    if( lesensestate == STATE_IDLE && (flags&TOUCH_LESCHMASK) ) {
+        // Possible touch. Scan faster and let the hysteresis decide
+        SetScanMode(STATE_TOUCHED);
+        return;
+    }
+
+    if( (flags&(LESENSE_IF_SCANCOMPLETE|LESENSE_IF_BUFLEVEL)) == 0 )
+        return;
+
+    // Get counts (one entry per channel in ascending order for each scan)
+    before = touchstate;
+    n = 0;
+    while( LESENSE->STATUS&LESENSE_STATUS_BUFDATAV ) {
+        measurements[n++] = LESENSE->BUFDATA;
+        if( n < TOUCH_N )
+            continue;
+        n = 0;
+        pollcompleted = 1;
+
+        if( lesensestate == STATE_CALIBRATING ) {
+            if( CalibrateScan() ) {
+                SetThresholds();
+                SetScanMode(STATE_IDLE);
+                return;
+            }
+        } else {
+            // Track baseline and follow it with the hardware thresholds
+            ProcessScan();
+        }
+    }
+    if( lesensestate == STATE_CALIBRATING )
+        return;
+
+    SetThresholds();
+
+    if( touchstate != before && touchcallback )
+        touchcallback(ResultToMask(touchstate));
+
+    if( lesensestate == STATE_IDLE ) {
+        if( touchstate != 0 )
+            SetScanMode(STATE_TOUCHED);
+    } else if( touchstate == 0 ) {
+        if( ++scancounter >= TOUCH_IDLESCANS )
+            SetScanMode(STATE_IDLE);
+    } else {
+        scancounter = 0;
+    }
+}
+
+/**
+ * @brief   Configure LESENSE to scan the touch channels
+ *
+ * @note    ACMP is controlled by LESENSE (MUXTHRES mode): input and VDDLEVEL
+ *          are set for each channel.
+ */
+static void
+InitLESENSE(void) {
+int i;
+
+    /* Enable clock for low energy peripherals and LFRCO as LFACLK */
+    CMU->HFCORECLKEN0 |= CMU_HFCORECLKEN0_LE;
+    CMU->OSCENCMD      = CMU_OSCENCMD_LFRCOEN;
+    while( (CMU->STATUS&CMU_STATUS_LFRCORDY) == 0 ) {}
+    CMU->LFCLKSEL      = (CMU->LFCLKSEL&~_CMU_LFCLKSEL_LFA_MASK)|CMU_LFCLKSEL_LFA_LFRCO;
+    CMU->LFAPRESC0     = (CMU->LFAPRESC0&~_CMU_LFAPRESC0_LESENSE_MASK)
+                        |CMU_LFAPRESC0_LESENSE_DIV1;
+    CMU->LFACLKEN0    |= CMU_LFACLKEN0_LESENSE;
+
+    WaitSync();
+    LESENSE->CMD = LESENSE_CMD_STOP;
+
+    LESENSE->CTRL    = LESENSE_CTRL_SCANMODE_PERIODIC
+                      |LESENSE_CTRL_SCANCONF_DIRMAP
+                      |LESENSE_CTRL_BUFIDL_HALFFULL;
+    LESENSE->PERCTRL = (LESENSE->PERCTRL&~_LESENSE_PERCTRL_ACMP1MODE_MASK)
+                      |LESENSE_PERCTRL_ACMP1MODE_MUXTHRES;
+    LESENSE->DECCTRL = LESENSE_DECCTRL_DISABLE;
+
+    calibscans = -1;
+    for(i=0;i<TOUCH_N;i++) {
+        measurements[i]     = 0;
+        LESENSE->CH[TOUCH_LESCH0+i].TIMING   = (TOUCH_SAMPLEDLY<<_LESENSE_CH_TIMING_SAMPLEDLY_SHIFT);
+        LESENSE->CH[TOUCH_LESCH0+i].INTERACT = (VDIV<<_LESENSE_CH_INTERACT_THRES_SHIFT)
+                                             |LESENSE_CH_INTERACT_SAMPLE_COUNTER
+                                             |LESENSE_CH_INTERACT_SETIF_LEVEL
+                                             |LESENSE_CH_INTERACT_EXMODE_DISABLE
+                                             |LESENSE_CH_INTERACT_SAMPLECLK_LFACLK;
+        // Threshold zero means no touch until calibrated
+        LESENSE->CH[TOUCH_LESCH0+i].EVAL     = LESENSE_CH_EVAL_COMP_LESS
+                                             |LESENSE_CH_EVAL_STRSAMPLE;
+    }
+    LESENSE->CHEN = TOUCH_LESCHMASK;
+
+    NVIC_SetPriority(LESENSE_IRQn,TOUCH_INT_LEVEL);
+    NVIC_ClearPendingIRQ(LESENSE_IRQn);
+    NVIC_EnableIRQ(LESENSE_IRQn);
+
+    SetScanMode(STATE_CALIBRATING);
+}
+
+/**
+ * @brief   Set a routine to be called (from interrupt) when touch status changes
+ */
+void
+Touch_SetCallback(void (*callback)(unsigned v)) {
+
+    touchcallback = callback;
+}
+
+/**
+ * @brief   Returns 1 while touched (fast scanning), 0 when idle
+ */
+int
+Touch_IsActive(void) {
+
+    return lesensestate == STATE_TOUCHED;
+}
+
+#endif
@@ -10,9 +10,23 @@ unsigned    Touch_ReadChannel(int ch);
 int         Touch_GetCenterOfTouch(unsigned v);
 unsigned    Touch_Interpolate(unsigned v);
 
+/* Baseline tracking, position and swipe */
+int         Touch_GetPosition(void);
+int         Touch_GetVelocity(void);
+int         Touch_GetSwipe(void);
+unsigned    Touch_GetBaseline(int ch);
+
+#define TOUCH_SWIPE_NONE    0
+#define TOUCH_SWIPE_UP      1
+#define TOUCH_SWIPE_DOWN    (-1)
+
 /* Must be called periodically */
 void        Touch_PeriodicProcess(void);
 
+/* Only when using LESENSE (TOUCH_USE_LESENSE) */
+void        Touch_SetCallback(void (*callback)(unsigned v));
+int         Touch_IsActive(void);
+
 #define TOUCH_N 4
 
 #endif  // TOUCH_H
@@ -0,0 +1,568 @@
+/**
+ * @file    capture.c
+ * @brief   Input capture (period, frequency and duty cycle measurement) for EFM32GG
+ * @version 1.0
+ *
+ * @note    Uses TIMER1 and TIMER2. TIMER0 is used by the motor control mode of pwm.c
+ *          and TIMER3 by the PWM output of main.c
+ *
+ * @note    The timer runs freely from 0 to 0xFFFF and its overflow interrupt extends
+ *          it to 32 bits. Each edge is stored as a 32 bit timestamp in a ring
+ *          buffer of the channel. Results are calculated only when requested.
+ *
+ * @note    In interrupt mode, each edge generates an interrupt. In DMA mode, the
+ *          captured values are transferred by DMA (ping-pong) into two buffers and the
+ *          interrupt occurs only when one of them is full. The 32 bit timestamps are
+ *          reconstructed from the differences, so the interval between two edges must
+ *          be less than 65536 ticks. DMA mode is intended for high rate signals.
+ *
+ * @note    A longer interval (e.g. the signal stopped) is detected at the end of the
+ *          buffer, when the last timestamp is more than 65536 ticks behind the
+ *          current time. The missing overflows are added to it and the older
+ *          timestamps are discarded, so results are 0 until there are enough new edges.
+ *          It assumes the DMA interrupt is served in less than 65536 ticks.
+ *
+ * @note    Pins are the same used for PWM output (see pwm.c)
+ */
+
+
+#include <stdint.h>
+#include "em_device.h"
+#include "clock_efm32gg2.h"
+#include "gpio.h"
+#include "pwm.h"
+#include "dma.h"
+#include "capture.h"
+
+/**
+ * @brief   Timers used for capture
+ */
+static TIMER_TypeDef * const captimers[] = { TIMER1, TIMER2 };
+#define NCAPTIMERS  (sizeof(captimers)/sizeof(captimers[0]))
+
+/**
+ * @brief   Information about each channel in capture mode
+ */
+typedef struct {
+    TIMER_TypeDef      *timer;
+    uint8_t             mode;
+    uint8_t             firstrising;                /**< edge of first timestamp  */
+    int8_t              dmachn;                     /**< -1 in interrupt mode     */
+    volatile uint32_t   count;                      /**< timestamps stored        */
+    uint32_t            overruns;                   /**< captures lost            */
+    uint32_t            gaps;                       /**< intervals too long (DMA) */
+    uint32_t            valid;                      /**< first usable timestamp   */
+    uint32_t            last;                       /**< last timestamp (DMA)     */
+    uint32_t            ring[CAPTURE_RINGSIZE];
+    uint16_t            dmabuf[2][CAPTURE_DMASIZE];
+} CaptureInfo;
+
+/**
+ * @brief   static variables
+ */
+///@{
+static CaptureInfo          channels[CAPTURE_MAXCHANNELS];
+static int8_t               channelindex[NCAPTIMERS][3] = { {-1,-1,-1}, {-1,-1,-1} };
+static volatile uint32_t    timerext[NCAPTIMERS];
+static uint32_t             tickfreq[NCAPTIMERS];
+///@}
+
+/**
+ * @brief   Find index of a capture timer
+ */
+static inline int FindTimer(TIMER_TypeDef *timer) {
+
+    if( timer == TIMER1 ) return 0;
+    if( timer == TIMER2 ) return 1;
+    return -1;
+}
+
+/**
+ * @brief   Find information about a channel
+ */
+static CaptureInfo *FindChannel(TIMER_TypeDef *timer, unsigned ch) {
+int t;
+
+    t = FindTimer(timer);
+    if( t < 0 || ch > 2 || channelindex[t][ch] < 0 )
+        return 0;
+    return &channels[(int) channelindex[t][ch]];
+}
+
+/**
+ * @brief   Store a timestamp
+ */
+static inline void Store(CaptureInfo *p, uint32_t ts) {
+
+    p->ring[p->count&(CAPTURE_RINGSIZE-1)] = ts;
+    p->last = ts;
+    p->count++;
+}
+
+/**
+ * @brief   Extend a 16 bit value to 32 bits
+ *
+ * @note    If there is an overflow not yet counted and the value is small, it was
+ *          captured after the overflow
+ */
+static inline uint32_t Extend(uint32_t v, uint32_t ext, uint32_t flags) {
+
+    if( (flags&TIMER_IF_OF) && (v < 0x8000) )
+        ext++;
+    return (ext<<16)|v;
+}
+
+/**
+ * @brief   Copy the last n timestamps of a channel
+ *
+ * @note    If pcount is not null, the number of timestamps stored is returned there,
+ *          so the absolute index of ts[i] is *pcount-n+i
+ * @note    Timestamps before a gap (DMA mode) are not copied
+ *
+ * @return  number of timestamps copied (less than n if not available)
+ */
+static int CopyLast(CaptureInfo *p, uint32_t *ts, int n, uint32_t *pcount) {
+uint32_t c;
+int i;
+
+    __disable_irq();
+    c = p->count;
+    if( pcount )
+        *pcount = c;
+    if( (uint32_t) n > c-p->valid )
+        n = c-p->valid;
+    if( n > CAPTURE_RINGSIZE )
+        n = CAPTURE_RINGSIZE;
+    for(i=0;i<n;i++)
+        ts[i] = p->ring[(c-n+i)&(CAPTURE_RINGSIZE-1)];
+    __enable_irq();
+
+    return n;
+}
+
+/**
+ * @brief   Interrupt processing for a capture timer
+ */
+static void ProcessInterrupt(int t) {
+TIMER_TypeDef *timer = captimers[t];
+uint32_t flags;
+uint32_t ext;
+uint32_t v;
+int ch;
+
+    flags = timer->IF&timer->IEN;
+    timer->IFC = flags;
+
+    ext = timerext[t];
+    if( flags&TIMER_IF_OF )
+        timerext[t]++;
+
+    for(ch=0;ch<3;ch++) {
+        if( channelindex[t][ch] < 0 )
+            continue;
+        CaptureInfo *p = &channels[(int) channelindex[t][ch]];
+        if( flags&(TIMER_IF_ICBOF0<<ch) )
+            p->overruns++;
+        if( p->dmachn >= 0 )
+            continue;
+        while( timer->STATUS&(TIMER_STATUS_ICV0<<ch) ) {
+            v = timer->CC[ch].CCV;
+            // An overflow could happen after IF was read
+            Store(p,Extend(v,ext,flags|timer->IF));
+        }
+    }
+}
+
+void TIMER1_IRQHandler(void) {
+
+    ProcessInterrupt(0);
+}
+
+void TIMER2_IRQHandler(void) {
+
+    ProcessInterrupt(1);
+}
+
+/**
+ * @brief   DMA callback
+ *
+ * @note    Rebuild 32 bit timestamps from the 16 bit captures
+ * @note    The differences are taken modulo 65536, so a gap makes the last timestamp
+ *          late by a multiple of 65536 ticks. It is compared with the current time
+ *          to correct it
+ */
+static void DMACallback(int chn) {
+CaptureInfo *p;
+uint16_t *buf;
+uint32_t late;
+int i;
+
+    for(i=0;i<CAPTURE_MAXCHANNELS&&!(channels[i].timer&&channels[i].dmachn==chn);i++) {}
+    if( i == CAPTURE_MAXCHANNELS )
+        return;
+
+    p   = &channels[i];
+    buf = (uint16_t *) DMA_GetDoneBuffer(chn);
+    for(i=0;i<CAPTURE_DMASIZE;i++)
+        Store(p,p->last+(uint16_t) (buf[i]-(uint16_t) p->last));
+
+    late = Capture_Now(p->timer)-p->last;
+    if( (int32_t) late >= 0x10000 ) {
+        // Only the last timestamp is corrected. Older ones are discarded
+        p->last += late&~0xFFFFUL;
+        p->ring[(p->count-1)&(CAPTURE_RINGSIZE-1)] = p->last;
+        p->valid = p->count-1;
+        p->gaps++;
+    }
+}
+
+/**
+ * @brief   Capture_Init
+ *
+ * @note    Configure a timer for capture. The timer is started
+ *
+ * @param   timer   TIMER1 or TIMER2
+ * @param   loc     location used for pins (see pwm.c)
+ * @param   div     prescaler (rounded to the next power of 2)
+ */
+int Capture_Init(TIMER_TypeDef *timer, int loc, unsigned div) {
+static const uint32_t clocktable[] = {
+    CMU_HFPERCLKEN0_TIMER1,
+    CMU_HFPERCLKEN0_TIMER2
+};
+unsigned p;
+int t;
+
+    t = FindTimer(timer);
+    if( t < 0 )
+        return -1;
+
+    for(p=0;p<10&&(1U<<p)<div;p++) {}
+
+    CMU->HFPERCLKDIV |= CMU_HFPERCLKDIV_HFPERCLKEN;
+    CMU->HFPERCLKEN0 |= CMU_HFPERCLKEN0_GPIO|clocktable[t];
+
+    timer->CMD   = TIMER_CMD_STOP;
+    timer->CTRL  = TIMER_CTRL_MODE_UP
+                  |TIMER_CTRL_CLKSEL_PRESCHFPERCLK
+                  |(p<<_TIMER_CTRL_PRESC_SHIFT);
+    timer->TOP   = 0xFFFF;
+    timer->CNT   = 0;
+    timer->ROUTE = (loc<<_TIMER_ROUTE_LOCATION_SHIFT);
+    timer->IFC   = _TIMER_IFC_MASK;
+    timer->IEN   = TIMER_IEN_OF;
+
+    timerext[t] = 0;
+    tickfreq[t] = ClockGetPeripheralClockFrequency()>>p;
+
+    NVIC_ClearPendingIRQ(t==0?TIMER1_IRQn:TIMER2_IRQn);
+    NVIC_EnableIRQ(t==0?TIMER1_IRQn:TIMER2_IRQn);
+
+    timer->CMD   = TIMER_CMD_START;
+
+    return 0;
+}
+
+/**
+ * @brief   Capture_ConfigChannel
+ *
+ * @param   timer   TIMER1 or TIMER2 (already initialized)
+ * @param   ch      channel (0,1,2)
+ * @param   mode    CAPTURE_MODE_RISING, CAPTURE_MODE_FALLING or CAPTURE_MODE_BOTH
+ * @param   dmachn  DMA channel or -1 for interrupt mode
+ *
+ * @return  0 if OK, negative for error
+ */
+int Capture_ConfigChannel(TIMER_TypeDef *timer, unsigned ch, unsigned mode, int dmachn) {
+static const uint32_t edgetable[] = {
+    TIMER_CC_CTRL_ICEDGE_RISING,
+    TIMER_CC_CTRL_ICEDGE_FALLING,
+    TIMER_CC_CTRL_ICEDGE_BOTH
+};
+static const uint32_t dmasource[NCAPTIMERS][3] = {
+    {   DMA_CH_CTRL_SOURCESEL_TIMER1|DMA_CH_CTRL_SIGSEL_TIMER1CC0,
+        DMA_CH_CTRL_SOURCESEL_TIMER1|DMA_CH_CTRL_SIGSEL_TIMER1CC1,
+        DMA_CH_CTRL_SOURCESEL_TIMER1|DMA_CH_CTRL_SIGSEL_TIMER1CC2   },
+    {   DMA_CH_CTRL_SOURCESEL_TIMER2|DMA_CH_CTRL_SIGSEL_TIMER2CC0,
+        DMA_CH_CTRL_SOURCESEL_TIMER2|DMA_CH_CTRL_SIGSEL_TIMER2CC1,
+        DMA_CH_CTRL_SOURCESEL_TIMER2|DMA_CH_CTRL_SIGSEL_TIMER2CC2   }
+};
+CaptureInfo *p;
+GPIO_t gpio;
+int gpiopin;
+int t,i;
+
+    t = FindTimer(timer);
+    if( t < 0 || ch > 2 || mode > CAPTURE_MODE_BOTH )
+        return -1;
+    if( dmachn >= DMA_CHAN_COUNT )
+        return -1;
+
+    /* Find pin for current location */
+    gpiopin = PWM_FindPin(timer,ch,
+                (timer->ROUTE&_TIMER_ROUTE_LOCATION_MASK)>>_TIMER_ROUTE_LOCATION_SHIFT);
+    if( gpiopin < 0 )
+        return -2;
+    gpio = &(GPIO->P[gpiopin>>8]);
+
+    /* Reuse or allocate a channel */
+    if( channelindex[t][ch] >= 0 ) {
+        Capture_StopChannel(timer,ch);
+    }
+    for(i=0;i<CAPTURE_MAXCHANNELS&&channels[i].timer;i++) {}
+    if( i == CAPTURE_MAXCHANNELS )
+        return -3;
+
+    p = &channels[i];
+    p->mode     = mode;
+    p->dmachn   = dmachn;
+    p->count    = 0;
+    p->overruns = 0;
+    p->gaps     = 0;
+    p->valid    = 0;
+
+    GPIO_ConfigPins(gpio,1<<(gpiopin&0xFF),GPIO_MODE_INPUT);
+
+    timer->CC[ch].CTRL = TIMER_CC_CTRL_MODE_INPUTCAPTURE
+                        |TIMER_CC_CTRL_INSEL_PIN
+                        |TIMER_CC_CTRL_FILT_ENABLE
+                        |TIMER_CC_CTRL_ICEVCTRL_EVERYEDGE
+                        |edgetable[mode];
+    timer->ROUTE |= (TIMER_ROUTE_CC0PEN<<ch);
+
+    /* Next edge is rising if input is low now */
+    p->firstrising = (GPIO_ReadPins(gpio)&(1<<(gpiopin&0xFF))) == 0;
+
+    /* Discard old captures */
+    while( timer->STATUS&(TIMER_STATUS_ICV0<<ch) )
+        (void) timer->CC[ch].CCV;
+    timer->IFC = (TIMER_IFC_CC0|TIMER_IFC_ICBOF0)<<ch;
+
+    __disable_irq();
+    p->timer = timer;
+    channelindex[t][ch] = i;
+    p->last = Extend(timer->CNT,timerext[t],timer->IF);
+    __enable_irq();
+
+    if( dmachn >= 0 ) {
+        if( (DMA->STATUS&DMA_STATUS_EN) == 0 )
+            DMA_Init(0);
+        timer->IEN |= (TIMER_IEN_ICBOF0<<ch);
+        if( DMA_StartPingPongRx(dmachn,dmasource[t][ch],&(timer->CC[ch].CCV),
+                                p->dmabuf[0],p->dmabuf[1],CAPTURE_DMASIZE,DMACallback) < 0 ) {
+            Capture_StopChannel(timer,ch);
+            return -4;
+        }
+    } else {
+        timer->IEN |= (TIMER_IEN_CC0|TIMER_IEN_ICBOF0)<<ch;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief   Capture_StopChannel
+ */
+int Capture_StopChannel(TIMER_TypeDef *timer, unsigned ch) {
+CaptureInfo *p;
+int t;
+
+    p = FindChannel(timer,ch);
+    if( p == 0 )
+        return -1;
+    t = FindTimer(timer);
+
+    timer->IEN &= ~((TIMER_IEN_CC0|TIMER_IEN_ICBOF0)<<ch);
+    timer->CC[ch].CTRL = TIMER_CC_CTRL_MODE_OFF;
+    timer->ROUTE &= ~(TIMER_ROUTE_CC0PEN<<ch);
+    if( p->dmachn >= 0 )
+        DMA_Stop(p->dmachn);
+
+    __disable_irq();
+    channelindex[t][ch] = -1;
+    p->timer = 0;
+    __enable_irq();
+
+    return 0;
+}
+
+/**
+ * @brief   Return the frequency of the timer clock (ticks per second)
+ */
+uint32_t Capture_GetTickFrequency(TIMER_TypeDef *timer) {
+int t;
+
+    t = FindTimer(timer);
+    return t < 0 ? 0 : tickfreq[t];
+}
+
+/**
+ * @brief   Return current time (32 bits) in ticks
+ *
+ * @note    Can be compared with the timestamps to detect a stopped signal
+ */
+uint32_t Capture_Now(TIMER_TypeDef *timer) {
+uint32_t v;
+int t;
+
+    t = FindTimer(timer);
+    if( t < 0 )
+        return 0;
+
+    __disable_irq();
+    v = Extend(timer->CNT,timerext[t],timer->IF);
+    __enable_irq();
+    return v;
+}
+
+/**
+ * @brief   Return number of edges captured
+ */
+uint32_t Capture_GetCount(TIMER_TypeDef *timer, unsigned ch) {
+CaptureInfo *p = FindChannel(timer,ch);
+
+    return p ? p->count : 0;
+}
+
+/**
+ * @brief   Return number of captures lost (capture buffer overflow)
+ */
+uint32_t Capture_GetOverruns(TIMER_TypeDef *timer, unsigned ch) {
+CaptureInfo *p = FindChannel(timer,ch);
+
+    return p ? p->overruns : 0;
+}
+
+/**
+ * @brief   Return number of intervals too long for DMA mode (see DMACallback)
+ */
+uint32_t Capture_GetGaps(TIMER_TypeDef *timer, unsigned ch) {
+CaptureInfo *p = FindChannel(timer,ch);
+
+    return p ? p->gaps : 0;
+}
+
+/**
+ * @brief   Read the last n timestamps (oldest first)
+ *
+ * @return  number of timestamps read
+ */
+int Capture_Read(TIMER_TypeDef *timer, unsigned ch, uint32_t *ts, int n) {
+CaptureInfo *p = FindChannel(timer,ch);
+
+    if( p == 0 || n <= 0 )
+        return 0;
+    return CopyLast(p,ts,n,0);
+}
+
+/**
+ * @brief   Return the time in ticks spanned by the last n periods
+ *
+ * @return  span or 0 if there are not enough edges
+ */
+static uint32_t GetSpan(CaptureInfo *p, int n) {
+uint32_t ts[CAPTURE_RINGSIZE];
+int m;
+
+    if( p == 0 || n <= 0 )
+        return 0;
+
+    // Both edges: two timestamps per period
+    m = (p->mode == CAPTURE_MODE_BOTH) ? 2*n+1 : n+1;
+    if( m > CAPTURE_RINGSIZE || CopyLast(p,ts,m,0) < m )
+        return 0;
+
+    return ts[m-1]-ts[0];
+}
+
+/**
+ * @brief   Return average period of the last n periods in ticks
+ *
+ * @return  period or 0 if there are not enough edges
+ */
+uint32_t Capture_GetPeriod(TIMER_TypeDef *timer, unsigned ch, int n) {
+
+    return GetSpan(FindChannel(timer,ch),n)/(n>0?n:1);
+}
+
+/**
+ * @brief   Return median of the last n periods in ticks
+ *
+ * @note    Insensitive to isolated glitches
+ *
+ * @return  period or 0 if there are not enough edges
+ */
+uint32_t Capture_GetMedianPeriod(TIMER_TypeDef *timer, unsigned ch, int n) {
+CaptureInfo *p = FindChannel(timer,ch);
+uint32_t ts[CAPTURE_RINGSIZE];
+uint32_t periods[CAPTURE_RINGSIZE];
+uint32_t v;
+int m,k,i,j;
+
+    if( p == 0 || n <= 0 )
+        return 0;
+
+    k = (p->mode == CAPTURE_MODE_BOTH) ? 2 : 1;
+    m = n+k;
+    if( m > CAPTURE_RINGSIZE || CopyLast(p,ts,m,0) < m )
+        return 0;
+
+    // Insertion sort
+    for(i=0;i<n;i++) {
+        v = ts[i+k]-ts[i];
+        for(j=i;j>0&&periods[j-1]>v;j--)
+            periods[j] = periods[j-1];
+        periods[j] = v;
+    }
+
+    return periods[n/2];
+}
+
+/**
+ * @brief   Return frequency averaged over the last n periods in mHz
+ *
+ * @return  frequency or 0 if there are not enough edges
+ */
+uint32_t Capture_GetFrequency(TIMER_TypeDef *timer, unsigned ch, int n) {
+uint32_t span;
+
+    span = GetSpan(FindChannel(timer,ch),n);
+    if( span == 0 )
+        return 0;
+
+    return (uint32_t) (((uint64_t) Capture_GetTickFrequency(timer)*1000*n)/span);
+}
+
+/**
+ * @brief   Return duty cycle averaged over the last n periods in 0.01 %
+ *
+ * @note    Only in CAPTURE_MODE_BOTH
+ *
+ * @return  duty cycle (0 to 10000) or 0 if there are not enough edges
+ */
+uint32_t Capture_GetDuty(TIMER_TypeDef *timer, unsigned ch, int n) {
+CaptureInfo *p = FindChannel(timer,ch);
+uint32_t ts[CAPTURE_RINGSIZE];
+uint32_t c,high,total;
+int m,i;
+
+    if( p == 0 || n <= 0 || p->mode != CAPTURE_MODE_BOTH )
+        return 0;
+
+    m = 2*n+1;
+    if( m > CAPTURE_RINGSIZE || CopyLast(p,ts,m,&c) < m )
+        return 0;
+
+    // Timestamp k (absolute) is a rising edge if k has the parity of the first one
+    high = 0;
+    for(i=0;i<m-1;i++) {
+        uint32_t k = c-m+i;
+        if( ((k&1) == 0) == (p->firstrising != 0) )
+            high += ts[i+1]-ts[i];
+    }
+    total = ts[m-1]-ts[0];
+    if( total == 0 )
+        return 0;
+
+    return (uint32_t) (((uint64_t) high*10000)/total);
+}
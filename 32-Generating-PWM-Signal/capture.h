@@ -0,0 +1,50 @@
+#ifndef CAPTURE_H
+#define CAPTURE_H
+/**
+ * @file    capture.h
+ */
+
+#include <stdint.h>
+#include "em_device.h"
+
+/**
+ * @brief   Number of channels that can be in capture mode at the same time
+ */
+#define CAPTURE_MAXCHANNELS                   6
+
+/**
+ * @brief   Timestamps kept for each channel (power of 2)
+ */
+#define CAPTURE_RINGSIZE                      32
+
+/**
+ * @brief   Number of captures in each DMA buffer
+ */
+#define CAPTURE_DMASIZE                       16
+
+/**
+ * @brief   Capture modes
+ */
+///{
+#define CAPTURE_MODE_RISING                   0       // Period between rising edges
+#define CAPTURE_MODE_FALLING                  1       // Period between falling edges
+#define CAPTURE_MODE_BOTH                     2       // Period and duty cycle
+///}
+
+int      Capture_Init(TIMER_TypeDef *timer, int loc, unsigned div);
+int      Capture_ConfigChannel(TIMER_TypeDef *timer, unsigned ch, unsigned mode, int dmachn);
+int      Capture_StopChannel(TIMER_TypeDef *timer, unsigned ch);
+
+uint32_t Capture_GetTickFrequency(TIMER_TypeDef *timer);
+uint32_t Capture_Now(TIMER_TypeDef *timer);
+uint32_t Capture_GetCount(TIMER_TypeDef *timer, unsigned ch);
+uint32_t Capture_GetOverruns(TIMER_TypeDef *timer, unsigned ch);
+uint32_t Capture_GetGaps(TIMER_TypeDef *timer, unsigned ch);
+int      Capture_Read(TIMER_TypeDef *timer, unsigned ch, uint32_t *ts, int n);
+
+uint32_t Capture_GetPeriod(TIMER_TypeDef *timer, unsigned ch, int n);
+uint32_t Capture_GetMedianPeriod(TIMER_TypeDef *timer, unsigned ch, int n);
+uint32_t Capture_GetFrequency(TIMER_TypeDef *timer, unsigned ch, int n);
+uint32_t Capture_GetDuty(TIMER_TypeDef *timer, unsigned ch, int n);
+
+#endif  // CAPTURE_H
@@ -24,7 +24,19 @@
  * TIMER3  | CC0     |PE14|PE0 |    |    |    |    |    |    |
  * TIMER3  | CC1     |PE15|PE1 |    |    |    |    |    |    |
  * TIMER3  | CC2     |PA15|PE2 |    |    |    |    |    |    |
+ * TIMER0  | CDTI0   |PA3 |PC13|PF3 |PC13|PC2 |PF3 |    |    |
+ * TIMER0  | CDTI1   |PA4 |PC14|PF4 |PC14|PC3 |PF4 |    |    |
+ * TIMER0  | CDTI2   |PA5 |PC15|PF5 |PC15|PC4 |PF5 |    |    |
  *
+ * @note    In motor control mode (TIMER0 only), the Dead Time Insertion unit generates
+ *          complementary outputs (CCx and CDTIx) with dead time. The three duty values
+ *          are updated together in the same PWM period. A fault signal from the PRS
+ *          puts the outputs in a safe state, without CPU intervention.
+ *
+ * @note    In waveform mode, a DMA channel writes a new compare value into CCVB on
+ *          each timer overflow, so the duty cycle follows a table without CPU
+ *          intervention. Two buffers are used in ping-pong mode: while one is
+ *          transferred, the other one can be refilled in a callback.
  *
  */
 
@@ -33,6 +45,7 @@
 #include "em_device.h"
 #include "gpio.h"
 #include "pwm.h"
+#include "dma.h"
 
 
 /**
@@ -79,7 +92,7 @@ static const int NumberOfTimers = sizeof(timerlist)/sizeof(TIMER_TypeDef *)-1;
  *         $$ index = (t*4)+c $$
  */
 static uint8_t timer_initialized = 0;
-static uint8_t channel_initialized = 0;
+static uint16_t channel_initialized = 0;
 
 /**
  * @brief   Standard C Macro Utilities
@@ -183,6 +196,28 @@ static const TimerPin timerpins[] = {
 
     {   TCL(3,2,0),     PA(15) },
     {   TCL(3,2,1),     PE(2)  }, // LED2
+
+    /* Complementary outputs of TIMER0 as channels 3 (CDTI0), 4 (CDTI1) and 5 (CDTI2) */
+    {   TCL(0,3,0),     PA(3)  },
+    {   TCL(0,3,1),     PC(13) },
+    {   TCL(0,3,2),     PF(3)  },
+    {   TCL(0,3,3),     PC(13) },
+    {   TCL(0,3,4),     PC(2)  },
+    {   TCL(0,3,5),     PF(3)  },
+
+    {   TCL(0,4,0),     PA(4)  },
+    {   TCL(0,4,1),     PC(14) },
+    {   TCL(0,4,2),     PF(4)  },
+    {   TCL(0,4,3),     PC(14) },
+    {   TCL(0,4,4),     PC(3)  },
+    {   TCL(0,4,5),     PF(4)  },
+
+    {   TCL(0,5,0),     PA(5)  },
+    {   TCL(0,5,1),     PC(15) },
+    {   TCL(0,5,2),     PF(5)  },
+    {   TCL(0,5,3),     PC(15) },
+    {   TCL(0,5,4),     PC(4)  },
+    {   TCL(0,5,5),     PF(5)  },
     {           -1,     0      }
 };
 
@@ -210,19 +245,22 @@ void PWM_Stop(TIMER_TypeDef* timer) {
 
 /**
  * @brief  FindTimerIndex
- * 
+ *
+ * @note   Timers are spaced by a constant offset, so the index is calculated from the
+ *         address and checked against the list. No search is needed.
+ *
  * @param timer 
  * @return int 
  */
 
 static inline int FindTimerIndex(TIMER_TypeDef *timer) {
-int t;
+uint32_t t;
 
-    for(t=0;timerlist[t]&&(timerlist[t]!=timer);t++) {}
-    if( timerlist[t] == 0 )
+    t = ((uint32_t) timer-TIMER0_BASE)/(TIMER1_BASE-TIMER0_BASE);
+    if( t >= (uint32_t) NumberOfTimers || timerlist[t] != timer )
         return -1;
 
-    return t;
+    return (int) t;
 }
 
 
@@ -374,45 +412,72 @@ unsigned d;
 
 
 /**
- * @brief    PWM_ConfigOutputPin
+ * @brief    PWM_FindPin
  *
- * @note     local function to configure the pin associdated to a channel to be used as output
+ * @note     Find the pin used by a channel of a timer at a location
  *
  * @param    timer Pointer to timer as defined by the efm32gg headers (em_device.h *)
  *
- * @param    channel  Channel number (0,1,2)
+ * @param    ch       Channel number (0,1,2 or 3,4,5 for CDTI0-CDTI2 of TIMER0)
  *
- * @param    location location used for pins as defined in Table 4.2. Alternate functionality overview of
- *           datasheet
+ * @param    loc      location
+ *
+ * @return   GPIO number in bits 15-8 and pin number in bits 7-0 or -1 if not found
  */
-
-static int PWM_ConfigOutputPin(TIMER_TypeDef* timer, unsigned ch, unsigned loc ) {
-unsigned t;
+int PWM_FindPin(TIMER_TypeDef *timer, unsigned ch, unsigned loc) {
+int t;
 int16_t key;
 TimerPin const *ptimerpin;
-GPIO_P_TypeDef *gpio;
-unsigned gpion,pinn;
 
-    /* Finds the index of a timer */
     t = FindTimerIndex(timer);
     if( t < 0 )
         return -1;
 
-    // Configure GPIO pin
     key = TCL(t,ch,loc);
 
-    // It uses a linear search!!!
+    // It uses a linear search, but only at configuration
     ptimerpin = timerpins;
     while( (ptimerpin->timer_channel_loc >= 0)
         && (ptimerpin->timer_channel_loc != key) ) {
         ptimerpin++;
     }
     if( ptimerpin->timer_channel_loc != key ) /* Not found */
+        return -1;
+
+    return ptimerpin->gpio_pin;
+}
+
+/**
+ * @brief    PWM_ConfigOutputPin
+ *
+ * @note     local function to configure the pin associdated to a channel to be used as output
+ *
+ * @param    timer Pointer to timer as defined by the efm32gg headers (em_device.h *)
+ *
+ * @param    channel  Channel number (0,1,2)
+ *
+ * @param    location location used for pins as defined in Table 4.2. Alternate functionality overview of
+ *           datasheet
+ */
+
+static int PWM_ConfigOutputPin(TIMER_TypeDef* timer, unsigned ch, unsigned loc ) {
+int t;
+int gpiopin;
+GPIO_P_TypeDef *gpio;
+unsigned gpion,pinn;
+
+    /* Finds the index of a timer */
+    t = FindTimerIndex(timer);
+    if( t < 0 )
+        return -1;
+
+    gpiopin = PWM_FindPin(timer,ch,loc);
+    if( gpiopin < 0 )   /* Not found */
         return -2;
 
     /* Get GPIO number and pin number */
-    gpion = (ptimerpin->gpio_pin)>>8;
-    pinn =  (ptimerpin->gpio_pin)&0xFF;
+    gpion = gpiopin>>8;
+    pinn =  gpiopin&0xFF;
 
     gpio = &(GPIO->P[gpion]); /* Get GPIO Pointer */
 
@@ -565,4 +630,464 @@ int rc;
     PWM_Start(timer);
 
     return 0;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief   Waveform mode information
+ *
+ * @note    Indexed by the timer index
+ */
+typedef struct {
+    int         dmachn;                             /**< DMA channel (-1 if not used) */
+    int         n;                                  /**< halfwords in each buffer     */
+    void        (*refill)(uint16_t *buf, int n);    /**< refill callback              */
+} WaveformInfo;
+
+static WaveformInfo waveforminfo[] = {
+    { -1, 0, 0 },
+    { -1, 0, 0 },
+    { -1, 0, 0 },
+    { -1, 0, 0 }
+};
+
+/**
+ * @brief   Timer index for each DMA channel used in waveform mode
+ */
+static int8_t dmatimer[DMA_CHAN_COUNT];
+
+/**
+ * @brief   DMA callback for waveform mode
+ *
+ * @note    Called in DMA interrupt, when a buffer has been transferred. The descriptor
+ *          was already rearmed, so the buffer will be transferred again after the
+ *          other one.
+ */
+static void WaveformCallback(int chn) {
+WaveformInfo *pinfo = &waveforminfo[dmatimer[chn]];
+
+    if( pinfo->refill )
+        pinfo->refill((uint16_t *) DMA_GetDoneBuffer(chn),pinfo->n);
+}
+
+/**
+ * @brief   PWM_StartWaveform
+ *
+ * @note    Starts a DMA channel to update the compare value of a channel on
+ *          each overflow of the timer
+ *
+ * @param   timer    Pointer to timer as defined by the efm32gg headers (em_device.h *)
+ * @param   channel  Channel number (0,1,2). It must be already configured
+ * @param   dmachn   DMA channel to be used
+ * @param   buf0     First buffer with compare values
+ * @param   buf1     Second buffer with compare values. If null, buf0 is used, i.e., the
+ *                   table is repeated endlessly
+ * @param   n        Number of values in each buffer (1 to 1024)
+ * @param   refill   Called with the buffer just transferred, so it can be refilled.
+ *                   Can be null. If not null, the buffers must be in RAM
+ *
+ * @note    The value of each buffer is used for a complete PWM period
+ */
+int PWM_StartWaveform(TIMER_TypeDef *timer, unsigned channel, int dmachn,
+                      const uint16_t *buf0, const uint16_t *buf1, int n,
+                      void (*refill)(uint16_t *buf, int n)) {
+static const uint32_t dmasource[] = {
+    DMA_CH_CTRL_SOURCESEL_TIMER0|DMA_CH_CTRL_SIGSEL_TIMER0UFOF,
+    DMA_CH_CTRL_SOURCESEL_TIMER1|DMA_CH_CTRL_SIGSEL_TIMER1UFOF,
+    DMA_CH_CTRL_SOURCESEL_TIMER2|DMA_CH_CTRL_SIGSEL_TIMER2UFOF,
+    DMA_CH_CTRL_SOURCESEL_TIMER3|DMA_CH_CTRL_SIGSEL_TIMER3UFOF
+};
+int t;
+
+    /* Finds the index of a timer */
+    t = FindTimerIndex(timer);
+    if( t < 0 )
+        return -1;
+
+    if( channel > 2 || (channel_initialized&(1<<(t*4+channel))) == 0 )
+        return -2;
+
+    if( dmachn < 0 || dmachn >= DMA_CHAN_COUNT )
+        return -3;
+
+    if( buf1 == 0 )
+        buf1 = buf0;
+
+    /* Enable DMA if not done before */
+    if( (DMA->STATUS&DMA_STATUS_EN) == 0 )
+        DMA_Init(0);
+
+    waveforminfo[t].dmachn = dmachn;
+    waveforminfo[t].n      = n;
+    waveforminfo[t].refill = refill;
+    dmatimer[dmachn]       = t;
+
+    /* Clear DMA request when DMA is active */
+    timer->CTRL |= TIMER_CTRL_DMACLRACT;
+
+    if( DMA_StartPingPong(dmachn,dmasource[t],&(timer->CC[channel].CCVB),
+                          (void *) buf0,(void *) buf1,n,WaveformCallback) < 0 ) {
+        waveforminfo[t].dmachn = -1;
+        return -4;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief   PWM_StopWaveform
+ *
+ * @note    Stops the DMA channel. The last compare value is kept
+ */
+void PWM_StopWaveform(TIMER_TypeDef *timer) {
+int t;
+
+    t = FindTimerIndex(timer);
+    if( t < 0 || waveforminfo[t].dmachn < 0 )
+        return;
+
+    DMA_Stop(waveforminfo[t].dmachn);
+    waveforminfo[t].dmachn = -1;
+}
+
+/**
+ * @brief   Motor control mode
+ *
+ * @note    Only TIMER0 has a Dead Time Insertion unit
+ *
+ * @note    When the timer is too near the overflow, the duty values are not written
+ *          directly to CCVB, because the overflow could happen between writes. They are
+ *          written in the overflow interrupt, so all three are used in the same period.
+ */
+///@{
+#define MOTORGUARD          32          // Minimal number of ticks before overflow
+
+struct PWM_Motor_Struct {
+    TIMER_TypeDef      *timer;          /**< Timer (always TIMER0)           */
+    uint32_t            top;            /**< Timer top value                 */
+    uint16_t            pending[3];     /**< Duty values for next period     */
+    volatile uint8_t    haspending;     /**< Values to be written in IRQ     */
+};
+
+static PWM_MotorType motor = { 0 };
+///@}
+
+/**
+ * @brief   PWM_MotorInit
+ *
+ * @note    Configure TIMER0 with complementary outputs and dead time.
+ *          Timer is not started. Use PWM_MotorStart.
+ *
+ * @param   loc       location used for pins (CC0-CC2 and CDTI0-CDTI2)
+ * @param   top       Timer top value. PWM frequency is HFPERCLK/(top+1)
+ * @param   deadtime  Dead time in HFPERCLK cycles (1 to 65536). It is rounded up when a
+ *                    prescaler is needed
+ * @param   params    OR of PWM_MOTOR_PARAMS_x values
+ *
+ * @note    Initial duty is zero, i.e., CCx outputs inactive and CDTIx outputs active
+ *
+ * @return  handle or null if parameters are invalid
+ */
+PWM_MotorType *PWM_MotorInit(int loc, unsigned top, unsigned deadtime, unsigned params) {
+TIMER_TypeDef *timer = TIMER0;
+unsigned dtpresc;
+unsigned dtcycles;
+uint32_t dtctrl;
+int ch;
+
+    if( top == 0 || top > MAXTIMER || deadtime == 0 || loc < 0 || loc > 5 )
+        return 0;
+
+    /* Find the smallest prescaler for dead time: 6 bit counter */
+    for(dtpresc=0;dtpresc<=10&&deadtime>(64U<<dtpresc);dtpresc++) {}
+    if( dtpresc > 10 )
+        return 0;
+    dtcycles = (deadtime+(1U<<dtpresc)-1)>>dtpresc;
+
+    /* Stops timer and configure it with no prescaler */
+    if( PWM_ConfigTimer(timer,1,top) < 0 )
+        return 0;
+
+    timer->IEN &= ~TIMER_IEN_OF;
+    motor.timer      = timer;
+    motor.top        = top;
+    motor.haspending = 0;
+
+    /* Configure channels with zero duty */
+    for(ch=0;ch<3;ch++) {
+        timer->CC[ch].CTRL = TIMER_CC_CTRL_MODE_PWM;
+        timer->CC[ch].CCVB = 0;
+        timer->CC[ch].CCV  = 0;
+        channel_initialized |= (1<<ch);
+    }
+
+    /* Configure pins for CC0-CC2 and CDTI0-CDTI2 */
+    for(ch=0;ch<6;ch++) {
+        if( PWM_ConfigOutputPin(timer,ch,loc) < 0 )
+            return 0;
+    }
+
+    /* Dead time */
+    timer->DTTIME = (dtpresc<<_TIMER_DTTIME_DTPRESC_SHIFT)
+                   |((dtcycles-1)<<_TIMER_DTTIME_DTRISET_SHIFT)
+                   |((dtcycles-1)<<_TIMER_DTTIME_DTFALLT_SHIFT);
+
+    /* No fault source until PWM_MotorConfigFault. Lockup always stops the outputs */
+    timer->DTFC = TIMER_DTFC_DTFA_INACTIVE
+                 |TIMER_DTFC_DTLOCKUPFEN
+                 |((params&PWM_MOTOR_PARAMS_DEBUGFAULT)?TIMER_DTFC_DTDBGFEN:0);
+    timer->DTFAULTC = TIMER_DTFAULTC_DTPRS0FC|TIMER_DTFAULTC_DTPRS1FC
+                     |TIMER_DTFAULTC_DTDBGFC|TIMER_DTFAULTC_DTLOCKUPFC;
+
+    /* All outputs generated by DTI */
+    timer->DTOGEN = PWM_MOTOR_OUT_ALL;
+
+    dtctrl = TIMER_DTCTRL_DTEN;
+    if( params&PWM_MOTOR_PARAMS_INVERTPOL )
+        dtctrl |= TIMER_DTCTRL_DTIPOL;
+    if( params&PWM_MOTOR_PARAMS_INVERTCOMPL )
+        dtctrl |= TIMER_DTCTRL_DTCINV;
+    if( params&PWM_MOTOR_PARAMS_AUTORESTART )
+        dtctrl |= TIMER_DTCTRL_DTDAS;
+    timer->DTCTRL = dtctrl;
+
+    /* Route all six outputs */
+    timer->ROUTE = TIMER_ROUTE_CC0PEN|TIMER_ROUTE_CC1PEN|TIMER_ROUTE_CC2PEN
+                  |TIMER_ROUTE_CDTI0PEN|TIMER_ROUTE_CDTI1PEN|TIMER_ROUTE_CDTI2PEN
+                  |(loc<<_TIMER_ROUTE_LOCATION_SHIFT);
+
+    /* Overflow interrupt is enabled only when there are pending values */
+    timer->IFC = TIMER_IFC_OF;
+    NVIC_ClearPendingIRQ(TIMER0_IRQn);
+    NVIC_EnableIRQ(TIMER0_IRQn);
+
+    return &motor;
+}
+
+/**
+ * @brief   PWM_MotorStart
+ */
+void PWM_MotorStart(PWM_MotorType *m) {
+
+    if( m && m->timer )
+        PWM_Start(m->timer);
+}
+
+/**
+ * @brief   PWM_MotorStop
+ *
+ * @note    Outputs keep the last level. Set duty to zero before stopping
+ */
+void PWM_MotorStop(PWM_MotorType *m) {
+
+    if( m && m->timer )
+        PWM_Stop(m->timer);
+}
+
+/**
+ * @brief   Return top value
+ *
+ * @note    Duty values are in the range 0 to top
+ */
+unsigned PWM_MotorGetTop(PWM_MotorType *m) {
+
+    if( m == 0 )
+        return 0;
+    return m->top;
+}
+
+/**
+ * @brief   PWM_MotorWrite
+ *
+ * @note    Set duty values for the three phases. They are used in the same PWM period.
+ *
+ * @note    Values are written to CCVB and transferred to CCV at the next overflow.
+ *          If the overflow is too near, they are written in the overflow interrupt,
+ *          and are used one period later.
+ *
+ * @param   m           handle returned by PWM_MotorInit
+ * @param   d0,d1,d2    duty values (0 to top). Greater values are saturated
+ */
+int PWM_MotorWrite(PWM_MotorType *m, unsigned d0, unsigned d1, unsigned d2) {
+TIMER_TypeDef *timer;
+uint32_t cnt;
+
+    if( m == 0 || m->timer == 0 )
+        return -1;
+
+    timer = m->timer;
+    if( d0 > m->top ) d0 = m->top;
+    if( d1 > m->top ) d1 = m->top;
+    if( d2 > m->top ) d2 = m->top;
+
+    __disable_irq();
+    cnt = timer->CNT;
+    if( (timer->STATUS&TIMER_STATUS_RUNNING) == 0 || (m->top-cnt) > MOTORGUARD ) {
+        timer->CC[0].CCVB = d0;
+        timer->CC[1].CCVB = d1;
+        timer->CC[2].CCVB = d2;
+        m->haspending = 0;
+        timer->IEN &= ~TIMER_IEN_OF;
+    } else {
+        m->pending[0] = d0;
+        m->pending[1] = d1;
+        m->pending[2] = d2;
+        m->haspending = 1;
+        timer->IFC = TIMER_IFC_OF;
+        timer->IEN |= TIMER_IEN_OF;
+    }
+    __enable_irq();
+
+    return 0;
+}
+
+/**
+ * @brief   PWM_MotorSetOutputs
+ *
+ * @note    Enable DTI generation for the outputs in mask (OR of PWM_MOTOR_OUT_x).
+ *          Outputs not enabled are controlled by the GPIO (DOUT). Can be used for
+ *          block commutation.
+ */
+void PWM_MotorSetOutputs(PWM_MotorType *m, unsigned mask) {
+
+    if( m == 0 || m->timer == 0 )
+        return;
+    m->timer->DTOGEN = mask&PWM_MOTOR_OUT_ALL;
+}
+
+/**
+ * @brief   PWM_MotorConfigFault
+ *
+ * @note    Configure fault sources and action
+ *
+ * @param   m       handle returned by PWM_MotorInit
+ * @param   prsch0  PRS channel for fault source 0 (-1 to disable)
+ * @param   prsch1  PRS channel for fault source 1 (-1 to disable)
+ * @param   action  PWM_MOTOR_FAULT_x
+ *
+ * @note    Must be called before PWM_MotorLock
+ */
+int PWM_MotorConfigFault(PWM_MotorType *m, int prsch0, int prsch1, unsigned action) {
+static const uint32_t actiontable[] = {
+    TIMER_DTFC_DTFA_NONE,
+    TIMER_DTFC_DTFA_INACTIVE,
+    TIMER_DTFC_DTFA_CLEAR,
+    TIMER_DTFC_DTFA_TRISTATE
+};
+uint32_t dtfc;
+
+    if( m == 0 || m->timer == 0 )
+        return -1;
+    if( prsch0 >= PRS_CHAN_COUNT || prsch1 >= PRS_CHAN_COUNT || action > PWM_MOTOR_FAULT_TRISTATE )
+        return -2;
+
+    dtfc = (m->timer->DTFC&(TIMER_DTFC_DTDBGFEN|TIMER_DTFC_DTLOCKUPFEN))
+          |actiontable[action];
+    if( prsch0 >= 0 )
+        dtfc |= (prsch0<<_TIMER_DTFC_DTPRS0FSEL_SHIFT)|TIMER_DTFC_DTPRS0FEN;
+    if( prsch1 >= 0 )
+        dtfc |= (prsch1<<_TIMER_DTFC_DTPRS1FSEL_SHIFT)|TIMER_DTFC_DTPRS1FEN;
+    m->timer->DTFC = dtfc;
+
+    return 0;
+}
+
+/**
+ * @brief   PWM_MotorConfigFaultPin
+ *
+ * @note    Route a GPIO pin to a PRS channel and use it as fault source 0
+ *
+ * @note    The PRS channel generates a pulse on the active edge of the pin
+ *
+ * @param   m         handle returned by PWM_MotorInit
+ * @param   gpio      GPIO port of fault pin
+ * @param   pin       pin number (0-15)
+ * @param   prsch     PRS channel to be used
+ * @param   activelow 1 when fault is signaled by a falling edge, 0 for a rising edge
+ * @param   action    PWM_MOTOR_FAULT_x
+ */
+int PWM_MotorConfigFaultPin(PWM_MotorType *m, GPIO_t gpio, int pin, int prsch,
+                            int activelow, unsigned action) {
+uint32_t port;
+uint32_t ppos;
+
+    if( pin < 0 || pin > 15 || prsch < 0 || prsch >= PRS_CHAN_COUNT )
+        return -2;
+
+    port = gpio-GPIO->P;
+
+    CMU->HFPERCLKEN0 |= CMU_HFPERCLKEN0_GPIO|CMU_HFPERCLKEN0_PRS;
+
+    GPIO_ConfigPins(gpio,1<<pin,GPIO_MODE_INPUT);
+
+    /* Pin number is routed from the selected port */
+    ppos = (pin&7)*4;
+    if( pin < 8 ) {
+        GPIO->EXTIPSELL = (GPIO->EXTIPSELL&~(0xF<<ppos))|(port<<ppos);
+    } else {
+        GPIO->EXTIPSELH = (GPIO->EXTIPSELH&~(0xF<<ppos))|(port<<ppos);
+    }
+    GPIO->INSENSE |= GPIO_INSENSE_PRS;
+
+    PRS->CH[prsch].CTRL = (pin<8?PRS_CH_CTRL_SOURCESEL_GPIOL:PRS_CH_CTRL_SOURCESEL_GPIOH)
+                         |((pin&7)<<_PRS_CH_CTRL_SIGSEL_SHIFT)
+                         |(activelow?PRS_CH_CTRL_EDSEL_NEGEDGE:PRS_CH_CTRL_EDSEL_POSEDGE);
+
+    return PWM_MotorConfigFault(m,prsch,-1,action);
+}
+
+/**
+ * @brief   PWM_MotorGetFault
+ *
+ * @return  Fault status (0 when there is no fault)
+ */
+uint32_t PWM_MotorGetFault(PWM_MotorType *m) {
+
+    if( m == 0 || m->timer == 0 )
+        return 0;
+    return m->timer->DTFAULT;
+}
+
+/**
+ * @brief   PWM_MotorClearFault
+ *
+ * @note    Outputs are enabled again. Fault cause must be removed before.
+ */
+void PWM_MotorClearFault(PWM_MotorType *m) {
+
+    if( m == 0 || m->timer == 0 )
+        return;
+    m->timer->DTFAULTC = TIMER_DTFAULTC_DTPRS0FC|TIMER_DTFAULTC_DTPRS1FC
+                        |TIMER_DTFAULTC_DTDBGFC|TIMER_DTFAULTC_DTLOCKUPFC;
+}
+
+/**
+ * @brief   PWM_MotorLock
+ *
+ * @note    Lock DTI configuration (DTCTRL, DTTIME and DTFC) against accidental writes
+ */
+void PWM_MotorLock(PWM_MotorType *m) {
+
+    if( m == 0 || m->timer == 0 )
+        return;
+    m->timer->DTLOCK = TIMER_DTLOCK_LOCKKEY_LOCK;
+}
+
+/**
+ * @brief   TIMER0 interrupt handler
+ *
+ * @note    Used in motor control mode to write pending duty values just after the
+ *          overflow, when there is a full period to do it
+ */
+void TIMER0_IRQHandler(void) {
+
+    if( TIMER0->IF&TIMER_IF_OF ) {
+        TIMER0->IFC = TIMER_IFC_OF;
+        if( motor.haspending ) {
+            TIMER0->CC[0].CCVB = motor.pending[0];
+            TIMER0->CC[1].CCVB = motor.pending[1];
+            TIMER0->CC[2].CCVB = motor.pending[2];
+            motor.haspending = 0;
+        }
+        TIMER0->IEN &= ~TIMER_IEN_OF;
+    }
+}
@@ -4,6 +4,10 @@
  * @file    pwm.h
  */
 
+#include <stdint.h>
+#include "em_device.h"
+#include "gpio.h"
+
 
 /**
  * @brief   location options
@@ -56,6 +60,50 @@ int  PWM_Read(TIMER_TypeDef* timer, unsigned channel);
 int  PWM_Write(TIMER_TypeDef *timer, unsigned channel, unsigned value);
 
 int  PWM_ReconfigureChannel(TIMER_TypeDef* timer, int channel, unsigned top);
+int  PWM_FindPin(TIMER_TypeDef *timer, unsigned ch, unsigned loc);
+
+int  PWM_StartWaveform(TIMER_TypeDef *timer, unsigned channel, int dmachn,
+                       const uint16_t *buf0, const uint16_t *buf1, int n,
+                       void (*refill)(uint16_t *buf, int n));
+void PWM_StopWaveform(TIMER_TypeDef *timer);
+
+/**
+ * @brief   Motor control mode (TIMER0 only)
+ */
+///{
+typedef struct PWM_Motor_Struct PWM_MotorType;
+
+#define PWM_MOTOR_PARAMS_INVERTPOL            0x001   // Invert polarity of CCx outputs
+#define PWM_MOTOR_PARAMS_INVERTCOMPL          0x002   // Do not invert CDTIx outputs
+#define PWM_MOTOR_PARAMS_AUTORESTART          0x004   // Restart clears fault
+#define PWM_MOTOR_PARAMS_DEBUGFAULT           0x008   // Debugger halt is a fault
+
+#define PWM_MOTOR_FAULT_NONE                  0
+#define PWM_MOTOR_FAULT_INACTIVE              1       // Outputs go to inactive level
+#define PWM_MOTOR_FAULT_CLEAR                 2       // Outputs go to 0
+#define PWM_MOTOR_FAULT_TRISTATE              3       // Outputs are disabled
+
+#define PWM_MOTOR_OUT_CC0                     0x01
+#define PWM_MOTOR_OUT_CC1                     0x02
+#define PWM_MOTOR_OUT_CC2                     0x04
+#define PWM_MOTOR_OUT_CDTI0                   0x08
+#define PWM_MOTOR_OUT_CDTI1                   0x10
+#define PWM_MOTOR_OUT_CDTI2                   0x20
+#define PWM_MOTOR_OUT_ALL                     0x3F
+///}
+
+PWM_MotorType *PWM_MotorInit(int loc, unsigned top, unsigned deadtime, unsigned params);
+void     PWM_MotorStart(PWM_MotorType *m);
+void     PWM_MotorStop(PWM_MotorType *m);
+unsigned PWM_MotorGetTop(PWM_MotorType *m);
+int      PWM_MotorWrite(PWM_MotorType *m, unsigned d0, unsigned d1, unsigned d2);
+void     PWM_MotorSetOutputs(PWM_MotorType *m, unsigned mask);
+int      PWM_MotorConfigFault(PWM_MotorType *m, int prsch0, int prsch1, unsigned action);
+int      PWM_MotorConfigFaultPin(PWM_MotorType *m, GPIO_t gpio, int pin, int prsch,
+                                 int activelow, unsigned action);
+uint32_t PWM_MotorGetFault(PWM_MotorType *m);
+void     PWM_MotorClearFault(PWM_MotorType *m);
+void     PWM_MotorLock(PWM_MotorType *m);
 
 #endif  // PWM_H
 
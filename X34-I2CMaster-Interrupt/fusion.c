@@ -0,0 +1,367 @@
+/** ***************************************************************************
+ * @file    fusion.c
+ * @brief   Fixed-point orientation filters (complementary and Madgwick) for the MPU60x0
+ * @version 1.0
+ *
+ * @note    There is no FPU and floating point is emulated (-mfloat-abi=soft), so all
+ *          calculations use integers. The quaternion is kept in Q30 and products are
+ *          calculated with 64 bits (a single SMULL on the Cortex-M3).
+ *
+ * @note    The gyro integration is
+ *
+ *              q = q + 0.5 * q x (0,w) * dt
+ *
+ *          and the quaternion is normalized after each step.
+ *
+ * @note    The complementary filter adds to the angular rate a correction proportional
+ *          to the cross product of the measured and estimated gravity (Mahony without
+ *          the integral term). The Madgwick filter subtracts from the quaternion
+ *          derivative a step along the normalized gradient of the gravity error.
+ *
+ * @note    1/sqrt(x) uses a table with linear interpolation followed by one Newton
+ *          iteration. atan2 uses a table with linear interpolation in the first octant.
+ *          There is no division in the update.
+ *
+ * @note    Only gravity is used, so yaw is not corrected and drifts with the gyro bias.
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "mpu60x0.h"
+#include "fusion.h"
+
+/**
+ * @brief   pi/180 in Q30
+ */
+#define DEG2RAD_Q30                 18740330
+
+/**
+ * @brief   Q30 product
+ */
+#define MULQ(A,B)                   (((int64_t) (A)*(B))>>FUSION_QSHIFT)
+
+/**
+ * @brief   1/sqrt(f) for f = 0.25+i/64 (Q30)
+ */
+static const uint32_t invsqrttable[49] = {
+    2147483648, 2083365155, 2024667000, 1970666148, 1920767767, 1874477404,
+    1831380208, 1791125178, 1753413056, 1717986918, 1684624773, 1653133683,
+    1623345051, 1595110809, 1568300315, 1542797797, 1518500250, 1495315679,
+    1473161629, 1451963954, 1431655765, 1412176548, 1393471397, 1375490368,
+    1358187913, 1341522400, 1325455684, 1309952745, 1294981364, 1280511845,
+    1266516759, 1252970736, 1239850262, 1227133513, 1214800200, 1202831433,
+    1191209601, 1179918260, 1168942037, 1158266544, 1147878294, 1137764631,
+    1127913670, 1118314230, 1108955787, 1099828424, 1090922784, 1082230034,
+    1073741824
+};
+
+/**
+ * @brief   atan(i/64) in 1/4 of binary angle units (pi/4 = 32768)
+ */
+static const uint16_t atantable[65] = {
+        0,   652,  1303,  1954,  2604,  3253,  3900,  4545,  5188,  5829,
+     6467,  7101,  7733,  8361,  8985,  9605, 10221, 10832, 11439, 12040,
+    12637, 13228, 13814, 14394, 14968, 15537, 16100, 16656, 17206, 17750,
+    18288, 18819, 19344, 19862, 20374, 20879, 21378, 21870, 22355, 22834,
+    23306, 23771, 24230, 24682, 25128, 25568, 26001, 26427, 26848, 27262,
+    27670, 28072, 28467, 28857, 29241, 29619, 29991, 30357, 30718, 31073,
+    31423, 31767, 32106, 32439, 32768
+};
+
+/**
+ * @brief   Inverse square root
+ *
+ * @note    1/sqrt(x) = r * 2^-(30+shift), where r is the returned value (Q30, 1 < r <= 2)
+ *
+ * @note    x is scaled by an even power of 2 to [0.25,1) (in Q32), so the result is
+ *          only scaled by a power of 2. Relative error is below 2e-7.
+ *
+ * @return  r or 0 if x is zero
+ */
+uint32_t Fusion_InvSqrt(uint64_t x, int *shift) {
+uint32_t u,r,a,b;
+uint64_t r2,y;
+int p,e,i;
+
+    if( x == 0 ) {
+        *shift = 0;
+        return 0;
+    }
+
+    // Top bit at position 30 or 31 using an even shift
+    p = 63-__builtin_clzll(x);
+    e = p-30;
+    if( e&1 )
+        e++;
+    if( p-e < 30 )
+        e -= 2;
+    u = (uint32_t) ((e >= 0) ? (x>>e) : (x<<(-e)));
+
+    // Table with linear interpolation
+    i = (u-(1UL<<30))>>26;
+    a = invsqrttable[i];
+    b = invsqrttable[i+1];
+    r = a-(uint32_t) (((uint64_t) (a-b)*((u>>10)&0xFFFF))>>16);
+
+    // Newton iteration: r = r*(3-f*r^2)/2
+    r2 = ((uint64_t) r*r)>>30;
+    y  = (r2*(u>>2))>>30;
+    r  = (uint32_t) (((uint64_t) r*((3ULL<<30)-y))>>31);
+
+    *shift = (32+e)/2;
+    return r;
+}
+
+/**
+ * @brief   Normalize a vector to a Q30 unit vector
+ *
+ * @note    Input can have any scale
+ *
+ * @return  0 if OK, -1 if null vector (v is not changed)
+ */
+static int Normalize(int32_t *v, const int64_t *w, int n) {
+int64_t t[4];
+uint64_t m,x;
+uint32_t r;
+int s,i,k;
+
+    // Scale to 31 bits, so the sum of squares fits in 64 bits
+    m = 0;
+    for(i=0;i<n;i++) {
+        uint64_t a = (w[i] < 0) ? -w[i] : w[i];
+        if( a > m )
+            m = a;
+    }
+    if( m == 0 )
+        return -1;
+    for(k=0;(m>>k)>=(1ULL<<31);k++) {}
+
+    x = 0;
+    for(i=0;i<n;i++) {
+        t[i] = w[i]>>k;
+        x += (uint64_t) (t[i]*t[i]);
+    }
+
+    r = Fusion_InvSqrt(x,&s);
+    for(i=0;i<n;i++)
+        v[i] = (int32_t) ((t[i]*r)>>s);
+    return 0;
+}
+
+/**
+ * @brief   Square root of a Q30 value in [0,1]
+ */
+static int32_t SqrtQ30(int32_t x) {
+uint32_t r;
+int s;
+
+    if( x <= 0 )
+        return 0;
+    r = Fusion_InvSqrt((uint64_t) x,&s);
+    // x/sqrt(x) with 1/sqrt(x) = r*2^(15-30-s) in real units
+    return (int32_t) (((int64_t) x*r)>>(15+s));
+}
+
+/**
+ * @brief   atan2 in binary angle units (32768 = pi)
+ */
+int16_t Fusion_Atan2(int32_t y, int32_t x) {
+uint32_t ux,uy,mx,mn,t;
+int32_t angle;
+int p;
+
+    ux = (x < 0) ? -(uint32_t) x : (uint32_t) x;
+    uy = (y < 0) ? -(uint32_t) y : (uint32_t) y;
+    if( ux == 0 && uy == 0 )
+        return 0;
+
+    mx = (ux > uy) ? ux : uy;
+    mn = (ux > uy) ? uy : ux;
+
+    // Scale so the maximum is in [2^14,2^15)
+    p = 31-__builtin_clz(mx);
+    if( p > 14 ) {
+        mx >>= p-14;
+        mn >>= p-14;
+    } else {
+        mx <<= 14-p;
+        mn <<= 14-p;
+    }
+
+    // First octant (Q16 ratio)
+    t = (mn<<16)/mx;
+    angle = atantable[t>>10];
+    angle += ((atantable[(t>>10)+(t<65536)]-angle)*(int32_t) (t&1023))>>10;
+    angle = (angle+2)>>2;
+
+    if( uy > ux )
+        angle = FUSION_ANGLE_PI/2-angle;
+    if( x < 0 )
+        angle = FUSION_ANGLE_PI-angle;
+    if( y < 0 )
+        angle = -angle;
+    return (int16_t) angle;
+}
+
+/**
+ * @brief   Initialize filter
+ *
+ * @param   type:   FUSION_COMPLEMENTARY or FUSION_MADGWICK
+ * @param   rate:   samples per second
+ * @param   gyrofs: gyro full scale in degrees per second (250, 500, 1000 or 2000)
+ * @param   gain:   Q15. Proportional gain (1/s) for the complementary filter or beta
+ *                  (rad/s) for the Madgwick filter
+ *
+ * @return  0 if OK, -1 if parameters are invalid
+ */
+int Fusion_Init(Fusion_Type *f, unsigned type, uint32_t rate, uint32_t gyrofs, int32_t gain) {
+uint64_t khalf;
+
+    if( type > FUSION_MADGWICK || rate == 0 || gyrofs == 0 || gyrofs > 2000 || gain < 0 )
+        return -1;
+
+    // Half angle per LSB per sample in Q46: (fs/32768)*(pi/180)/rate/2
+    khalf = ((uint64_t) DEG2RAD_Q30*gyrofs)/rate;
+    if( khalf > UINT32_MAX )
+        return -1;
+
+    f->type  = type;
+    f->khalf = (uint32_t) khalf;
+    if( type == FUSION_COMPLEMENTARY ) {
+        // gain*dt/2 (correction is added to the half angle)
+        f->kcorr = (int32_t) (((int64_t) gain<<14)/rate);
+    } else {
+        // beta*dt
+        f->kcorr = (int32_t) (((int64_t) gain<<15)/rate);
+    }
+    Fusion_Reset(f);
+    return 0;
+}
+
+/**
+ * @brief   Set orientation to identity
+ */
+void Fusion_Reset(Fusion_Type *f) {
+
+    f->q[0] = FUSION_ONE;
+    f->q[1] = 0;
+    f->q[2] = 0;
+    f->q[3] = 0;
+}
+
+/**
+ * @brief   One filter step
+ */
+static void Update(Fusion_Type *f, int32_t ax, int32_t ay, int32_t az,
+                                   int32_t gx, int32_t gy, int32_t gz) {
+int32_t q0 = f->q[0], q1 = f->q[1], q2 = f->q[2], q3 = f->q[3];
+int32_t hx,hy,hz;
+int32_t a[3],s[4];
+int32_t vx,vy,vz;
+int64_t w[4];
+int usegravity;
+
+    // Half angle in this sample (Q30)
+    hx = (int32_t) (((int64_t) gx*f->khalf)>>16);
+    hy = (int32_t) (((int64_t) gy*f->khalf)>>16);
+    hz = (int32_t) (((int64_t) gz*f->khalf)>>16);
+
+    // Measured gravity (free fall is ignored)
+    w[0] = ax;
+    w[1] = ay;
+    w[2] = az;
+    usegravity = Normalize(a,w,3) == 0 && f->kcorr != 0;
+
+    if( usegravity ) {
+        // Estimated gravity
+        vx = (int32_t) (2*(MULQ(q1,q3)-MULQ(q0,q2)));
+        vy = (int32_t) (2*(MULQ(q0,q1)+MULQ(q2,q3)));
+        vz = (int32_t) (MULQ(q0,q0)-MULQ(q1,q1)-MULQ(q2,q2)+MULQ(q3,q3));
+
+        if( f->type == FUSION_COMPLEMENTARY ) {
+            // Correction proportional to the cross product
+            hx += (int32_t) MULQ(MULQ(a[1],vz)-MULQ(a[2],vy),f->kcorr);
+            hy += (int32_t) MULQ(MULQ(a[2],vx)-MULQ(a[0],vz),f->kcorr);
+            hz += (int32_t) MULQ(MULQ(a[0],vy)-MULQ(a[1],vx),f->kcorr);
+        } else {
+            // Gradient of the error (J'*f)
+            int64_t f1 = vx-a[0];
+            int64_t f2 = vy-a[1];
+            int64_t f3 = vz-a[2];
+            w[0] = 2*(-MULQ(q2,f1)+MULQ(q1,f2));
+            w[1] = 2*( MULQ(q3,f1)+MULQ(q0,f2))-4*MULQ(q1,f3);
+            w[2] = 2*(-MULQ(q0,f1)+MULQ(q3,f2))-4*MULQ(q2,f3);
+            w[3] = 2*( MULQ(q1,f1)+MULQ(q2,f2));
+            if( Normalize(s,w,4) < 0 )
+                usegravity = 0;
+        }
+    }
+
+    // q = q + q x (0,h)
+    w[0] = (int64_t) q0-MULQ(q1,hx)-MULQ(q2,hy)-MULQ(q3,hz);
+    w[1] = (int64_t) q1+MULQ(q0,hx)+MULQ(q2,hz)-MULQ(q3,hy);
+    w[2] = (int64_t) q2+MULQ(q0,hy)-MULQ(q1,hz)+MULQ(q3,hx);
+    w[3] = (int64_t) q3+MULQ(q0,hz)+MULQ(q1,hy)-MULQ(q2,hx);
+
+    if( usegravity && f->type == FUSION_MADGWICK ) {
+        w[0] -= MULQ(s[0],f->kcorr);
+        w[1] -= MULQ(s[1],f->kcorr);
+        w[2] -= MULQ(s[2],f->kcorr);
+        w[3] -= MULQ(s[3],f->kcorr);
+    }
+
+    if( Normalize(f->q,w,4) < 0 )
+        Fusion_Reset(f);
+}
+
+/**
+ * @brief   Update with a sample from the MPU60x0 FIFO (streaming mode)
+ */
+void Fusion_Update(Fusion_Type *f, const MPU60x0_SampleType *s) {
+
+    Update(f,s->ax,s->ay,s->az,s->gx,s->gy,s->gz);
+}
+
+/**
+ * @brief   Update with data read from the registers
+ *
+ * @note    Values are two's complement
+ */
+void Fusion_UpdateAccelGyro(Fusion_Type *f, const MPU60x0_AccelType *a, const MPU60x0_GyroType *g) {
+
+    Update(f,(int16_t) a->x,(int16_t) a->y,(int16_t) a->z,
+             (int16_t) g->x,(int16_t) g->y,(int16_t) g->z);
+}
+
+/**
+ * @brief   Get orientation quaternion (Q30, w first)
+ */
+void Fusion_GetQuaternion(const Fusion_Type *f, int32_t q[4]) {
+
+    q[0] = f->q[0];
+    q[1] = f->q[1];
+    q[2] = f->q[2];
+    q[3] = f->q[3];
+}
+
+/**
+ * @brief   Get Euler angles (ZYX) in binary angle units (32768 = pi)
+ */
+void Fusion_GetEuler(const Fusion_Type *f, int16_t *roll, int16_t *pitch, int16_t *yaw) {
+int32_t q0 = f->q[0], q1 = f->q[1], q2 = f->q[2], q3 = f->q[3];
+int64_t sp;
+
+    if( roll )
+        *roll = Fusion_Atan2((int32_t) (2*(MULQ(q0,q1)+MULQ(q2,q3))),
+                             (int32_t) (FUSION_ONE-2*(MULQ(q1,q1)+MULQ(q2,q2))));
+    if( pitch ) {
+        sp = 2*(MULQ(q0,q2)-MULQ(q3,q1));
+        if( sp > FUSION_ONE )
+            sp = FUSION_ONE;
+        if( sp < -FUSION_ONE )
+            sp = -FUSION_ONE;
+        *pitch = Fusion_Atan2((int32_t) sp,SqrtQ30((int32_t) (FUSION_ONE-MULQ(sp,sp))));
+    }
+    if( yaw )
+        *yaw = Fusion_Atan2((int32_t) (2*(MULQ(q0,q3)+MULQ(q1,q2))),
+                            (int32_t) (FUSION_ONE-2*(MULQ(q2,q2)+MULQ(q3,q3))));
+}
@@ -0,0 +1,56 @@
+#ifndef FUSION_H
+#define FUSION_H
+/**
+ * @file    fusion.h
+ * @brief   Fixed-point orientation filters (complementary and Madgwick) for the MPU60x0
+ *
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include "mpu60x0.h"
+
+/**
+ * @brief   Fixed point formats
+ *
+ * @note    Quaternion components are Q30 (1.0 = 1<<30). Gains are Q15.
+ *          Angles are binary angles (65536 = full turn, 32768 = pi).
+ */
+///@{
+#define FUSION_QSHIFT               30
+#define FUSION_ONE                  (1L<<FUSION_QSHIFT)
+#define FUSION_GAIN(X)              ((int32_t) ((X)*(1<<15)))
+#define FUSION_ANGLE_PI             32768
+///@}
+
+/**
+ * @brief   Filter types
+ */
+///@{
+#define FUSION_COMPLEMENTARY        0
+#define FUSION_MADGWICK             1
+///@}
+
+/**
+ * @brief   Filter state
+ *
+ * @note    Allocated by the caller. Initialized by Fusion_Init
+ */
+typedef struct {
+    int32_t     q[4];                               /**< orientation (Q30)        */
+    uint32_t    khalf;                              /**< gyro LSB to half angle   */
+    int32_t     kcorr;                              /**< accel correction (Q30)   */
+    uint8_t     type;
+} Fusion_Type;
+
+int  Fusion_Init(Fusion_Type *f, unsigned type, uint32_t rate, uint32_t gyrofs, int32_t gain);
+void Fusion_Reset(Fusion_Type *f);
+void Fusion_Update(Fusion_Type *f, const MPU60x0_SampleType *s);
+void Fusion_UpdateAccelGyro(Fusion_Type *f, const MPU60x0_AccelType *a, const MPU60x0_GyroType *g);
+void Fusion_GetQuaternion(const Fusion_Type *f, int32_t q[4]);
+void Fusion_GetEuler(const Fusion_Type *f, int16_t *roll, int16_t *pitch, int16_t *yaw);
+
+uint32_t Fusion_InvSqrt(uint64_t x, int *shift);
+int16_t Fusion_Atan2(int32_t y, int32_t x);
+
+#endif // FUSION_H
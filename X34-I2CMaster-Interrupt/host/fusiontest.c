@@ -0,0 +1,483 @@
+/**
+ * @file    fusiontest.c
+ * @brief   Accuracy of the fixed point filters of fusion.c against a double version
+ *
+ * @note    Usage: fusiontest                           synthetic samples
+ *                 fusiontest file rate gyrofs             replay recorded samples
+ *                 fusiontest -w file rate gyrofs          write synthetic samples
+ *
+ *          Synthetic samples of a board turning around the three axes (started with
+ *          a tilt, so the gravity correction works from the first sample) are given
+ *          to Fusion_Update and to the same filter calculated with doubles. After
+ *          each sample, the quaternion and the Euler angles are compared. The program
+ *          fails when the maximal error of a case is above its bound.
+ *
+ * @note    Sample files are text, one sample per line with the raw values of
+ *          MPU60x0_SampleType: ax ay az gx gy gz. Lines starting with # are comments.
+ *          rate is in samples per second and gyrofs in degrees per second. A replay
+ *          runs both filters with the largest bounds of the synthetic cases.
+ *
+ * @note    The double filter uses the same equations, so the difference is only the
+ *          effect of the fixed point arithmetic, the tables and the Newton iteration.
+ *          The tilt error of the filter itself (angle between the estimated and the
+ *          true gravity, after TEST_WARMUP seconds) is printed but not checked.
+ *
+ * @note    The Madgwick step has a fixed size (beta/rate), along the normalized
+ *          gradient. Near convergence the gradient is almost null and its direction
+ *          changes with the rounding, so the two versions can differ by about one
+ *          step. Their bounds are larger.
+ *
+ * @version 1.0
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "mpu60x0.h"
+#include "fusion.h"
+
+#ifndef M_PI
+#define M_PI    3.14159265358979323846
+#endif
+
+/**
+ * @brief   Test parameters
+ */
+///@{
+#define TEST_SECONDS                        (20)
+#define TEST_WARMUP                         (10)        // seconds before the tilt error
+#define TEST_SUBSTEPS                       (10)        // integration of the true motion
+#define ACCEL_LSB                           (16384.0)   // LSB/g (2 g full scale)
+#define INVSQRT_TOLERANCE                   (2e-7)      // relative
+#define ATAN2_TOLERANCE                     (0.01)      // degrees
+///@}
+
+/**
+ * @brief   Test cases
+ */
+typedef struct {
+    const char  *name;
+    unsigned    type;
+    uint32_t    rate;                               /**< samples per second       */
+    uint32_t    gyrofs;                             /**< degrees per second       */
+    double      gain;
+    double      qbound;                             /**< quaternion component     */
+    double      ebound;                             /**< Euler angles (degrees)   */
+} CaseType;
+
+static const CaseType cases[] = {
+    { "complementary 1 kHz 2000 dps",  FUSION_COMPLEMENTARY,   1000, 2000, 0.5,  1e-4, 0.03 },
+    { "complementary 100 Hz 250 dps",  FUSION_COMPLEMENTARY,    100,  250, 0.5,  2e-5, 0.02 },
+    { "madgwick 1 kHz 2000 dps",       FUSION_MADGWICK,        1000, 2000, 0.1,  4e-4, 0.06 },
+    { "madgwick 100 Hz 250 dps",       FUSION_MADGWICK,         100,  250, 0.1,  4e-3, 1.50 },
+    { "gyro only 1 kHz 500 dps",       FUSION_COMPLEMENTARY,   1000,  500, 0.0,  1e-4, 0.03 },
+};
+
+/// Rate and gyro full scale are set from the command line
+static CaseType replaycases[] = {
+    { "complementary (replay)",        FUSION_COMPLEMENTARY,      0,    0, 0.5,  1e-4, 0.03 },
+    { "madgwick (replay)",             FUSION_MADGWICK,           0,    0, 0.1,  4e-3, 1.50 },
+};
+
+/**
+ * @brief   Synthetic motion
+ */
+typedef struct {
+    double      qt[4];                              /**< true orientation         */
+    double      dt;
+    uint32_t    gyrofs;
+    uint32_t    n;
+} MotionType;
+
+/**
+ * @brief   Filter calculated with doubles
+ */
+typedef struct {
+    double      q[4];
+    double      khalf;                              /**< gyro LSB to half angle   */
+    double      kcorr;
+    unsigned    type;
+} RefType;
+
+static void RefInit(RefType *r, const CaseType *c) {
+
+    r->type  = c->type;
+    r->khalf = c->gyrofs/32768.0*M_PI/180.0/c->rate/2.0;
+    r->kcorr = (c->type == FUSION_COMPLEMENTARY) ? c->gain/c->rate/2.0 : c->gain/c->rate;
+    r->q[0]  = 1.0;
+    r->q[1]  = r->q[2] = r->q[3] = 0.0;
+}
+
+static int Normalize(double *v, int n) {
+double m = 0;
+int i;
+
+    for(i=0;i<n;i++)
+        m += v[i]*v[i];
+    if( m == 0 )
+        return -1;
+    m = 1.0/sqrt(m);
+    for(i=0;i<n;i++)
+        v[i] *= m;
+    return 0;
+}
+
+/// Same steps as Update in fusion.c
+static void RefUpdate(RefType *r, const MPU60x0_SampleType *s) {
+double q0 = r->q[0], q1 = r->q[1], q2 = r->q[2], q3 = r->q[3];
+double hx,hy,hz,vx,vy,vz;
+double a[3],g[4],w[4];
+int usegravity;
+
+    hx = s->gx*r->khalf;
+    hy = s->gy*r->khalf;
+    hz = s->gz*r->khalf;
+
+    a[0] = s->ax;
+    a[1] = s->ay;
+    a[2] = s->az;
+    usegravity = Normalize(a,3) == 0 && r->kcorr != 0;
+
+    if( usegravity ) {
+        vx = 2*(q1*q3-q0*q2);
+        vy = 2*(q0*q1+q2*q3);
+        vz = q0*q0-q1*q1-q2*q2+q3*q3;
+        if( r->type == FUSION_COMPLEMENTARY ) {
+            hx += (a[1]*vz-a[2]*vy)*r->kcorr;
+            hy += (a[2]*vx-a[0]*vz)*r->kcorr;
+            hz += (a[0]*vy-a[1]*vx)*r->kcorr;
+        } else {
+            double f1 = vx-a[0], f2 = vy-a[1], f3 = vz-a[2];
+            g[0] = 2*(-q2*f1+q1*f2);
+            g[1] = 2*( q3*f1+q0*f2)-4*q1*f3;
+            g[2] = 2*(-q0*f1+q3*f2)-4*q2*f3;
+            g[3] = 2*( q1*f1+q2*f2);
+            if( Normalize(g,4) < 0 )
+                usegravity = 0;
+        }
+    }
+
+    w[0] = q0-q1*hx-q2*hy-q3*hz;
+    w[1] = q1+q0*hx+q2*hz-q3*hy;
+    w[2] = q2+q0*hy-q1*hz+q3*hx;
+    w[3] = q3+q0*hz+q1*hy-q2*hx;
+    if( usegravity && r->type == FUSION_MADGWICK ) {
+        w[0] -= g[0]*r->kcorr;
+        w[1] -= g[1]*r->kcorr;
+        w[2] -= g[2]*r->kcorr;
+        w[3] -= g[3]*r->kcorr;
+    }
+    if( Normalize(w,4) == 0 ) {
+        r->q[0] = w[0];
+        r->q[1] = w[1];
+        r->q[2] = w[2];
+        r->q[3] = w[3];
+    }
+}
+
+/// Euler angles (ZYX) in binary angle units, as Fusion_GetEuler
+static void RefEuler(const double q[4], double e[3]) {
+double k = FUSION_ANGLE_PI/M_PI;
+double sp;
+
+    sp = 2*(q[0]*q[2]-q[3]*q[1]);
+    if( sp > 1 )  sp = 1;
+    if( sp < -1 ) sp = -1;
+    e[0] = k*atan2(2*(q[0]*q[1]+q[2]*q[3]),1-2*(q[1]*q[1]+q[2]*q[2]));
+    e[1] = k*asin(sp);
+    e[2] = k*atan2(2*(q[0]*q[3]+q[1]*q[2]),1-2*(q[2]*q[2]+q[3]*q[3]));
+}
+
+/// Angle in degrees between the gravity vectors of two orientations
+static double TiltError(const double p[4], const double q[4]) {
+double u[3],v[3],d;
+
+    u[0] = 2*(p[1]*p[3]-p[0]*p[2]);
+    u[1] = 2*(p[0]*p[1]+p[2]*p[3]);
+    u[2] = p[0]*p[0]-p[1]*p[1]-p[2]*p[2]+p[3]*p[3];
+    v[0] = 2*(q[1]*q[3]-q[0]*q[2]);
+    v[1] = 2*(q[0]*q[1]+q[2]*q[3]);
+    v[2] = q[0]*q[0]-q[1]*q[1]-q[2]*q[2]+q[3]*q[3];
+    d = u[0]*v[0]+u[1]*v[1]+u[2]*v[2];
+    if( d > 1 )
+        d = 1;
+    return acos(d)*180.0/M_PI;
+}
+
+/// Difference of binary angles in degrees
+static double AngleError(int16_t a, double ref) {
+double d;
+
+    d = a-ref;
+    while( d > FUSION_ANGLE_PI )  d -= 2*FUSION_ANGLE_PI;
+    while( d < -FUSION_ANGLE_PI ) d += 2*FUSION_ANGLE_PI;
+    return fabs(d)*180.0/FUSION_ANGLE_PI;
+}
+
+/// Angular rate of the board in degrees per second (body axes)
+static void Motion(double t, double w[3]) {
+
+    w[0] =  90.0*sin(2*M_PI*0.50*t);
+    w[1] =  60.0*sin(2*M_PI*0.30*t+1.0);
+    w[2] = 120.0*sin(2*M_PI*0.20*t);
+}
+
+/// q = q + 0.5*q x (0,w)*dt, normalized (w in rad/s)
+static void Integrate(double q[4], const double w[3], double dt) {
+double d[4];
+int i;
+
+    d[0] = -q[1]*w[0]-q[2]*w[1]-q[3]*w[2];
+    d[1] =  q[0]*w[0]+q[2]*w[2]-q[3]*w[1];
+    d[2] =  q[0]*w[1]-q[1]*w[2]+q[3]*w[0];
+    d[3] =  q[0]*w[2]+q[1]*w[1]-q[2]*w[0];
+    for(i=0;i<4;i++)
+        q[i] += 0.5*d[i]*dt;
+    (void) Normalize(q,4);
+}
+
+static int16_t Quantize(double v) {
+
+    v = floor(v+0.5);
+    if( v > INT16_MAX ) return INT16_MAX;
+    if( v < INT16_MIN ) return INT16_MIN;
+    return (int16_t) v;
+}
+
+static void MotionInit(MotionType *m, uint32_t rate, uint32_t gyrofs) {
+
+    // True orientation starts with a tilt of 30 degrees around x
+    m->qt[0]  = cos(M_PI/12);
+    m->qt[1]  = sin(M_PI/12);
+    m->qt[2]  = m->qt[3] = 0.0;
+    m->dt     = 1.0/rate;
+    m->gyrofs = gyrofs;
+    m->n      = 0;
+}
+
+/// Gyro: mean rate in the sample interval. Accel: gravity at its end
+static void MotionSample(MotionType *m, MPU60x0_SampleType *s) {
+double *qt = m->qt;
+double w[3],wr[3];
+uint32_t i,k;
+
+    wr[0] = wr[1] = wr[2] = 0.0;
+    for(k=0;k<TEST_SUBSTEPS;k++) {
+        Motion((m->n+(k+0.5)/TEST_SUBSTEPS)*m->dt,w);
+        for(i=0;i<3;i++) {
+            wr[i] += w[i]/TEST_SUBSTEPS;
+            w[i]  *= M_PI/180.0;
+        }
+        Integrate(qt,w,m->dt/TEST_SUBSTEPS);
+    }
+    s->gx = Quantize(wr[0]*32768.0/m->gyrofs);
+    s->gy = Quantize(wr[1]*32768.0/m->gyrofs);
+    s->gz = Quantize(wr[2]*32768.0/m->gyrofs);
+    s->ax = Quantize(ACCEL_LSB*2*(qt[1]*qt[3]-qt[0]*qt[2]));
+    s->ay = Quantize(ACCEL_LSB*2*(qt[0]*qt[1]+qt[2]*qt[3]));
+    s->az = Quantize(ACCEL_LSB*(qt[0]*qt[0]-qt[1]*qt[1]-qt[2]*qt[2]+qt[3]*qt[3]));
+    m->n++;
+}
+
+/**
+ * @brief   Read a sample from a file
+ *
+ * @return  1 if read, 0 at the end of the file, -1 if the line is invalid
+ */
+static int ReadSample(FILE *in, MPU60x0_SampleType *s) {
+char line[200];
+int v[6];
+
+    do {
+        if( fgets(line,sizeof(line),in) == 0 )
+            return 0;
+    } while( line[0] == '#' || line[strspn(line," \t\r\n")] == '\0' );
+
+    if( sscanf(line,"%d %d %d %d %d %d",&v[0],&v[1],&v[2],&v[3],&v[4],&v[5]) != 6 )
+        return -1;
+    s->ax = Quantize(v[0]);
+    s->ay = Quantize(v[1]);
+    s->az = Quantize(v[2]);
+    s->gx = Quantize(v[3]);
+    s->gy = Quantize(v[4]);
+    s->gz = Quantize(v[5]);
+    return 1;
+}
+
+/**
+ * @brief   Write TEST_SECONDS of synthetic samples to a file
+ */
+static int WriteSamples(const char *name, uint32_t rate, uint32_t gyrofs) {
+MPU60x0_SampleType s;
+MotionType m;
+FILE *out;
+uint32_t n;
+
+    out = fopen(name,"w");
+    if( out == 0 ) {
+        perror(name);
+        return 1;
+    }
+    fprintf(out,"# fusiontest synthetic samples, %u Hz, %u dps\n",
+                (unsigned) rate,(unsigned) gyrofs);
+    fprintf(out,"# ax ay az gx gy gz\n");
+    MotionInit(&m,rate,gyrofs);
+    for(n=0;n<TEST_SECONDS*rate;n++) {
+        MotionSample(&m,&s);
+        fprintf(out,"%d %d %d %d %d %d\n",s.ax,s.ay,s.az,s.gx,s.gy,s.gz);
+    }
+    return fclose(out) != 0;
+}
+
+/**
+ * @brief   Run one case
+ *
+ * @param   in: samples file or 0 for synthetic samples
+ *
+ * @return  0 if errors are within the bounds
+ */
+static int RunCase(const CaseType *c, FILE *in) {
+static Fusion_Type f;
+MPU60x0_SampleType s;
+MotionType m;
+RefType r;
+double e[3];
+double sign,err,qerr = 0,eerr = 0,terr = 0;
+int32_t qf[4];
+int16_t euler[3];
+uint32_t n,i;
+int rc;
+
+    if( Fusion_Init(&f,c->type,c->rate,c->gyrofs,FUSION_GAIN(c->gain)) < 0 ) {
+        printf("%-32s Fusion_Init failed\n",c->name);
+        return 1;
+    }
+    RefInit(&r,c);
+
+    if( in )
+        rewind(in);
+    else
+        MotionInit(&m,c->rate,c->gyrofs);
+
+    for(n=0;;n++) {
+        if( in ) {
+            rc = ReadSample(in,&s);
+            if( rc < 0 ) {
+                printf("%-32s invalid line after %u samples\n",c->name,(unsigned) n);
+                return 1;
+            }
+            if( rc == 0 )
+                break;
+        } else {
+            if( n >= TEST_SECONDS*c->rate )
+                break;
+            MotionSample(&m,&s);
+        }
+
+        Fusion_Update(&f,&s);
+        RefUpdate(&r,&s);
+
+        // q and -q are the same orientation
+        Fusion_GetQuaternion(&f,qf);
+        sign = (qf[0]*r.q[0]+qf[1]*r.q[1]+qf[2]*r.q[2]+qf[3]*r.q[3] < 0) ? -1.0 : 1.0;
+        for(i=0;i<4;i++) {
+            err = fabs(sign*qf[i]/(double) FUSION_ONE-r.q[i]);
+            if( err > qerr )
+                qerr = err;
+        }
+
+        // Pitch is kept away from +/-90 degrees, where roll and yaw are not defined
+        Fusion_GetEuler(&f,&euler[0],&euler[1],&euler[2]);
+        RefEuler(r.q,e);
+        for(i=0;i<3;i++) {
+            err = AngleError(euler[i],e[i]);
+            if( err > eerr )
+                eerr = err;
+        }
+
+        if( !in && n >= TEST_WARMUP*c->rate ) {
+            err = TiltError(r.q,m.qt);
+            if( err > terr )
+                terr = err;
+        }
+    }
+
+    if( in )
+        printf("%-32s q %.2e  euler %.4f deg  (%u samples)  %s\n",
+                c->name,qerr,eerr,(unsigned) n,
+                (qerr <= c->qbound && eerr <= c->ebound) ? "OK" : "FAIL");
+    else
+        printf("%-32s q %.2e  euler %.4f deg  (tilt vs true %.2f deg)  %s\n",
+                c->name,qerr,eerr,terr,
+                (qerr <= c->qbound && eerr <= c->ebound) ? "OK" : "FAIL");
+
+    return qerr > c->qbound || eerr > c->ebound;
+}
+
+/**
+ * @brief   Inverse square root and atan2 against libm
+ */
+static int RunFunctions(void) {
+double rerr = 0, aerr = 0, err, x, a;
+uint32_t r;
+int16_t angle;
+int shift,i;
+
+    for(i=0;i<100000;i++) {
+        x = exp(i*0.0004)+i;
+        r = Fusion_InvSqrt((uint64_t) x,&shift);
+        err = fabs(ldexp(r,-(30+shift))*sqrt(floor(x))-1.0);
+        if( err > rerr )
+            rerr = err;
+    }
+    for(i=0;i<3600;i++) {
+        a = i*M_PI/1800.0;
+        angle = Fusion_Atan2((int32_t) floor(1e6*sin(a)+0.5),(int32_t) floor(1e6*cos(a)+0.5));
+        err = AngleError(angle,FUSION_ANGLE_PI*atan2(sin(a),cos(a))/M_PI);
+        if( err > aerr )
+            aerr = err;
+    }
+    printf("%-32s invsqrt %.2e  atan2 %.4f deg  %s\n","functions",rerr,aerr,
+            (rerr <= INVSQRT_TOLERANCE && aerr <= ATAN2_TOLERANCE) ? "OK" : "FAIL");
+
+    return rerr > INVSQRT_TOLERANCE || aerr > ATAN2_TOLERANCE;
+}
+
+int main(int argc, char *argv[]) {
+FILE *in = 0;
+unsigned i;
+int fails;
+
+    if( argc == 5 && strcmp(argv[1],"-w") == 0 )
+        return WriteSamples(argv[2],strtoul(argv[3],0,10),strtoul(argv[4],0,10));
+
+    if( argc == 4 ) {
+        in = fopen(argv[1],"r");
+        if( in == 0 ) {
+            perror(argv[1]);
+            return 1;
+        }
+        fails = 0;
+        for(i=0;i<sizeof(replaycases)/sizeof(replaycases[0]);i++) {
+            replaycases[i].rate   = strtoul(argv[2],0,10);
+            replaycases[i].gyrofs = strtoul(argv[3],0,10);
+            fails += RunCase(&replaycases[i],in);
+        }
+        fclose(in);
+    } else if( argc == 1 ) {
+        fails = RunFunctions();
+        for(i=0;i<sizeof(cases)/sizeof(cases[0]);i++)
+            fails += RunCase(&cases[i],0);
+    } else {
+        fprintf(stderr,"Usage: fusiontest [[-w] file rate gyrofs]\n");
+        return 2;
+    }
+
+    if( fails ) {
+        printf("%d case(s) above the error bounds\n",fails);
+        return 1;
+    }
+    return 0;
+}
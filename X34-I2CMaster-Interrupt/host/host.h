@@ -0,0 +1,19 @@
+#ifndef HOST_H
+#define HOST_H
+/**
+ * @file    host.h
+ * @brief   Replaces the device headers used by mpu60x0.h in the host build
+ *
+ * @note    Included before any other file (-include host.h). fusion.c uses only the
+ *          sample types of mpu60x0.h, so the peripheral types are incomplete.
+ *
+ * @version 1.0
+ */
+
+#define EM_DEVICE_H
+#define GPIO_H
+
+typedef struct I2C_Host         I2C_TypeDef;
+typedef struct GPIO_Host        *GPIO_t;
+
+#endif // HOST_H
@@ -5,13 +5,24 @@
  *
  * @note    It uses polling
  *
+ * @note    Transactions can be queued (I2CMaster_Enqueue). They are executed back to
+ *          back by the interrupt routine, without CPU intervention between them.
+ *          Each transaction is a write, a read or a write followed by a read with a
+ *          repeated START (e.g. register address and then data). The descriptors
+ *          are owned by the caller and the data is not copied.
+ *
+ * @note    When DMA channels are configured (I2CMaster_ConfigDMA), long data phases of
+ *          queued transactions are transferred by DMA. Only START, address, end of the
+ *          data phase and STOP generate interrupts.
  */
 
 #include  <stdint.h>
 #include "em_device.h"
 #include "clock_efm32gg2.h"
 #include "gpio.h"
+#include "dma.h"
 #include "i2cmaster.h"
+#include "i2cslave.h"
 
 #ifndef I2CINTLEVEL
 #define I2CINTLEVEL    (5)
@@ -30,6 +41,26 @@
 #define I2C_OUTPUT_BUFFER_SIZE              (20)
 #endif
 
+/**
+ * @brief Minimal size of a data phase to use DMA (must be at least 3)
+ *
+ * @note  In a read, the last two bytes are received by the interrupt routine, so the
+ *        NACK of the last byte is sent by software.
+ */
+#ifndef I2C_DMA_MINSIZE
+#define I2C_DMA_MINSIZE                     (6)
+#endif
+
+/**
+ * @brief   Slave mode support
+ *
+ * @note    When set, the interrupt handlers pass the interrupts of units configured
+ *          as slave (I2CSlave_Init) to i2cslave.c
+ */
+#ifndef I2C_SLAVE_SUPPORT
+#define I2C_SLAVE_SUPPORT                   (1)
+#endif
+
 /**
  * @brief   BIT macro generates a bitmask from a given bit number
  */
@@ -59,6 +90,15 @@ typedef enum {
         STATE_TXRX_SENDLAST,
         STATE_TXRX_RECEIVEDATA,
         STATE_TXRX_STOP,
+        STATE_Q_WADDR,
+        STATE_Q_WADDR2,
+        STATE_Q_WRITE,
+        STATE_Q_RADDR,
+        STATE_Q_READ,
+        STATE_Q_STOP,
+        STATE_Q_WDMA,
+        STATE_Q_WDMAEND,
+        STATE_Q_RDMA,
     } State_t;
 
 typedef enum {
@@ -87,6 +127,16 @@ typedef struct {
     Operation_t             operation;
     State_t                 state;
     uint8_t                 addressbytes;
+    I2CMaster_TransactionType *head;                /**< current transaction      */
+    I2CMaster_TransactionType *tail;                /**< last queued transaction  */
+    uint16_t                woffset;
+    uint16_t                roffset;
+    uint8_t                 qaddress[2];            /**< address bytes (write)    */
+    int8_t                  qerror;                 /**< error before STOP        */
+    int8_t                  dmatx;                  /**< -1 if no DMA             */
+    int8_t                  dmarx;                  /**< -1 if no DMA             */
+    uint8_t                 dmaactive;              /**< DMA_NONE/DMA_TX/DMA_RX   */
+    volatile uint8_t        dmadone;
 } TransferInfo;
 ///@}
 
@@ -140,16 +190,29 @@ static TransferInfo         transferinfo[2];
 
 /* Forward definition of ProcessInterrupt routine */
 static void ProcessInterrupt(I2C_TypeDef *i2c, TransferInfo *ti);
+static void ProcessQueue(I2C_TypeDef *i2c, TransferInfo *ti);
 
 
 
 /** Interrupt Handlers */
 ///@{
 void I2C0_IRQHandler(void) {
+#if I2C_SLAVE_SUPPORT
+    if( I2C0->CTRL&I2C_CTRL_SLAVE ) {
+        I2CSlave_ProcessInterrupt(I2C0);
+        return;
+    }
+#endif
     ProcessInterrupt(I2C0,&transferinfo[0]);
 }
 
 void I2C1_IRQHandler(void) {
+#if I2C_SLAVE_SUPPORT
+    if( I2C1->CTRL&I2C_CTRL_SLAVE ) {
+        I2CSlave_ProcessInterrupt(I2C1);
+        return;
+    }
+#endif
     ProcessInterrupt(I2C1,&transferinfo[1]);
 }
 ///@}
@@ -180,6 +243,12 @@ TransferInfo *GetTransferInfo(I2C_TypeDef *unit) {
 static void
 ProcessInterrupt(I2C_TypeDef *i2c, TransferInfo *ti) {
 
+    // Queued transactions have their own state machine
+    if( ti->head ) {
+        ProcessQueue(i2c,ti);
+        return;
+    }
+
     // Process interrupt according state
     switch(ti->state) {
     case STATE_IDLE:
@@ -276,12 +345,469 @@ ProcessInterrupt(I2C_TypeDef *i2c, TransferInfo *ti) {
         i2c->IFC = _I2C_IFC_MASK;   // Clear all interrupts
         // TODO
         break;
+    default:
+        // Queue states are processed by ProcessQueue
+        i2c->IFC = _I2C_IFC_MASK;   // Clear all interrupts
+        break;
     }
 
     return;
 }
 
 
+/**
+ * @brief   Interrupts used by the transaction queue
+ *
+ * @note    TXBL is not used, because it stays set while the buffer is empty. The ACK of
+ *          each byte is used instead.
+ */
+#define QUEUE_INTERRUPTS    (I2C_IEN_ACK|I2C_IEN_NACK|I2C_IEN_RXDATAV|I2C_IEN_MSTOP\
+                            |I2C_IEN_ARBLOST|I2C_IEN_BUSERR)
+
+/**
+ * @brief   DMA phase of current transaction
+ */
+///@{
+#define DMA_NONE            (0)
+#define DMA_TX              (1)
+#define DMA_RX              (2)
+///@}
+
+/**
+ * @brief   DMA request signals (RXDATAV and TXBL) of the I2C units
+ */
+static const uint32_t dmasignals[2][2] = {
+    {   DMA_CH_CTRL_SOURCESEL_I2C0|DMA_CH_CTRL_SIGSEL_I2C0RXDATAV,
+        DMA_CH_CTRL_SOURCESEL_I2C0|DMA_CH_CTRL_SIGSEL_I2C0TXBL      },
+    {   DMA_CH_CTRL_SOURCESEL_I2C1|DMA_CH_CTRL_SIGSEL_I2C1RXDATAV,
+        DMA_CH_CTRL_SOURCESEL_I2C1|DMA_CH_CTRL_SIGSEL_I2C1TXBL      }
+};
+
+/**
+ * @brief   DMA callback
+ *
+ * @note    In a read, AUTOACK is cleared here, as soon as possible, so the last bytes are
+ *          not acknowledged automatically. The rest is done by the I2C interrupt routine.
+ */
+static void DMACallback(int chn) {
+TransferInfo *ti;
+int u;
+
+    for(u=0;u<2;u++) {
+        ti = &transferinfo[u];
+        if( ti->dmaactive == DMA_NONE || (chn != ti->dmatx && chn != ti->dmarx) )
+            continue;
+        if( ti->dmaactive == DMA_RX )
+            (u==0?I2C0:I2C1)->CTRL &= ~I2C_CTRL_AUTOACK;
+        ti->dmadone = 1;
+        NVIC_SetPendingIRQ(u==0?I2C0_IRQn:I2C1_IRQn);
+    }
+}
+
+/**
+ * @brief   Stop DMA of current transaction (if any) and restore interrupts
+ */
+static void StopDMA(I2C_TypeDef *i2c, TransferInfo *ti) {
+
+    if( ti->dmaactive == DMA_NONE )
+        return;
+
+    DMA_Stop(ti->dmaactive==DMA_TX?ti->dmatx:ti->dmarx);
+    i2c->CTRL &= ~I2C_CTRL_AUTOACK;
+    i2c->IEN   = (i2c->IEN&~I2C_IEN_TXC)|QUEUE_INTERRUPTS;
+    ti->dmaactive = DMA_NONE;
+    ti->dmadone   = 0;
+}
+
+/**
+ * @brief   Send a (repeated) START and the address in read form
+ *
+ * @note    For a long read, DMA is armed before, so it is ready when the first byte
+ *          arrives. AUTOACK is set and RXDATAV interrupt is disabled until the DMA ends.
+ */
+static void StartRead(I2C_TypeDef *i2c, TransferInfo *ti) {
+I2CMaster_TransactionType *t = ti->head;
+
+    if( ti->dmarx >= 0 && t->rsize >= I2C_DMA_MINSIZE ) {
+        ti->dmadone   = 0;
+        ti->dmaactive = DMA_RX;
+        i2c->IEN  &= ~I2C_IEN_RXDATAV;
+        i2c->CTRL |= I2C_CTRL_AUTOACK;
+        DMA_StartRx(ti->dmarx,dmasignals[i2c==I2C1][0],&(i2c->RXDATA),
+                    t->rdata,t->rsize-2,DMACallback);
+    }
+
+    i2c->CMD = I2C_CMD_START;
+    i2c->TXDATA = ti->qaddress[0]|1;
+    ti->state = STATE_Q_RADDR;
+}
+
+/**
+ * @brief   Start the transaction at the head of the queue
+ *
+ * @note    A START is sent. If the bus is still owned (no STOP after the previous
+ *          transaction), it is a repeated START.
+ *
+ * @note    10-bit addresses are always sent in write form first. The read form is sent
+ *          after a repeated START with only the first byte.
+ */
+static void StartTransaction(I2C_TypeDef *i2c, TransferInfo *ti) {
+I2CMaster_TransactionType *t = ti->head;
+
+    ti->woffset = 0;
+    ti->roffset = 0;
+    ti->qerror  = I2CMASTER_TRANS_OK;
+    if( t->address > 0x7F ) {
+        ti->qaddress[0]   = (uint8_t) (0xF0|((t->address>>7)&0x06));
+        ti->qaddress[1]   = (uint8_t) (t->address&0xFF);
+        ti->addressbytes  = 2;
+    } else {
+        ti->qaddress[0]   = (uint8_t) (t->address<<1);
+        ti->addressbytes  = 1;
+    }
+
+    if( ti->addressbytes == 1 && t->wsize == 0 && t->rsize != 0 ) {
+        // Only read: address in read form
+        StartRead(i2c,ti);
+    } else {
+        i2c->CMD = I2C_CMD_START;
+        i2c->TXDATA = ti->qaddress[0];
+        ti->state = STATE_Q_WADDR;
+    }
+}
+
+/**
+ * @brief   Remove current transaction, call its callback and start the next one
+ *
+ * @note    The callback is called in interrupt context and can enqueue other transactions
+ */
+static void CompleteTransaction(I2C_TypeDef *i2c, TransferInfo *ti, int status) {
+I2CMaster_TransactionType *t = ti->head;
+
+    StopDMA(i2c,ti);
+
+    ti->head = t->next;
+    if( ti->head == 0 )
+        ti->tail = 0;
+    t->next   = 0;
+    t->status = status;
+
+    if( t->callback )
+        t->callback(t);
+
+    if( ti->head ) {
+        StartTransaction(i2c,ti);
+    } else {
+        ti->state = STATE_IDLE;
+        i2c->IEN &= ~QUEUE_INTERRUPTS;
+    }
+}
+
+/**
+ * @brief   End current transaction after the last byte
+ *
+ * @note    With I2CMASTER_TRANS_REPEATEDSTART and another transaction in the queue, the
+ *          bus is not released and the next transaction starts with a repeated START
+ */
+static void EndTransaction(I2C_TypeDef *i2c, TransferInfo *ti) {
+I2CMaster_TransactionType *t = ti->head;
+
+    if( (t->flags&I2CMASTER_TRANS_REPEATEDSTART) && t->next ) {
+        CompleteTransaction(i2c,ti,I2CMASTER_TRANS_OK);
+    } else {
+        i2c->CMD = I2C_CMD_STOP;
+        ti->state = STATE_Q_STOP;
+    }
+}
+
+/**
+ * @brief   Send next byte of write phase or switch to the read phase
+ *
+ * @note    A long write phase is transferred by DMA. The ACK interrupt is disabled until
+ *          the last byte has been transmitted.
+ */
+static void WriteNext(I2C_TypeDef *i2c, TransferInfo *ti) {
+I2CMaster_TransactionType *t = ti->head;
+
+    if( ti->woffset == 0 && ti->dmatx >= 0 && t->wsize >= I2C_DMA_MINSIZE ) {
+        ti->dmadone   = 0;
+        ti->dmaactive = DMA_TX;
+        ti->state     = STATE_Q_WDMA;
+        i2c->IEN &= ~I2C_IEN_ACK;
+        DMA_StartTx(ti->dmatx,dmasignals[i2c==I2C1][1],&(i2c->TXDATA),
+                    t->wdata,t->wsize,DMACallback);
+    } else if( ti->woffset < t->wsize ) {
+        i2c->TXDATA = t->wdata[ti->woffset++];
+        ti->state = STATE_Q_WRITE;
+    } else if( t->rsize != 0 ) {
+        // Repeated START and address in read form
+        StartRead(i2c,ti);
+    } else {
+        EndTransaction(i2c,ti);
+    }
+}
+
+/**
+ * @brief   End of the DMA write phase
+ */
+static void WriteDMAEnd(I2C_TypeDef *i2c, TransferInfo *ti) {
+
+    StopDMA(i2c,ti);
+    i2c->IFC = I2C_IFC_ACK|I2C_IFC_TXC;
+    ti->woffset = ti->head->wsize;
+    WriteNext(i2c,ti);
+}
+
+/**
+ * @brief   Interrupt processing for queued transactions
+ *
+ * @note    AUTOSN is set, so a STOP is sent automatically when a NACK is received
+ */
+static void ProcessQueue(I2C_TypeDef *i2c, TransferInfo *ti) {
+I2CMaster_TransactionType *t = ti->head;
+uint32_t flags;
+
+    flags = i2c->IF&i2c->IEN;
+    i2c->IFC = flags;
+
+    // Errors abort current transaction
+    if( flags&(I2C_IF_ARBLOST|I2C_IF_BUSERR) ) {
+        if( flags&I2C_IF_BUSERR )
+            i2c->CMD = I2C_CMD_ABORT;
+        CompleteTransaction(i2c,ti,(flags&I2C_IF_BUSERR)?I2CMASTER_TRANS_BUSERR
+                                                          :I2CMASTER_TRANS_ARBLOST);
+        return;
+    }
+    if( (flags&I2C_IF_NACK) && ti->state != STATE_Q_STOP ) {
+        if( ti->dmaactive != DMA_NONE ) {
+            StopDMA(i2c,ti);
+            i2c->CMD = I2C_CMD_CLEARTX;
+        }
+        ti->qerror = I2CMASTER_TRANS_NACK;
+        ti->state  = STATE_Q_STOP;
+        return;
+    }
+
+    switch(ti->state) {
+    case STATE_Q_WADDR:
+        if( flags&I2C_IF_ACK ) {
+            if( ti->addressbytes == 2 ) {
+                i2c->TXDATA = ti->qaddress[1];
+                ti->state = STATE_Q_WADDR2;
+            } else {
+                WriteNext(i2c,ti);
+            }
+        }
+        break;
+    case STATE_Q_WADDR2:
+    case STATE_Q_WRITE:
+        if( flags&I2C_IF_ACK )
+            WriteNext(i2c,ti);
+        break;
+    case STATE_Q_WDMA:
+        // All bytes are in the transmitter. Wait until the last one is sent
+        if( ti->dmadone ) {
+            ti->dmadone = 0;
+            if( i2c->STATUS&I2C_STATUS_TXC ) {
+                WriteDMAEnd(i2c,ti);
+                break;
+            }
+            i2c->IFC  = I2C_IFC_TXC;
+            i2c->IEN |= I2C_IEN_TXC;
+            ti->state = STATE_Q_WDMAEND;
+            if( i2c->STATUS&I2C_STATUS_TXC )
+                WriteDMAEnd(i2c,ti);
+        }
+        break;
+    case STATE_Q_WDMAEND:
+        if( flags&I2C_IF_TXC )
+            WriteDMAEnd(i2c,ti);
+        break;
+    case STATE_Q_RADDR:
+        // Slave starts sending after the ACK
+        if( (flags&(I2C_IF_ACK|I2C_IF_RXDATAV)) || ti->dmadone )
+            ti->state = (ti->dmaactive==DMA_RX) ? STATE_Q_RDMA : STATE_Q_READ;
+        if( ti->state == STATE_Q_RADDR )
+            break;
+        // FALLTHRU
+    case STATE_Q_RDMA:
+        // Last two bytes are received by software
+        if( ti->state == STATE_Q_RDMA ) {
+            if( !ti->dmadone )
+                break;
+            StopDMA(i2c,ti);
+            ti->roffset = t->rsize-2;
+            ti->state   = STATE_Q_READ;
+            flags       = i2c->IF&I2C_IF_RXDATAV;
+        }
+        // FALLTHRU
+    case STATE_Q_READ:
+        if( flags&I2C_IF_RXDATAV ) {
+            t->rdata[ti->roffset++] = i2c->RXDATA;
+            if( ti->roffset < t->rsize ) {
+                i2c->CMD = I2C_CMD_ACK;
+            } else {
+                i2c->CMD = I2C_CMD_NACK;
+                EndTransaction(i2c,ti);
+            }
+        }
+        break;
+    case STATE_Q_STOP:
+        if( flags&I2C_IF_MSTOP )
+            CompleteTransaction(i2c,ti,ti->qerror);
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief   Configure DMA channels for queued transactions
+ *
+ * @param   txchn: channel for write phases (-1: no DMA)
+ * @param   rxchn: channel for read phases (-1: no DMA)
+ *
+ * @note    Data phases with at least I2C_DMA_MINSIZE bytes are transferred by DMA.
+ *          DMA is initialized if it is not enabled yet.
+ *
+ * @note    Must not be called while there are transactions in the queue
+ */
+int I2CMaster_ConfigDMA(I2C_TypeDef *i2c, int txchn, int rxchn) {
+TransferInfo *ti;
+
+    ti = GetTransferInfo(i2c);
+    if( ti == 0 || ti->head )
+        return -1;
+    if( txchn >= DMA_CHAN_COUNT || rxchn >= DMA_CHAN_COUNT )
+        return -1;
+    if( txchn >= 0 && txchn == rxchn )
+        return -1;
+
+    if( (txchn >= 0 || rxchn >= 0) && (DMA->STATUS&DMA_STATUS_EN) == 0 )
+        DMA_Init(0);
+
+    ti->dmatx = txchn < 0 ? -1 : txchn;
+    ti->dmarx = rxchn < 0 ? -1 : rxchn;
+    return 0;
+}
+
+
+/**
+ * @brief   Add a transaction to the queue
+ *
+ * @note    The descriptor and the buffers must not be changed until the transaction ends.
+ *          Its status is I2CMASTER_TRANS_PENDING until then. The callback (if not null)
+ *          is called in interrupt context when it ends.
+ *
+ * @note    When the queue is empty, the transaction is started immediately.
+ *
+ * @note    Can be called from the callback of a transaction.
+ *
+ * @return  0 if OK, negative if the descriptor is invalid or a non queued transfer is
+ *          in progress
+ */
+int I2CMaster_Enqueue(I2C_TypeDef *i2c, I2CMaster_TransactionType *t) {
+TransferInfo *ti;
+uint32_t primask;
+int rc = 0;
+
+    ti = GetTransferInfo(i2c);
+    if( ti == 0 || t == 0 )
+        return -1;
+    if( t->address > 1023 || (t->wsize && t->wdata == 0) || (t->rsize && t->rdata == 0) )
+        return -1;
+
+    t->next   = 0;
+    t->status = I2CMASTER_TRANS_PENDING;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if( ti->head ) {
+        ti->tail->next = t;
+        ti->tail       = t;
+    } else if( ti->state == STATE_IDLE || ti->state == STATE_ERROR ) {
+        ti->head = t;
+        ti->tail = t;
+        i2c->IFC = _I2C_IFC_MASK;
+        i2c->IEN = (i2c->IEN&~(I2C_IEN_TXBL|I2C_IEN_START))|QUEUE_INTERRUPTS;
+        StartTransaction(i2c,ti);
+    } else {
+        rc = -2;
+    }
+    __set_PRIMASK(primask);
+
+    return rc;
+}
+
+/**
+ * @brief   Return the number of transactions in the queue (including the current one)
+ */
+int I2CMaster_QueueCount(I2C_TypeDef *i2c) {
+TransferInfo *ti;
+I2CMaster_TransactionType *t;
+uint32_t primask;
+int n = 0;
+
+    ti = GetTransferInfo(i2c);
+    if( ti == 0 )
+        return 0;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    for(t=ti->head;t;t=t->next)
+        n++;
+    __set_PRIMASK(primask);
+
+    return n;
+}
+
+/**
+ * @brief   Remove all transactions waiting in the queue
+ *
+ * @note    The current transaction is not affected. The removed ones get the status
+ *          I2CMASTER_TRANS_ABORTED and their callbacks are not called.
+ */
+int I2CMaster_QueueFlush(I2C_TypeDef *i2c) {
+TransferInfo *ti;
+I2CMaster_TransactionType *t,*next;
+uint32_t primask;
+
+    ti = GetTransferInfo(i2c);
+    if( ti == 0 )
+        return -1;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if( ti->head ) {
+        t = ti->head->next;
+        ti->head->next = 0;
+        ti->tail = ti->head;
+    } else {
+        t = 0;
+    }
+    __set_PRIMASK(primask);
+
+    while( t ) {
+        next = t->next;
+        t->next   = 0;
+        t->status = I2CMASTER_TRANS_ABORTED;
+        t = next;
+    }
+    return 0;
+}
+
+/**
+ * @brief   Wait until a transaction ends
+ *
+ * @return  status of the transaction
+ */
+int I2CMaster_Wait(I2CMaster_TransactionType *t) {
+
+    while( t->status == I2CMASTER_TRANS_PENDING ) {}
+    return t->status;
+}
+
+
 /**
  * @brief   Initialize TransferInfo
  */
@@ -297,6 +823,8 @@ static void TransferInfoInit(TransferInfo *ti, uint16_t isize, uint16_t osize) {
     ti->operation    = OP_NONE;
     ti->state        = STATE_IDLE;
     ti->addressbytes = 1;
+    ti->head         = 0;
+    ti->tail         = 0;
 }
 
 /**
@@ -306,12 +834,19 @@ static void TransferInfoInit(TransferInfo *ti, uint16_t isize, uint16_t osize) {
  */
 int I2CMaster_Clear(I2C_TypeDef *i2c) {
 TransferInfo *ti;
+I2CMaster_TransactionType *t;
 
     ti = GetTransferInfo(i2c);
     if( ti == 0 ) {
         return 0;
     }
 
+    /* Abort queued transactions */
+    StopDMA(i2c,ti);
+    i2c->IEN &= ~QUEUE_INTERRUPTS;
+    for(t=ti->head;t;t=t->next)
+        t->status = I2CMASTER_TRANS_ABORTED;
+
     TransferInfoInit(ti,0,0);
 
     /* Clear transmission */
@@ -360,7 +895,7 @@ TransferInfo *ti;
  *
  * @return 0: OK. Negative: Error
  */
-static int I2CMaster_EnableClock(I2C_TypeDef *i2c) {
+int I2CMaster_EnableClock(I2C_TypeDef *i2c) {
 
     /* Enable peripheral clock and GPIO clock (needed for the I/O pins) */
     CMU->HFPERCLKDIV |= CMU_HFPERCLKDIV_HFPERCLKEN;     // Enable HFPERCLK
@@ -410,7 +945,7 @@ static I2C_PinConfig_t pinconf[] = {
     {   I2C0,   6,  GPIOE, 13, 12   },
     /* I2C1 */
     {   I2C1,   0,  GPIOC,  5,  4   },
-    {   I2C1,   1,  GPIOB, 12,  4   },
+    {   I2C1,   1,  GPIOB, 12, 11   },
     {   I2C1,   2,  GPIOE,  1,  0   },
     /* End of table */
     {      0,   0,      0,  0,  0   }
@@ -426,9 +961,10 @@ static I2C_PinConfig_t pinconf[] = {
  *    i2c:     I2C unit
  *    loc:     Location code for both (SCL and SDA) pins (See above)
  *
+ * @note    Also used by i2cslave.c
  */
 
-static int
+int
 I2CMaster_ConfigPins(I2C_TypeDef *i2c,uint8_t loc) {
 I2C_PinConfig_t *p = pinconf;
 
@@ -439,7 +975,7 @@ I2C_PinConfig_t *p = pinconf;
                                     GPIO_MODE_WIREDANDDRIVEPULLUPFILTER);
             return 0;
         }
-
+        p++;
     }
     return -1;
 }
@@ -473,6 +1009,11 @@ uint32_t irqn;
     // Enable clock for I2C peripheral
     I2CMaster_EnableClock(i2c);
 
+    /* No transfer and no DMA */
+    TransferInfoInit(GetTransferInfo(i2c),0,0);
+    GetTransferInfo(i2c)->dmatx = -1;
+    GetTransferInfo(i2c)->dmarx = -1;
+
     /* Enable I2C Pins */
     I2CMaster_ConfigPins(i2c,loc);
 
@@ -492,7 +1033,7 @@ uint32_t irqn;
 
     /* Additional configuration */
     i2c->CTRL |= I2C_CTRL_AUTOSN;         /* Automatic STOP on NACK (Master only) */
-    i2c->CTRL |= I2C_CTRL_AUTOACK;        /* Automatic STOP on NACK (Master only) */
+    i2c->CTRL &= ~I2C_CTRL_AUTOACK;       /* ACK/NACK are sent by software */
 
     /* Clear all interrupts */
     i2c->IFC = (uint32_t) (-1);
@@ -27,6 +27,42 @@
 #define I2CMASTER_LOC_5          (5)
 #define I2CMASTER_LOC_6          (6)
 
+/**
+ * @brief  Transaction descriptor
+ *
+ * @note   A write (rsize=0), a read (wsize=0) or a write followed by a read after a
+ *         repeated START. With wsize=rsize=0, only the address is sent (probe).
+ *
+ * @note   With I2CMASTER_TRANS_REPEATEDSTART, no STOP is sent at the end and the next
+ *         transaction in the queue starts with a repeated START. If there is no next
+ *         transaction, a STOP is sent.
+ */
+///@{
+#define I2CMASTER_TRANS_REPEATEDSTART   (0x0001)
+
+#define I2CMASTER_TRANS_PENDING         (1)
+#define I2CMASTER_TRANS_OK              (0)
+#define I2CMASTER_TRANS_NACK            (-1)
+#define I2CMASTER_TRANS_ARBLOST         (-2)
+#define I2CMASTER_TRANS_BUSERR          (-3)
+#define I2CMASTER_TRANS_ABORTED         (-4)
+
+typedef struct I2CMaster_Transaction_Struct I2CMaster_TransactionType;
+
+struct I2CMaster_Transaction_Struct {
+    uint16_t                    address;        /**< 7 or 10 bit address      */
+    uint16_t                    flags;
+    const uint8_t              *wdata;
+    uint16_t                    wsize;
+    uint8_t                    *rdata;
+    uint16_t                    rsize;
+    void                      (*callback)(I2CMaster_TransactionType *t);
+    void                       *context;        /**< free for the caller      */
+    volatile int                status;         /**< I2CMASTER_TRANS_*        */
+    I2CMaster_TransactionType  *next;           /**< used by the queue        */
+};
+///@}
+
 /**
  * @brief  Send routines
  */
@@ -49,6 +85,13 @@ int I2CMaster_GetState(
 int I2CMaster_Clear(
                     I2C_TypeDef *unit
                 );
+int I2CMaster_EnableClock(
+                    I2C_TypeDef *unit
+                );
+int I2CMaster_ConfigPins(
+                    I2C_TypeDef *unit,
+                    uint8_t loc
+                );
 ///@}
 
 /**
@@ -128,5 +171,29 @@ int I2CMaster_SendReceiveGetData(
                 );
 ///@}
 
+/**
+ * @brief Transaction queue
+ */
+///@{
+int I2CMaster_Enqueue(
+                    I2C_TypeDef *unit,
+                    I2CMaster_TransactionType *t
+                );
+int I2CMaster_QueueCount(
+                    I2C_TypeDef *unit
+                );
+int I2CMaster_QueueFlush(
+                    I2C_TypeDef *unit
+                );
+int I2CMaster_Wait(
+                    I2CMaster_TransactionType *t
+                );
+int I2CMaster_ConfigDMA(
+                    I2C_TypeDef *unit,
+                    int txchn,
+                    int rxchn
+                );
+///@}
+
 
 #endif // I2CMASTER_H
@@ -0,0 +1,440 @@
+/**
+ * @file    i2cslave.c
+ * @brief   I2C HAL for EFM32GG (slave mode)
+ * @version 1.0
+ *
+ * @note    The unit answers to a 7-bit address and exposes a register map in RAM. The
+ *          first byte of a write is the register address. The next ones are stored in
+ *          the map. A read starts at the register address and it is incremented after
+ *          each byte. Nothing is copied: reads come from the map and writes go into it.
+ *
+ * @note    A region of the map can be double buffered (snapshot). The application fills
+ *          one buffer while the host reads the other one. The buffer is selected at the
+ *          start of each read, so the host always gets a complete sample set, even if a
+ *          new one is published in the middle of the read.
+ *
+ * @note    ACK is automatic (AUTOACK). In a read, the next byte is written in TXDATA as
+ *          soon as the previous one is moved to the shift register (TXBL), so the clock
+ *          is only stretched for the first byte.
+ *
+ * @note    The interrupt handlers are in i2cmaster.c (I2C_SLAVE_SUPPORT).
+ */
+
+#include  <stdint.h>
+#include "em_device.h"
+#include "i2cmaster.h"
+#include "i2cslave.h"
+
+#ifndef I2CSLAVEINTLEVEL
+#define I2CSLAVEINTLEVEL    (2)
+#endif
+
+/**
+ * @brief   Value returned for registers outside the map
+ */
+#define I2CSLAVE_FILL                       (0xFF)
+
+/**
+ * @brief   Transfer phases
+ */
+typedef enum {
+        PHASE_IDLE,
+        PHASE_WREG,
+        PHASE_WDATA,
+        PHASE_READ
+    } Phase_t;
+
+/**
+ * @brief   Write callback range
+ */
+typedef struct {
+    uint16_t                first;
+    uint16_t                last;
+    I2CSlave_WriteCallback  callback;
+    void                   *context;
+} CallbackInfo;
+
+/**
+ * @brief   Slave information
+ */
+typedef struct {
+    uint8_t                *regs;
+    uint16_t                size;
+    uint8_t                *snap[2];                /**< double buffered region   */
+    uint16_t                snapreg;
+    uint16_t                snapsize;
+    volatile uint8_t        front;                  /**< last published buffer    */
+    volatile int8_t         reading;                /**< buffer in use or -1      */
+    Phase_t                 phase;
+    uint16_t                pointer;                /**< register address         */
+    uint16_t                wstart;
+    uint16_t                wcount;
+    uint8_t                 ncallbacks;
+    CallbackInfo            callbacks[I2CSLAVE_MAXCALLBACKS];
+    uint32_t                errors;
+} SlaveInfo;
+
+static SlaveInfo slaveinfo[2];
+
+/**
+ * @brief   Interrupts used in slave mode (TXBL is only enabled during reads)
+ */
+#define SLAVE_INTERRUPTS    (I2C_IEN_ADDR|I2C_IEN_RXDATAV|I2C_IEN_SSTOP|I2C_IEN_NACK\
+                            |I2C_IEN_BUSERR)
+
+/**
+ * @brief   GetSlaveInfo from I2C pointer
+ */
+static SlaveInfo *GetSlaveInfo(I2C_TypeDef *i2c) {
+
+    if( i2c == I2C0 ) {
+        return &slaveinfo[0];
+    } else if ( i2c == I2C1 ) {
+        return &slaveinfo[1];
+    } else {
+        return 0;
+    }
+}
+
+/**
+ * @brief   Register value for a read
+ *
+ * @note    Registers in the snapshot region come from the buffer selected at the start
+ *          of the read
+ */
+static uint8_t ReadRegister(SlaveInfo *si, uint16_t reg) {
+uint16_t offset = reg-si->snapreg;
+
+    if( offset < si->snapsize )
+        return si->snap[(int) si->reading][offset];
+    if( reg < si->size )
+        return si->regs[reg];
+    return I2CSLAVE_FILL;
+}
+
+/**
+ * @brief   Store a register written by the host
+ *
+ * @note    The snapshot region is read only
+ */
+static void WriteRegister(SlaveInfo *si, uint16_t reg, uint8_t v) {
+uint16_t offset = reg-si->snapreg;
+
+    if( offset < si->snapsize || reg >= si->size )
+        return;
+    si->regs[reg] = v;
+}
+
+/**
+ * @brief   End of a write
+ *
+ * @note    Each callback is called once with the registers written in its range
+ */
+static void EndWrite(I2C_TypeDef *i2c, SlaveInfo *si) {
+CallbackInfo *cb;
+uint16_t first,last;
+int i;
+
+    if( si->phase == PHASE_WDATA && si->wcount > 0 ) {
+        for(i=0;i<si->ncallbacks;i++) {
+            cb = &si->callbacks[i];
+            first = (si->wstart > cb->first) ? si->wstart : cb->first;
+            last  = si->wstart+si->wcount-1;
+            if( last > cb->last )
+                last = cb->last;
+            if( first <= last )
+                cb->callback(i2c,first,last-first+1,cb->context);
+        }
+    }
+    si->phase = PHASE_IDLE;
+}
+
+/**
+ * @brief   End of a read
+ *
+ * @note    The byte still in TXDATA was not sent, so the register address goes back
+ *          one position and the byte is discarded
+ */
+static void EndRead(I2C_TypeDef *i2c, SlaveInfo *si) {
+
+    i2c->IEN &= ~I2C_IEN_TXBL;
+    if( (i2c->STATUS&I2C_STATUS_TXBL) == 0 ) {
+        i2c->CMD = I2C_CMD_CLEARTX;
+        si->pointer--;
+    }
+    si->reading = -1;
+    si->phase = PHASE_IDLE;
+}
+
+/**
+ * @brief   End of the current transfer
+ */
+static void EndTransfer(I2C_TypeDef *i2c, SlaveInfo *si) {
+
+    if( si->phase == PHASE_READ ) {
+        EndRead(i2c,si);
+    } else {
+        EndWrite(i2c,si);
+    }
+}
+
+/**
+ * @brief   Interrupt routine for units in slave mode
+ *
+ * @note    Called by the I2C interrupt handlers in i2cmaster.c
+ */
+void I2CSlave_ProcessInterrupt(I2C_TypeDef *i2c) {
+SlaveInfo *si;
+uint32_t iflags;
+uint8_t b;
+
+    si = GetSlaveInfo(i2c);
+    if( si == 0 )
+        return;
+
+    iflags = i2c->IF&i2c->IEN;
+
+    if( iflags&I2C_IF_BUSERR ) {
+        i2c->IFC = I2C_IFC_BUSERR;
+        si->errors++;
+        EndTransfer(i2c,si);
+        return;
+    }
+
+    // Master does not want more data
+    if( iflags&I2C_IF_NACK ) {
+        i2c->IFC = I2C_IFC_NACK;
+        if( si->phase == PHASE_READ )
+            EndRead(i2c,si);
+        iflags &= ~I2C_IF_TXBL;
+    }
+
+    // Address match (after a START or a repeated START). RXDATA has the address byte.
+    if( iflags&I2C_IF_ADDR ) {
+        EndTransfer(i2c,si);
+        b = i2c->RXDATA;
+        i2c->IFC = I2C_IFC_ADDR;
+        if( b&1 ) {
+            si->reading = si->front;
+            si->phase = PHASE_READ;
+            i2c->TXDATA = ReadRegister(si,si->pointer++);
+            i2c->IEN |= I2C_IEN_TXBL;
+            iflags &= ~I2C_IF_TXBL;
+        } else {
+            si->phase = PHASE_WREG;
+        }
+    }
+
+    // Data from master (RXDATAV is cleared by reading RXDATA)
+    while( i2c->STATUS&I2C_STATUS_RXDATAV ) {
+        b = i2c->RXDATA;
+        if( si->phase == PHASE_WREG ) {
+            si->pointer = b;
+            si->wstart = b;
+            si->wcount = 0;
+            si->phase = PHASE_WDATA;
+        } else if( si->phase == PHASE_WDATA ) {
+            WriteRegister(si,si->pointer++,b);
+            si->wcount++;
+        }
+    }
+
+    // Next byte to master
+    if( (iflags&I2C_IF_TXBL) && si->phase == PHASE_READ ) {
+        i2c->TXDATA = ReadRegister(si,si->pointer++);
+    }
+
+    if( iflags&I2C_IF_SSTOP ) {
+        i2c->IFC = I2C_IFC_SSTOP;
+        EndTransfer(i2c,si);
+    }
+}
+
+/**
+ * @brief   Configure a double buffered region of the register map
+ *
+ * @param   reg:  first register of the region
+ * @param   buf0: first buffer (size bytes)
+ * @param   buf1: second buffer (size bytes)
+ *
+ * @note    The region replaces the map registers at the same addresses. It can be
+ *          outside the map (e.g. map with the configuration registers at 0 and samples
+ *          at 0x80). buf0 is published first.
+ */
+int I2CSlave_ConfigSnapshot(I2C_TypeDef *i2c, uint16_t reg, uint8_t *buf0, uint8_t *buf1,
+                                                                        uint16_t size) {
+SlaveInfo *si;
+uint32_t primask;
+
+    si = GetSlaveInfo(i2c);
+    if( si == 0 || buf0 == 0 || buf1 == 0 || reg+size > I2CSLAVE_MAPSIZE )
+        return -1;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if( si->reading >= 0 ) {
+        __set_PRIMASK(primask);
+        return -2;
+    }
+    si->snap[0]  = buf0;
+    si->snap[1]  = buf1;
+    si->snapreg  = reg;
+    si->snapsize = size;
+    si->front    = 0;
+    __set_PRIMASK(primask);
+    return 0;
+}
+
+/**
+ * @brief   Get the buffer to be filled with the next snapshot
+ *
+ * @note    The sample set is written directly in it and then published by
+ *          I2CSlave_PublishSnapshot. The content is the one of two snapshots ago.
+ *
+ * @return  pointer to buffer or 0 if the host is still reading it
+ */
+uint8_t *I2CSlave_GetSnapshotBuffer(I2C_TypeDef *i2c) {
+SlaveInfo *si;
+int back;
+
+    si = GetSlaveInfo(i2c);
+    if( si == 0 || si->snapsize == 0 )
+        return 0;
+
+    back = si->front^1;
+    if( si->reading == back )
+        return 0;
+    return si->snap[back];
+}
+
+/**
+ * @brief   Publish the buffer returned by I2CSlave_GetSnapshotBuffer
+ *
+ * @note    Reads that start after it use the new buffer. A read in progress
+ *          continues with the old one.
+ */
+int I2CSlave_PublishSnapshot(I2C_TypeDef *i2c) {
+SlaveInfo *si;
+
+    si = GetSlaveInfo(i2c);
+    if( si == 0 || si->snapsize == 0 )
+        return -1;
+
+    si->front ^= 1;
+    return 0;
+}
+
+/**
+ * @brief   Add a callback for writes to registers first to last (inclusive)
+ *
+ * @note    Ranges can overlap
+ */
+int I2CSlave_AddWriteCallback(I2C_TypeDef *i2c, uint16_t first, uint16_t last,
+                                    I2CSlave_WriteCallback callback, void *context) {
+SlaveInfo *si;
+CallbackInfo *cb;
+uint32_t primask;
+
+    si = GetSlaveInfo(i2c);
+    if( si == 0 || callback == 0 || first > last )
+        return -1;
+    if( si->ncallbacks >= I2CSLAVE_MAXCALLBACKS )
+        return -2;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    cb = &si->callbacks[si->ncallbacks];
+    cb->first    = first;
+    cb->last     = last;
+    cb->callback = callback;
+    cb->context  = context;
+    si->ncallbacks++;
+    __set_PRIMASK(primask);
+    return 0;
+}
+
+/**
+ * @brief   Number of bus errors
+ */
+int I2CSlave_GetErrors(I2C_TypeDef *i2c) {
+SlaveInfo *si;
+
+    si = GetSlaveInfo(i2c);
+    if( si == 0 )
+        return -1;
+    return (int) si->errors;
+}
+
+/**
+ * @brief   Initialize I2C unit as slave
+ *
+ * @param   address: 7-bit address (0x08 to 0x77)
+ * @param   loc:     location code for both pins (See i2cmaster.c)
+ * @param   regs:    register map (size bytes)
+ *
+ * @note    The other unit can be used as master at the same time (e.g. I2C1 reading
+ *          the sensors and I2C0 connected to the host)
+ */
+int I2CSlave_Init(I2C_TypeDef *i2c, uint8_t address, uint8_t loc, uint8_t *regs,
+                                                                        uint16_t size) {
+SlaveInfo *si;
+uint32_t irqn;
+
+    if( i2c == I2C0 ) {
+        irqn = I2C0_IRQn;
+    } else if ( i2c == I2C1 ) {
+        irqn = I2C1_IRQn;
+    } else {
+        return -1;
+    }
+    if( address < 0x08 || address > 0x77 || size > I2CSLAVE_MAPSIZE || (regs == 0 && size) )
+        return -1;
+
+    NVIC_DisableIRQ(irqn);
+
+    si = GetSlaveInfo(i2c);
+    si->regs       = regs;
+    si->size       = size;
+    si->snap[0]    = 0;
+    si->snap[1]    = 0;
+    si->snapreg    = 0;
+    si->snapsize   = 0;
+    si->front      = 0;
+    si->reading    = -1;
+    si->phase      = PHASE_IDLE;
+    si->pointer    = 0;
+    si->ncallbacks = 0;
+    si->errors     = 0;
+
+    // Enable clock for I2C peripheral
+    I2CMaster_EnableClock(i2c);
+
+    /* Enable I2C Pins */
+    if( I2CMaster_ConfigPins(i2c,loc) < 0 )
+        return -1;
+
+    /* Slave with automatic ACK for address and data */
+    i2c->CTRL = I2C_CTRL_SLAVE|I2C_CTRL_AUTOACK|I2C_CTRL_EN;
+
+    /* Only the given address (no general call) */
+    i2c->SADDR     = (uint32_t) address<<_I2C_SADDR_ADDR_SHIFT;
+    i2c->SADDRMASK = _I2C_SADDRMASK_MASK_MASK;
+
+    /* Configure pins to be used for I2C_TypeDef */
+    i2c->ROUTE = (i2c->ROUTE&~_I2C_ROUTE_LOCATION_MASK)|(loc<<_I2C_ROUTE_LOCATION_SHIFT);
+    i2c->ROUTE |= (I2C_ROUTE_SCLPEN|I2C_ROUTE_SDAPEN);
+
+    /* Bus is assumed busy after enable */
+    i2c->CMD = I2C_CMD_ABORT|I2C_CMD_CLEARTX|I2C_CMD_CLEARPC;
+
+    /* Clear all interrupts */
+    i2c->IFC = (uint32_t) (-1);
+    i2c->IEN = SLAVE_INTERRUPTS;
+
+    /* Configure interrupts */
+    NVIC_SetPriority(irqn,I2CSLAVEINTLEVEL);
+    NVIC_ClearPendingIRQ(irqn);
+    NVIC_EnableIRQ(irqn);
+
+    return 0;
+}
@@ -0,0 +1,66 @@
+#ifndef I2CSLAVE_H
+#define I2CSLAVE_H
+/**
+ * @file    i2cslave.h
+ * @brief   I2C HAL for EFM32GG (slave mode with a register map)
+ *
+ * @note    The host writes the register address (one byte) and then data, or reads
+ *          from the last register address. The address is incremented after each byte.
+ *
+ * @version 1.0
+ */
+
+#include <stdint.h>
+
+/**
+ * @brief   Register map limits
+ */
+///@{
+#define I2CSLAVE_MAPSIZE                (256)
+#define I2CSLAVE_MAXCALLBACKS           (4)
+///@}
+
+/**
+ * @brief   Write callback
+ *
+ * @note    Called in interrupt context at the end of a write (STOP or repeated START),
+ *          with the registers written in its range. The data is already in the map.
+ */
+typedef void (*I2CSlave_WriteCallback)(I2C_TypeDef *unit, uint16_t reg, uint16_t count,
+                                                                        void *context);
+
+int I2CSlave_Init(
+                    I2C_TypeDef *unit,
+                    uint8_t address,
+                    uint8_t loc,
+                    uint8_t *regs,
+                    uint16_t size
+                );
+int I2CSlave_ConfigSnapshot(
+                    I2C_TypeDef *unit,
+                    uint16_t reg,
+                    uint8_t *buf0,
+                    uint8_t *buf1,
+                    uint16_t size
+                );
+uint8_t *I2CSlave_GetSnapshotBuffer(
+                    I2C_TypeDef *unit
+                );
+int I2CSlave_PublishSnapshot(
+                    I2C_TypeDef *unit
+                );
+int I2CSlave_AddWriteCallback(
+                    I2C_TypeDef *unit,
+                    uint16_t first,
+                    uint16_t last,
+                    I2CSlave_WriteCallback callback,
+                    void *context
+                );
+int I2CSlave_GetErrors(
+                    I2C_TypeDef *unit
+                );
+void I2CSlave_ProcessInterrupt(
+                    I2C_TypeDef *unit
+                );
+
+#endif // I2CSLAVE_H
@@ -121,13 +121,62 @@
 
 #include <stdint.h>
 #include "em_device.h"
+#include "gpio.h"
 #include "i2cmaster.h"
 #include "mpu60x0.h"
+#if !MPU60X0_GPIO_IRQ
+#include "button.h"
+#endif
 
+/**
+ * @brief   Streaming mode configuration
+ *
+ * @note    The GPIO interrupt handlers are also defined in button.c. When
+ *          MPU60X0_GPIO_IRQ is zero, the data ready routine is registered there with
+ *          Button_SetPinHandler. When it is one, they are defined here and button.c
+ *          cannot be used.
+ *
+ * @note    The GPIO interrupt must have the same priority as the I2C interrupt. It is
+ *          set by MPU60x0_StartStream, so Button_Init must be called before it.
+ */
+///@{
+#ifndef MPU60X0_GPIO_IRQ
+#define MPU60X0_GPIO_IRQ            0
+#endif
+#ifndef MPU60X0_INT_LEVEL
+#define MPU60X0_INT_LEVEL           5       // Same as I2CINTLEVEL
+#endif
+#define MPU60X0_EDGES               128     // Data-ready timestamps kept (power of 2)
+///@}
+
+/**
+ * @brief   Streaming state
+ */
+///@{
+#define STREAM_OFF                  0
+#define STREAM_IDLE                 1
+#define STREAM_COUNT                2       // Reading FIFO count
+#define STREAM_DATA                 3       // Reading FIFO data
+#define STREAM_RESET                4       // Resetting FIFO
+///@}
 
 struct MPU60x0_Struct {
     I2C_TypeDef             *i2c;
     uint16_t                addr;
+    // Streaming mode
+    volatile uint8_t        state;
+    uint8_t                 cur;                    /**< block being filled       */
+    uint8_t                 pin;
+    uint16_t                batch;
+    uint8_t                 buf[2];                 /**< FIFO count/register write*/
+    I2CMaster_TransactionType trans;
+    void                    (*callback)(MPU60x0_Type *mpu, const MPU60x0_BlockType *block);
+    volatile uint32_t       edges;                  /**< data-ready interrupts    */
+    uint32_t                seq;                    /**< samples read             */
+    uint32_t                lost;
+    uint32_t                errors;
+    uint32_t                edgetime[MPU60X0_EDGES];
+    MPU60x0_BlockType       blocks[2];
 };
 
 typedef union {
@@ -146,28 +195,64 @@ MPU60x0_Type Mpu = { 0 };
 
 MPU60x0_Type *MPU60x0_Init(I2C_TypeDef *i2c, uint16_t addr) {
 
-
+    Mpu.i2c   = i2c;
+    Mpu.addr  = addr;
+    Mpu.state = STREAM_OFF;
     return &Mpu;
 }
 
 
+/**
+ *  @brief  Blocking transfer using the I2C transaction queue
+ *
+ *  @note   Must not be called from an interrupt routine
+ *
+ *  @return 0 if OK, negative if error
+ */
+static int Transfer(MPU60x0_Type *mpu, const uint8_t *wdata, int wsize,
+                    uint8_t *rdata, int rsize) {
+I2CMaster_TransactionType t = { 0 };
+
+    t.address = mpu->addr;
+    t.wdata   = wdata;
+    t.wsize   = wsize;
+    t.rdata   = rdata;
+    t.rsize   = rsize;
+    if( I2CMaster_Enqueue(mpu->i2c,&t) < 0 )
+        return -1;
+    return I2CMaster_Wait(&t);
+}
+
+
 /**
  *  @brief   Write a register
  *
  */
 int MPU60x0_WriteRegister(MPU60x0_Type *mpu, uint8_t reg, uint8_t val) {
+uint8_t outdata[2];
 
-    return 0;
+    outdata[0] = reg;
+    outdata[1] = val;
+    return Transfer(mpu,outdata,2,0,0);
 }
 
 
 /**
  *  @brief  Write registers starting at a given value
  *
+ *  @note   At most 16 registers
  */
 int MPU60x0_WriteMultipleRegisters( MPU60x0_Type *mpu, uint8_t startreg, int count, uint8_t *data) {
+uint8_t outdata[17];
+int i;
 
-    return 0;
+    if( count < 1 || count > 16 )
+        return -1;
+
+    outdata[0] = startreg;
+    for(i=0;i<count;i++)
+        outdata[i+1] = data[i];
+    return Transfer(mpu,outdata,count+1,0,0);
 }
 
 
@@ -177,7 +262,7 @@ int MPU60x0_WriteMultipleRegisters( MPU60x0_Type *mpu, uint8_t startreg, int cou
  */
 int MPU60x0_ReadRegister(MPU60x0_Type *mpu, uint8_t reg, uint8_t *pval) {
 
-    return 0;
+    return Transfer(mpu,&reg,1,pval,1);
 }
 
 
@@ -189,6 +274,23 @@ int MPU60x0_ReadRegister(MPU60x0_Type *mpu, uint8_t reg, uint8_t *pval) {
  */
 int MPU60x0_ReadMultipleRegisters(MPU60x0_Type *mpu, uint8_t startreg, int count, uint8_t *data) {
 
+    return Transfer(mpu,&startreg,1,data,count);
+}
+
+
+/**
+ *  @brief  Read three big-endian words starting at a register
+ */
+static int ReadTriple(MPU60x0_Type *mpu, uint8_t reg, uint16_t *px, uint16_t *py, uint16_t *pz) {
+AllignedValue data[3];
+int rc;
+
+    rc = Transfer(mpu,&reg,1,data[0].b,6);
+    if( rc < 0 )
+        return rc;
+    *px = REVBYTES16(data[0].w);
+    *py = REVBYTES16(data[1].w);
+    *pz = REVBYTES16(data[2].w);
     return 0;
 }
 
@@ -199,7 +301,7 @@ int MPU60x0_ReadMultipleRegisters(MPU60x0_Type *mpu, uint8_t startreg, int count
  */
 int MPU60x0_ReadAccel(MPU60x0_Type *mpu, MPU60x0_AccelType *paccel ) {
 
-    return 0;
+    return ReadTriple(mpu,MPU_ACCEL_XOUT_H,&paccel->x,&paccel->y,&paccel->z);
 }
 
 
@@ -209,7 +311,7 @@ int MPU60x0_ReadAccel(MPU60x0_Type *mpu, MPU60x0_AccelType *paccel ) {
  */
 int MPU60x0_ReadGyro(MPU60x0_Type *mpu, MPU60x0_GyroType *pgyro) {
 
-    return 0;
+    return ReadTriple(mpu,MPU_GYRO_XOUT_H,&pgyro->x,&pgyro->y,&pgyro->z);
 }
 
 
@@ -601,3 +703,323 @@ AllignedValue data;
     *paccel = REVBYTES16(data.w);
     return 0;
 }
+
+
+/**
+ *  @brief  Streaming mode
+ *
+ *  @note   The sensor stores acceleration and angular rate in its FIFO at the sample
+ *          rate and pulses its INT pin (data ready). The interrupt routine records a
+ *          timestamp for each sample. Every *batch* samples, the FIFO count is read and
+ *          then the FIFO is read in one burst, using the I2C transaction queue. Both are
+ *          started by the interrupt routines, so there is no polling.
+ *
+ *  @note   Blocks are double buffered. A block passed to the callback is valid until
+ *          the next callback.
+ */
+
+static const uint8_t fifocountreg = MPU_FIFO_COUNT_H;
+static const uint8_t fiforwreg    = MPU_FIFO_R_W;
+
+static void CountDone(I2CMaster_TransactionType *t);
+static void DataDone(I2CMaster_TransactionType *t);
+static void ResetDone(I2CMaster_TransactionType *t);
+
+/**
+ *  @brief  Enqueue a transaction for the streaming mode
+ */
+static void StartTransaction(MPU60x0_Type *mpu, const uint8_t *wdata, int wsize,
+                        uint8_t *rdata, int rsize, void (*done)(I2CMaster_TransactionType *t)) {
+I2CMaster_TransactionType *t = &mpu->trans;
+
+    t->address  = mpu->addr;
+    t->flags    = 0;
+    t->wdata    = wdata;
+    t->wsize    = wsize;
+    t->rdata    = rdata;
+    t->rsize    = rsize;
+    t->callback = done;
+    t->context  = mpu;
+    if( I2CMaster_Enqueue(mpu->i2c,t) < 0 ) {
+        mpu->errors++;
+        mpu->state = STREAM_IDLE;
+    }
+}
+
+/**
+ *  @brief  Start reading the FIFO when enough samples are available
+ */
+static void CheckDrain(MPU60x0_Type *mpu) {
+uint32_t primask;
+int start;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    start = mpu->state == STREAM_IDLE && (mpu->edges-mpu->seq) >= mpu->batch;
+    if( start )
+        mpu->state = STREAM_COUNT;
+    __set_PRIMASK(primask);
+
+    if( start )
+        StartTransaction(mpu,&fifocountreg,1,mpu->buf,2,CountDone);
+}
+
+/**
+ *  @brief  Reset the FIFO (after an overflow)
+ */
+static void ResetFIFO(MPU60x0_Type *mpu) {
+
+    mpu->state  = STREAM_RESET;
+    mpu->buf[0] = MPU_USER_CTRL;
+    mpu->buf[1] = 0x44;                             // FIFO_EN|FIFO_RESET
+    StartTransaction(mpu,mpu->buf,2,0,0,ResetDone);
+}
+
+/**
+ *  @brief  FIFO count was read. Read the samples
+ */
+static void CountDone(I2CMaster_TransactionType *t) {
+MPU60x0_Type *mpu = t->context;
+MPU60x0_BlockType *block;
+uint32_t n;
+
+    if( mpu->state != STREAM_COUNT )
+        return;
+    if( t->status != I2CMASTER_TRANS_OK ) {
+        mpu->errors++;
+        mpu->state = STREAM_IDLE;
+        return;
+    }
+
+    n = ((uint32_t) mpu->buf[0]<<8)|mpu->buf[1];
+
+    // FIFO overflow or too many samples without timestamps: start again
+    if( n > MPU60X0_FIFOSIZE-MPU60X0_SAMPLESIZE || mpu->edges-mpu->seq > MPU60X0_EDGES ) {
+        ResetFIFO(mpu);
+        return;
+    }
+
+    n /= MPU60X0_SAMPLESIZE;
+    if( n == 0 ) {
+        mpu->state = STREAM_IDLE;
+        return;
+    }
+    if( n > MPU60X0_BLOCKSIZE )
+        n = MPU60X0_BLOCKSIZE;
+
+    block = &mpu->blocks[mpu->cur];
+    block->count = n;
+    mpu->state = STREAM_DATA;
+    StartTransaction(mpu,&fiforwreg,1,(uint8_t *) block->samples,n*MPU60X0_SAMPLESIZE,DataDone);
+}
+
+/**
+ *  @brief  Samples were read. Convert them and call the callback
+ */
+static void DataDone(I2CMaster_TransactionType *t) {
+MPU60x0_Type *mpu = t->context;
+MPU60x0_BlockType *block = &mpu->blocks[mpu->cur];
+int16_t *p;
+int i;
+
+    if( mpu->state != STREAM_DATA )
+        return;
+    if( t->status != I2CMASTER_TRANS_OK ) {
+        // FIFO position is unknown
+        mpu->errors++;
+        ResetFIFO(mpu);
+        return;
+    }
+
+    p = (int16_t *) block->samples;
+    for(i=0;i<block->count*MPU60X0_SAMPLESIZE/2;i++)
+        p[i] = REVBYTES16(p[i]);
+
+    block->seq    = mpu->seq;
+    block->tfirst = mpu->edgetime[mpu->seq&(MPU60X0_EDGES-1)];
+    block->tlast  = mpu->edgetime[(mpu->seq+block->count-1)&(MPU60X0_EDGES-1)];
+    mpu->seq     += block->count;
+
+    mpu->cur   ^= 1;
+    mpu->state  = STREAM_IDLE;
+    if( mpu->callback )
+        mpu->callback(mpu,block);
+
+    CheckDrain(mpu);
+}
+
+/**
+ *  @brief  FIFO was reset. Samples not read are lost
+ */
+static void ResetDone(I2CMaster_TransactionType *t) {
+MPU60x0_Type *mpu = t->context;
+
+    if( mpu->state != STREAM_RESET )
+        return;
+    if( t->status != I2CMASTER_TRANS_OK )
+        mpu->errors++;
+
+    mpu->lost += mpu->edges-mpu->seq;
+    mpu->seq   = mpu->edges;
+    mpu->state = STREAM_IDLE;
+}
+
+/**
+ *  @brief  Data ready interrupt processing
+ *
+ *  @note   Called by the GPIO interrupt routine on the rising edge of INT
+ */
+void MPU60x0_DataReady(MPU60x0_Type *mpu) {
+
+    if( mpu->state == STREAM_OFF )
+        return;
+
+    mpu->edgetime[mpu->edges&(MPU60X0_EDGES-1)] = DWT->CYCCNT;
+    mpu->edges++;
+    CheckDrain(mpu);
+}
+
+#if MPU60X0_GPIO_IRQ
+void GPIO_EVEN_IRQHandler(void) {
+uint32_t flags;
+
+    flags = GPIO->IF&0x5555;
+    GPIO->IFC = flags;
+    if( flags&(1<<Mpu.pin) )
+        MPU60x0_DataReady(&Mpu);
+}
+
+void GPIO_ODD_IRQHandler(void) {
+uint32_t flags;
+
+    flags = GPIO->IF&0xAAAA;
+    GPIO->IFC = flags;
+    if( flags&(1<<Mpu.pin) )
+        MPU60x0_DataReady(&Mpu);
+}
+#else
+/**
+ *  @brief  Routine called by the GPIO interrupt handlers in button.c
+ */
+static void DataReadyHandler(void) {
+
+    MPU60x0_DataReady(&Mpu);
+}
+#endif
+
+/**
+ *  @brief  Start streaming mode
+ *
+ *  @param  gpio:     port where INT is connected
+ *  @param  pin:      pin where INT is connected
+ *  @param  rate:     samples per second (4 to 1000)
+ *  @param  batch:    samples read in each burst (1 to MPU60X0_BLOCKSIZE)
+ *  @param  callback: called (in interrupt context) with each block
+ *
+ *  @note   The digital low pass filter is set to 188 Hz, so the internal rate is 1 kHz
+ *
+ *  @return 0 if OK, negative if error
+ */
+int MPU60x0_StartStream(MPU60x0_Type *mpu, GPIO_t gpio, unsigned pin, unsigned rate,
+                        unsigned batch,
+                        void (*callback)(MPU60x0_Type *mpu, const MPU60x0_BlockType *block)) {
+uint32_t primask;
+unsigned port;
+int rc;
+
+    if( rate < 4 || rate > 1000 || batch < 1 || batch > MPU60X0_BLOCKSIZE || pin > 15 )
+        return -1;
+
+    MPU60x0_StopStream(mpu);
+
+    rc = 0;
+    rc |= MPU60x0_WriteRegister(mpu,MPU_PWR_MGMT_1,0x01);       // PLL with X gyro
+    rc |= MPU60x0_WriteRegister(mpu,MPU_CONFIG,0x01);           // DLPF 188 Hz
+    rc |= MPU60x0_WriteRegister(mpu,MPU_SMPLRT_DIV,1000/rate-1);
+    rc |= MPU60x0_WriteRegister(mpu,MPU_FIFO_EN,0x78);          // Accel and gyro XYZ
+    rc |= MPU60x0_WriteRegister(mpu,MPU_INT_PIN_CFG,0x00);      // Active high, 50 us pulse
+    if( rc )
+        return -2;
+
+    // Timestamps
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+
+    mpu->pin      = pin;
+    mpu->batch    = batch;
+    mpu->callback = callback;
+    mpu->cur      = 0;
+    mpu->edges    = 0;
+    mpu->seq      = 0;
+    mpu->lost     = 0;
+    mpu->errors   = 0;
+    mpu->state    = STREAM_RESET;               // Interrupts counted but no drain
+
+    // Rising edge of INT
+    port = gpio-&(GPIO->P[0]);
+    GPIO_ConfigPins(gpio,1<<pin,GPIO_MODE_INPUT);
+    if( pin < 8 ) {
+        GPIO->EXTIPSELL = (GPIO->EXTIPSELL&~(0xFUL<<(pin*4)))|(port<<(pin*4));
+    } else {
+        GPIO->EXTIPSELH = (GPIO->EXTIPSELH&~(0xFUL<<((pin-8)*4)))|(port<<((pin-8)*4));
+    }
+    GPIO->EXTIRISE |=  (1<<pin);
+    GPIO->EXTIFALL &= ~(1<<pin);
+#if !MPU60X0_GPIO_IRQ
+    Button_SetPinHandler(pin,DataReadyHandler);
+#endif
+    GPIO->IFC       =  (1<<pin);
+    GPIO->IEN      |=  (1<<pin);
+    NVIC_SetPriority((pin&1)?GPIO_ODD_IRQn:GPIO_EVEN_IRQn,MPU60X0_INT_LEVEL);
+    NVIC_EnableIRQ((pin&1)?GPIO_ODD_IRQn:GPIO_EVEN_IRQn);
+
+    rc |= MPU60x0_WriteRegister(mpu,MPU_INT_ENABLE,0x01);       // DATA_RDY_EN
+    rc |= MPU60x0_WriteRegister(mpu,MPU_USER_CTRL,0x44);        // FIFO_EN|FIFO_RESET
+    if( rc ) {
+        MPU60x0_StopStream(mpu);
+        return -2;
+    }
+
+    // Samples before the FIFO reset are not in the FIFO
+    primask = __get_PRIMASK();
+    __disable_irq();
+    mpu->seq   = mpu->edges;
+    mpu->state = STREAM_IDLE;
+    __set_PRIMASK(primask);
+
+    return 0;
+}
+
+/**
+ *  @brief  Stop streaming mode
+ */
+int MPU60x0_StopStream(MPU60x0_Type *mpu) {
+
+    if( mpu->state != STREAM_OFF ) {
+        GPIO->IEN &= ~(1<<mpu->pin);
+#if !MPU60X0_GPIO_IRQ
+        Button_SetPinHandler(mpu->pin,0);
+#endif
+        mpu->state = STREAM_OFF;
+        // Wait for transactions in progress (their callbacks do nothing now)
+        if( mpu->trans.status == I2CMASTER_TRANS_PENDING )
+            I2CMaster_Wait(&mpu->trans);
+    }
+
+    MPU60x0_WriteRegister(mpu,MPU_INT_ENABLE,0x00);
+    MPU60x0_WriteRegister(mpu,MPU_FIFO_EN,0x00);
+    MPU60x0_WriteRegister(mpu,MPU_USER_CTRL,0x00);
+    return 0;
+}
+
+/**
+ *  @brief  Return number of samples lost (FIFO overflow) and I2C errors
+ */
+int MPU60x0_GetStreamStatus(MPU60x0_Type *mpu, uint32_t *lost, uint32_t *errors) {
+
+    if( lost )
+        *lost = mpu->lost;
+    if( errors )
+        *errors = mpu->errors;
+    return mpu->state != STREAM_OFF;
+}
@@ -9,6 +9,10 @@
  *
  */
 
+#include <stdint.h>
+#include "em_device.h"
+#include "gpio.h"
+
 /**
  *  @brief  Registers of the MPU60x0
  */
@@ -137,6 +141,38 @@ typedef struct {
     uint16_t        z;
 } MPU60x0_AccelType;
 
+/**
+ *  @brief  Streaming mode
+ *
+ *  @note   A sample is the content of the FIFO for one sample time: acceleration and
+ *          angular rate in 3-axes (12 bytes), already in the processor byte order.
+ *
+ *  @note   Timestamps are DWT cycle counter values at the data-ready interrupt of the
+ *          first and last samples of the block.
+ */
+///@{
+#define MPU60X0_BLOCKSIZE              16          // Maximal samples per block
+#define MPU60X0_SAMPLESIZE             12          // Bytes per sample in the FIFO
+#define MPU60X0_FIFOSIZE               1024
+
+typedef struct {
+    int16_t         ax;
+    int16_t         ay;
+    int16_t         az;
+    int16_t         gx;
+    int16_t         gy;
+    int16_t         gz;
+} MPU60x0_SampleType;
+
+typedef struct {
+    uint32_t            seq;                        /**< index of first sample    */
+    uint32_t            tfirst;                     /**< timestamp of first sample*/
+    uint32_t            tlast;                      /**< timestamp of last sample */
+    uint16_t            count;                      /**< samples in the block     */
+    MPU60x0_SampleType  samples[MPU60X0_BLOCKSIZE];
+} MPU60x0_BlockType;
+///@}
+
 
 MPU60x0_Type *MPU60x0_Init(I2C_TypeDef *i2c, uint16_t addr);
 
@@ -174,4 +210,12 @@ int MPU60x0_GetDataAccelX(MPU60x0_Type *mpu, uint16_t *paccel);
 int MPU60x0_GetDataAccelY(MPU60x0_Type *mpu, uint16_t *paccel);
 int MPU60x0_GetDataAccelZ(MPU60x0_Type *mpu, uint16_t *paccel);
 
+/* Streaming mode */
+int MPU60x0_StartStream(MPU60x0_Type *mpu, GPIO_t gpio, unsigned pin, unsigned rate,
+                        unsigned batch,
+                        void (*callback)(MPU60x0_Type *mpu, const MPU60x0_BlockType *block));
+int MPU60x0_StopStream(MPU60x0_Type *mpu);
+void MPU60x0_DataReady(MPU60x0_Type *mpu);
+int MPU60x0_GetStreamStatus(MPU60x0_Type *mpu, uint32_t *lost, uint32_t *errors);
+
 #endif // MPU60X0_H
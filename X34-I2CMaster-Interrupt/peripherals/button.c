@@ -30,23 +30,41 @@ static uint32_t lastread    = 0;
 static uint32_t newestread  = 0;
 static uint32_t inputpins   = 0;
 static void   (*callback)(uint32_t) = 0;
+static void   (*pinhandlers[16])(void) = { 0 };
 //}
 
+/**
+ * @brief Call the handlers of the pins that are not buttons
+ */
+static void CallPinHandlers(uint32_t flags) {
+unsigned pin;
+
+    flags &= ~inputpins;
+    for(pin=0;flags;pin++,flags>>=1) {
+        if( (flags&1) && pinhandlers[pin] )
+            pinhandlers[pin]();
+    }
+}
+
 /**
  * @brief GPIO IRQ Handler (only even pins)
  */
 void GPIO_EVEN_IRQHandler(void) {
 uint32_t newread;
+uint32_t flags;
 const uint32_t mask = BIT(10);
 
-    if( GPIO->IF&mask ) {
+    flags = GPIO->IF&0x5555;
+    GPIO->IFC = flags;          // Clear interrupts from even pins
+
+    CallPinHandlers(flags);
+
+    if( flags&mask&inputpins ) {
         lastread   = (lastread&~mask)|(newestread&mask);
         newread = GPIOB->DIN&mask;
         newestread = (newestread&~mask)|newread;
+        if( callback ) callback(mask);
     }
-    GPIO->IFC = 0x5555;         // Clear all interrupts from even pins
-
-    if( callback ) callback(mask);
 }
 
 /**
@@ -54,16 +72,20 @@ const uint32_t mask = BIT(10);
  */
 void GPIO_ODD_IRQHandler(void) {
 uint32_t newread;
+uint32_t flags;
 const uint32_t mask = BIT(9);
 
-    if( GPIO->IF&mask ) {
+    flags = GPIO->IF&0xAAAA;
+    GPIO->IFC = flags;          // Clear interrupts from odd pins
+
+    CallPinHandlers(flags);
+
+    if( flags&mask&inputpins ) {
         lastread   = (lastread&~mask)|(newestread&mask);
         newread = GPIOB->DIN&mask;
         newestread = (newestread&~mask)|newread;
+        if( callback ) callback(mask);
     }
-    GPIO->IFC = 0xAAAA;         // Clear all interrupts from odd pins
-
-    if( callback ) callback(mask);
 }
 
 /**
@@ -179,3 +201,15 @@ void Button_SetCallback( void (*proc)(uint32_t parm) ) {
     callback = proc;
 
 }
+
+/**
+ * @brief Set routine called by the GPIO interrupt of a pin that is not a button
+ *
+ * @note  The GPIO interrupt handlers are defined here, so other drivers (e.g. mpu60x0.c)
+ *        get their interrupts this way. proc = 0 removes it.
+ */
+void Button_SetPinHandler(unsigned pin, void (*proc)(void)) {
+
+    if( pin < 16 )
+        pinhandlers[pin] = proc;
+}
@@ -25,4 +25,5 @@ uint32_t    Button_ReadChanges(void);
 uint32_t    Button_ReadPressed(void);
 uint32_t    Button_ReadReleased(void);
 void        Button_SetCallback( void (*proc)(uint32_t parm) );
+void        Button_SetPinHandler(unsigned pin, void (*proc)(void));
 #endif // BUTTON_H
@@ -0,0 +1,41 @@
+#ifndef DMA_H
+#define DMA_H
+
+/**
+ * @file    dma.h
+ *
+ * @brief   HAL for DMA in the EFM32GG
+ *
+ * @note    It implements a simple HAL for DMA, basically to support UART
+ *
+ * @note    It implements basic and ping-pong transfers between memory and a peripheral
+ *          register. It does not implement loop and 2D transfers.
+ *
+ * @author  Hans
+ *
+ * @version 1.0
+ *
+ * @date    07/06/2020
+ */
+
+#include <stdint.h>
+
+int DMA_Init();
+int DMA_StartTx(int chn, uint32_t chnctrl, volatile void *dest,
+                const void *buf, int n, void (*callback)(int chn));
+int DMA_StartRx(int chn, uint32_t chnctrl, volatile void *src,
+                void *buf, int n, void (*callback)(int chn));
+int DMA_StartPingPong(int chn, uint32_t chnctrl, volatile void *dest,
+                      void *buf0, void *buf1, int n, void (*callback)(int chn));
+int DMA_StartPingPongRx(int chn, uint32_t chnctrl, volatile void *src,
+                        void *buf0, void *buf1, int n, void (*callback)(int chn));
+int DMA_StartMemTx(int chn, volatile void *dest, const void *buf, int n,
+                   void (*callback)(int chn));
+int DMA_StartMemRx(int chn, volatile void *src, void *buf, int n,
+                   void (*callback)(int chn));
+int DMA_Stop(int chn);
+void *DMA_GetDoneBuffer(int chn);
+
+
+
+#endif // DMA_H
@@ -60,6 +60,20 @@ static const uint32_t GPIO_MODE_WIREDANDDRIVEPULLUPFILTER         =   0xF;
 void GPIO_ConfigPins(GPIO_t gpio, uint32_t pins, uint32_t mode);
 void GPIO_Init(GPIO_t gpio, uint32_t inputs, uint32_t outputs);
 
+/**
+ * @brief   Interrupt on pin change (gpio2.c)
+ *
+ * @note    Only one port can generate interrupts for a given pin number. The callback
+ *          receives the input register of the port.
+ */
+///@{
+#define GPIO_IRQ_SENSE_RISING    1
+#define GPIO_IRQ_SENSE_FALLING   2
+#define GPIO_IRQ_SENSE_BOTH      (GPIO_IRQ_SENSE_RISING|GPIO_IRQ_SENSE_FALLING)
+
+int GPIO_SetIRQ(GPIO_t gpio, int pin, int sense, void (*callback)(uint32_t));
+///@}
+
 /**
  * @brief   Set specified pins to zero, then others (or same) to 1
  * @param   gpio:   pointer to GPIO registers
@@ -74,7 +74,7 @@ static inline int GPIO_FindIndex(GPIO_t gpio) {
 static inline int GPIO_EnableIRQ(int pin) {
 
     GPIO->IEN |= BIT(pin);
-
+    return 0;
 }
 
 /**
@@ -86,7 +86,7 @@ static inline int GPIO_EnableIRQ(int pin) {
 static inline int GPIO_DisableIRQ(int pin) {
 
     GPIO->IEN &= ~BIT(pin);
-
+    return 0;
 }
 
 /**
@@ -98,7 +98,7 @@ static inline int GPIO_DisableIRQ(int pin) {
 static inline int GPIO_ClearIRQ(int pin) {
 
     GPIO->IFC = BIT(pin);
-
+    return 0;
 }
 
 /**
@@ -155,9 +155,6 @@ GPIO_Init(GPIO_t gpio, uint32_t inputs, uint32_t outputs) {
 
 }
 
-#define GPIO_IRQ_SENSE_RISING    1
-#define GPIO_IRQ_SENSE_FALLING   2
-#define GPIO_IRQ_SENSE_BOTH      (GPIO_IRQ_SENSE_RISING|GPIO_IRQ_SENSE_FALLING)
 
 /**
  * @brief   Set IRQ routine
@@ -170,26 +167,31 @@ GPIO_Init(GPIO_t gpio, uint32_t inputs, uint32_t outputs) {
 int GPIO_SetIRQ(GPIO_t gpio, int pin, int sense, void (*callback)(uint32_t)) {
 int index;
 uint32_t m = BIT(pin);
+IRQn_Type irqn;
 
+    if( pin < 0 || pin > 15 )
+        return -1;
 
     // Disable interrupt for pin
     GPIO->IEN &= ~m;
 
-    // Set CallbackInfo struct for pin
+    // Set CallbackInfo struct for pin (there is only one per pin number)
     index = GPIO_FindIndex(gpio);
-    GPIO_Callback[index].callback = callback;
-    GPIO_Callback[index].mask     = m;
-    GPIO_Callback[index].gpio     = gpio;
+    GPIO_Callback[pin].callback = callback;
+    GPIO_Callback[pin].mask     = m;
+    GPIO_Callback[pin].gpio     = gpio;
 
     // Configure sense
     if( (sense&GPIO_IRQ_SENSE_RISING)!=0 )  GPIO->EXTIRISE |= m;
+    else                                    GPIO->EXTIRISE &= ~m;
     if( (sense&GPIO_IRQ_SENSE_FALLING)!=0 ) GPIO->EXTIFALL |= m;
+    else                                    GPIO->EXTIFALL &= ~m;
 
     // Set which gpio will trigger interrupt
-    if( index < 8 ) {
-        GPIO->EXTIPSELL = (index<<(pin*4));
+    if( pin < 8 ) {
+        GPIO->EXTIPSELL = (GPIO->EXTIPSELL&~(0xFU<<(pin*4)))|(index<<(pin*4));
     } else {
-        GPIO->EXTIPSELH = (index<<((pin-8)*4));
+        GPIO->EXTIPSELH = (GPIO->EXTIPSELH&~(0xFU<<((pin-8)*4)))|(index<<((pin-8)*4));
     }
 
     // Clear any interrupt from pin
@@ -198,7 +200,10 @@ uint32_t m = BIT(pin);
     // Enable interrupt for pin
     GPIO->IEN |= m;
 
-    
+    irqn = (pin&1) ? GPIO_ODD_IRQn : GPIO_EVEN_IRQn;
+    NVIC_ClearPendingIRQ(irqn);
+    NVIC_EnableIRQ(irqn);
+
     return 0;
 }
 
@@ -0,0 +1,620 @@
+/**
+ * @file bench.c
+ * @brief Benchmarks of the NAND driver stack on the host (with nand-sim.c)
+ *
+ * @note
+ *      Usage: nandbench [file]
+ *
+ *      With a file, the device contents are kept between runs. Times are simulated
+ *      (see nand-sim.c). The CPU time is only the one added by NANDSim_Advance.
+ *
+ *      At the end, each fault of the model (factory and grown bad blocks, endurance,
+ *      bit flips) is injected in a new device and the counters are compared with the
+ *      expected values. The exit status is 1 when one of them is different.
+ *
+ * @version 1.0.0
+ * Date:    7 October 2023
+ *
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "nand-flash.h"
+#include "nand-sim.h"
+#include "nand-bbt.h"
+#include "nand-log.h"
+
+#ifdef USE_YAFFS
+#include "yaffsfs.h"
+#include "yaffs-drv.h"
+#endif
+
+/// Used by yaffs-os.c (milliseconds)
+volatile uint64_t tick = 0;
+
+/**
+ * @brief  Benchmark parameters
+ */
+///@{
+#define BENCH_BLOCKS                        (8)
+#define BENCH_FILESIZE                      (256*1024L)
+#define BENCH_WRITESIZE                     (1024)
+#define BENCH_REWRITES                      (200)
+#define BENCH_CPUTIME                       (100000)    // ns to prepare a page
+#define BENCH_LOGPERIOD                     (1000000)   // ns between records
+#define BENCH_LOGRECORD                     (14)        // bytes (e.g. IMU sample)
+#define BENCH_LOGLAPS                       (1.5)       // times the log is filled
+#define BENCH_LOGREAD                       (10000)     // records read after a seek
+///@}
+
+static uint8_t buffer[BENCH_WRITESIZE];
+
+
+static uint64_t Start(void) {
+
+    return NANDSim_GetTime();
+}
+
+/// Elapsed simulated time in microseconds
+static unsigned long Elapsed(uint64_t start) {
+
+    tick = NANDSim_GetTime()/1000000;
+    return (unsigned long) ((NANDSim_GetTime()-start)/1000);
+}
+
+/// Throughput in KB/s
+static unsigned long Throughput(uint32_t bytes, unsigned long us) {
+
+    if( us == 0 )
+        us = 1;
+    return (unsigned long) ((uint64_t) bytes*1000000/1024/us);
+}
+
+static void PrintWear(uint32_t first, uint32_t n) {
+uint32_t min = UINT32_MAX, max = 0;
+uint64_t sum = 0;
+uint32_t b,c;
+
+    for(b=first;b<first+n;b++) {
+        c = NANDSim_GetEraseCount(b);
+        if( c < min ) min = c;
+        if( c > max ) max = c;
+        sum += c;
+    }
+    printf("erase count: min %lu max %lu avg %.2f\n",(unsigned long) min,
+                (unsigned long) max,(double) sum/n);
+}
+
+/**
+ * @brief  Log with records at a fixed rate: append latency, recovery and seek
+ *
+ * @note   The log is filled BENCH_LOGLAPS times, so the oldest blocks are reused
+ */
+static void LogBenchmark(void) {
+NANDLog_CursorType cursor;
+NANDLog_InfoType info;
+uint32_t records,t,n,from,prev;
+uint64_t start,dt,maxdt = 0,sum = 0;
+int len;
+int rc;
+
+    start = Start();
+    if( NANDLog_Format() < 0 ) {
+        printf("log format failed\n");
+        return;
+    }
+    printf("log format: %lu us\n",Elapsed(start));
+
+    records = (uint32_t) (BENCH_LOGLAPS*NANDLOG_BLOCKS*NAND_PAGESPERBLOCK
+                            *(NAND_PAGESIZE/(BENCH_LOGRECORD+NANDLOG_OVERHEAD)));
+    for(t=0;t<records;t++) {
+        memcpy(buffer,&t,sizeof(t));
+        start = Start();
+        rc = NANDLog_Append(t,buffer,BENCH_LOGRECORD);
+        dt = NANDSim_GetTime()-start;
+        if( rc < 0 ) {
+            printf("append failed at %lu: %d\n",(unsigned long) t,rc);
+            break;
+        }
+        if( dt > maxdt )
+            maxdt = dt;
+        sum += dt;
+        NANDSim_Advance(BENCH_LOGPERIOD);
+    }
+    (void) NANDLog_Flush();
+    NANDLog_GetInfo(&info);
+    printf("log append: %lu records avg %lu ns max %lu us, %lu stalls\n",
+            (unsigned long) records,(unsigned long) (sum/records),
+            (unsigned long) (maxdt/1000),(unsigned long) info.stalls);
+    printf("log: time %lu..%lu in %lu blocks, sequence %lu\n",
+            (unsigned long) info.first,(unsigned long) info.last,
+            (unsigned long) info.blocks,(unsigned long) info.sequence);
+    PrintWear(NANDLOG_FIRSTBLOCK,NANDLOG_BLOCKS);
+
+    // Power loss with records in the buffer
+    for(n=0;n<10;n++,t++)
+        (void) NANDLog_Append(t,buffer,BENCH_LOGRECORD);
+    start = Start();
+    rc = NANDLog_Open();
+    printf("log open: %lu us (%d)\n",Elapsed(start),rc);
+    NANDLog_GetInfo(&info);
+    printf("log: time %lu..%lu after recovery\n",
+            (unsigned long) info.first,(unsigned long) info.last);
+    (void) NANDLog_Append(info.last+1,buffer,BENCH_LOGRECORD);
+    (void) NANDLog_Flush();
+
+    from = info.first+(info.last-info.first)/3;
+    start = Start();
+    rc = NANDLog_Seek(&cursor,from);
+    printf("log seek: %lu us (%d)\n",Elapsed(start),rc);
+
+    start = Start();
+    prev = from;
+    for(n=0;n<BENCH_LOGREAD;n++) {
+        len = NANDLog_Read(&cursor,&t,buffer,sizeof(buffer));
+        if( len != BENCH_LOGRECORD || t < prev || (n == 0 && t != from)
+            || memcmp(buffer,&t,sizeof(t)) != 0 ) {
+            printf("log read: bad record %lu (time %lu)\n",(unsigned long) n,
+                    (unsigned long) t);
+            break;
+        }
+        prev = t;
+    }
+    printf("log read: %lu records in %lu us\n",(unsigned long) n,Elapsed(start));
+}
+
+/**
+ * @brief  Boot time of the bad block table (scan at the first run, then load)
+ */
+static void BBTBenchmark(void) {
+NANDBBT_InfoType info;
+uint64_t start;
+int rc;
+int i;
+
+    for(i=0;i<2;i++) {
+        start = Start();
+        rc = NANDBBT_Load();
+        NANDBBT_GetInfo(&info);
+        printf("bad block table: %lu us (%s) version %lu bad blocks %lu (%d)\n",
+                Elapsed(start),info.scanned?"scan":"load",
+                (unsigned long) info.version,(unsigned long) info.badblocks,rc);
+    }
+}
+
+#ifndef USE_YAFFS
+/**
+ * @brief  Raw page throughput (BENCH_BLOCKS blocks below the log)
+ *
+ * @note   They are the last blocks of the YAFFS area, not used without YAFFS
+ */
+static void NANDBenchmark(void) {
+uint8_t sp[NAND_SPARESIZE];
+uint32_t first = (NANDLOG_FIRSTBLOCK-BENCH_BLOCKS)*NAND_BLOCKSIZE;
+uint32_t last  = NANDLOG_FIRSTBLOCK*NAND_BLOCKSIZE;
+uint32_t bytes = BENCH_BLOCKS*NAND_BLOCKSIZE;
+uint64_t start;
+uint32_t a;
+int i;
+
+    for(i=0;i<NAND_PAGESIZE;i++)
+        buffer[i] = (uint8_t) i;
+
+    start = Start();
+    for(a=first;a<last;a+=NAND_BLOCKSIZE)
+        (void) NAND_EraseBlock(a);
+    printf("erase %d blocks: %lu us\n",BENCH_BLOCKS,Elapsed(start));
+
+    start = Start();
+    for(a=first;a<last;a+=NAND_PAGESIZE) {
+        (void) NAND_WritePage(a,buffer);
+        NANDSim_Advance(BENCH_CPUTIME);
+    }
+    printf("write: %lu KB/s\n",Throughput(bytes,Elapsed(start)));
+
+    for(a=first;a<last;a+=NAND_BLOCKSIZE)
+        (void) NAND_EraseBlock(a);
+    start = Start();
+    for(a=first;a<last;a+=NAND_PAGESIZE) {
+        (void) NAND_WritePageStart(a,buffer,0);
+        NANDSim_Advance(BENCH_CPUTIME);
+    }
+    (void) NAND_Wait();
+    printf("write (overlapped): %lu KB/s\n",Throughput(bytes,Elapsed(start)));
+
+    start = Start();
+    for(a=first;a<last;a+=NAND_PAGESIZE)
+        (void) NAND_ReadPage(a,buffer);
+    printf("read: %lu KB/s\n",Throughput(bytes,Elapsed(start)));
+
+    start = Start();
+    for(a=first;a<last;a+=NAND_PAGESIZE)
+        (void) NAND_ReadSpare(a,sp);
+    printf("spare read: %lu us/page\n",Elapsed(start)/(bytes/NAND_PAGESIZE));
+
+    // Relocation of a block (garbage collection): through the EBI and copy back
+    for(i=0;i<3;i++) {
+        (void) NAND_EraseBlock(first+NAND_BLOCKSIZE);
+        start = Start();
+        for(a=0;a<NAND_BLOCKSIZE;a+=NAND_PAGESIZE) {
+            if( i == 0 ) {
+                (void) NAND_ReadPageSpare(first+a,buffer,sp);
+                (void) NAND_WritePageSpare(first+NAND_BLOCKSIZE+a,buffer,sp);
+            } else {
+                (void) NAND_CopyPage(first+a,first+NAND_BLOCKSIZE+a,i == 2);
+            }
+        }
+        printf("block move (%s): %lu us\n",i==0?"read/write":i==1?"copy back":
+                "copy back verified",Elapsed(start));
+    }
+}
+#else
+/**
+ * @brief  YAFFS mount time, throughput and garbage collection cost
+ */
+static void YAFFSBenchmark(void) {
+struct yaffs_dev *dev;
+NANDSim_StatsType ns;
+YDRV_StatsType ys;
+uint64_t start;
+long n;
+int fd;
+int i;
+
+    dev = YDRV_Install("/nand");
+
+    start = Start();
+    if( yaffs_mount("/nand") < 0 ) {
+        printf("mount failed\n");
+        return;
+    }
+    printf("mount: %lu us\n",Elapsed(start));
+
+    memset(buffer,0x5A,sizeof(buffer));
+    start = Start();
+    fd = yaffs_open("/nand/bench",O_CREAT|O_RDWR|O_TRUNC,S_IREAD|S_IWRITE);
+    for(n=0;n<BENCH_FILESIZE;n+=BENCH_WRITESIZE)
+        (void) yaffs_write(fd,buffer,BENCH_WRITESIZE);
+    (void) yaffs_close(fd);
+    (void) yaffs_sync("/nand");
+    (void) YDRV_Flush();
+    printf("file write: %lu KB/s\n",Throughput(BENCH_FILESIZE,Elapsed(start)));
+
+    start = Start();
+    fd = yaffs_open("/nand/bench",O_RDONLY,0);
+    for(n=0;n<BENCH_FILESIZE;n+=BENCH_WRITESIZE)
+        (void) yaffs_read(fd,buffer,BENCH_WRITESIZE);
+    (void) yaffs_close(fd);
+    printf("file read: %lu KB/s\n",Throughput(BENCH_FILESIZE,Elapsed(start)));
+
+    // Garbage collection: rewrite the same file
+    NANDSim_ClearStats();
+    for(i=0;i<BENCH_REWRITES;i++) {
+        fd = yaffs_open("/nand/bench",O_RDWR|O_TRUNC,0);
+        for(n=0;n<BENCH_FILESIZE;n+=BENCH_WRITESIZE)
+            (void) yaffs_write(fd,buffer,BENCH_WRITESIZE);
+        (void) yaffs_close(fd);
+    }
+    (void) yaffs_sync("/nand");
+    (void) YDRV_Flush();
+    NANDSim_GetStats(&ns);
+    printf("rewrites: %lu pages programmed for %lu written, %lu erases\n",
+            (unsigned long) ns.programs,
+            (unsigned long) (BENCH_REWRITES*BENCH_FILESIZE/NAND_PAGESIZE),
+            (unsigned long) ns.erases);
+
+    (void) yaffs_unmount("/nand");
+    start = Start();
+    (void) yaffs_mount("/nand");
+    printf("mount (checkpoint): %lu us\n",Elapsed(start));
+
+    // Power loss
+    dev->param.skip_checkpt_wr = 1;
+    (void) yaffs_unmount2("/nand",1);
+    dev->param.skip_checkpt_rd = 1;
+    YDRV_ClearStats();
+    start = Start();
+    (void) yaffs_mount("/nand");
+    printf("mount (scan): %lu us\n",Elapsed(start));
+    YDRV_GetStats(&ys);
+    printf("tag reads %lu chunk reads %lu cache hits %lu\n",
+            (unsigned long) ys.tagreads,(unsigned long) ys.reads,
+            (unsigned long) ys.hits);
+    dev->param.skip_checkpt_wr = 0;
+    dev->param.skip_checkpt_rd = 0;
+
+    (void) yaffs_unmount("/nand");
+}
+#endif
+
+
+/**
+ * @brief  Compare a counter with its expected value
+ *
+ * @return 0 if equal, 1 if not
+ */
+static int Expect(const char *what, long value, long expected) {
+
+    if( value == expected )
+        return 0;
+    printf("    %s: %ld (expected %ld)\n",what,value,expected);
+    return 1;
+}
+
+static int Report(const char *test, int fails) {
+
+    printf("faults (%s): %s\n",test,fails?"FAIL":"OK");
+    return fails != 0;
+}
+
+/**
+ * @brief  Factory bad blocks are found by the scan and fail erases
+ */
+static int FactoryBadTest(void) {
+static const uint32_t bad[] = { 3, 700, 1500 };
+NANDBBT_InfoType info;
+NANDSim_StatsType s;
+int fails = 0;
+unsigned i;
+
+    for(i=0;i<sizeof(bad)/sizeof(bad[0]);i++)
+        NANDSim_SetBadBlock(bad[i]);
+    NANDSim_ClearStats();
+
+    fails += Expect("scan",NANDBBT_Scan(),NAND_OK);
+    NANDBBT_GetInfo(&info);
+    fails += Expect("bad blocks in table",info.badblocks,3);
+    for(i=0;i<sizeof(bad)/sizeof(bad[0]);i++)
+        fails += Expect("bad block",NANDBBT_IsBad(bad[i]),1);
+    fails += Expect("good block",NANDBBT_IsBad(4),0);
+    fails += Expect("erase of bad block",NAND_EraseBlock(700*NAND_BLOCKSIZE),NAND_ERR_FAIL);
+    NANDSim_GetStats(&s);
+    fails += Expect("erase fails",s.erasefails,1);
+
+    return Report("factory bad blocks",fails);
+}
+
+/**
+ * @brief  A block that starts failing is marked bad in the table and in the block
+ */
+static int GrownBadTest(void) {
+NANDBBT_InfoType info;
+NANDSim_StatsType s;
+uint32_t b = 20;
+int fails = 0;
+
+    NANDSim_ClearStats();
+    fails += Expect("erase",NAND_EraseBlock(b*NAND_BLOCKSIZE),NAND_OK);
+    NANDSim_SetFailingBlock(b);
+    fails += Expect("program",NAND_WritePage(b*NAND_BLOCKSIZE,buffer),NAND_ERR_FAIL);
+    fails += Expect("erase",NAND_EraseBlock(b*NAND_BLOCKSIZE),NAND_ERR_FAIL);
+    fails += Expect("mark",NANDBBT_MarkBad(b),NAND_OK);
+    NANDBBT_GetInfo(&info);
+    fails += Expect("bad blocks in table",info.badblocks,4);
+    fails += Expect("table",NANDBBT_IsBad(b),1);
+    fails += Expect("marker",NAND_IsBadBlock(b*NAND_BLOCKSIZE),1);
+    NANDSim_GetStats(&s);
+    fails += Expect("program fails",s.programfails,1+2);   // page and two markers
+    fails += Expect("erase fails",s.erasefails,1);
+
+    return Report("grown bad block",fails);
+}
+
+/**
+ * @brief  Erases fail after the endurance limit
+ */
+static int EnduranceTest(void) {
+NANDSim_StatsType s;
+uint32_t a = 30*NAND_BLOCKSIZE;
+int fails = 0;
+int i;
+
+    NANDSim_SetEndurance(NANDSim_GetEraseCount(30)+10);
+    NANDSim_ClearStats();
+    for(i=0;i<10;i++)
+        fails += Expect("erase",NAND_EraseBlock(a),NAND_OK);
+    fails += Expect("erase after limit",NAND_EraseBlock(a),NAND_ERR_FAIL);
+    fails += Expect("program after limit",NAND_WritePage(a,buffer),NAND_ERR_FAIL);
+    NANDSim_GetStats(&s);
+    fails += Expect("erases",s.erases,11);
+    fails += Expect("erase fails",s.erasefails,1);
+    fails += Expect("program fails",s.programfails,1);
+    NANDSim_SetEndurance(NANDSIM_ENDURANCE);
+
+    return Report("endurance",fails);
+}
+
+/**
+ * @brief  Single bit errors are corrected, double bit errors are reported
+ *
+ * @note   FlipBit changes the stored page. SetFlipRate flips a bit in the data read.
+ */
+static int BitFlipTest(void) {
+uint8_t data[NAND_PAGESIZE];
+NANDSim_StatsType s;
+uint32_t a = 40*NAND_BLOCKSIZE;
+uint32_t n;
+int fails = 0;
+int i,rc;
+
+    for(i=0;i<NAND_PAGESIZE;i++)
+        buffer[i] = (uint8_t) (i*7);
+    (void) NAND_EraseBlock(a);
+    for(i=0;i<NAND_PAGESPERBLOCK;i++)
+        (void) NAND_WritePage(a+i*NAND_PAGESIZE,buffer);
+    NANDSim_ClearStats();
+
+    // One bit in the data and one in the ECC are corrected
+    NANDSim_FlipBit(a,100);
+    fails += Expect("data bit",NAND_ReadPage(a,data),NAND_ECC_CORRECTED);
+    fails += Expect("corrected data",memcmp(data,buffer,NAND_PAGESIZE),0);
+    NANDSim_FlipBit(a+NAND_PAGESIZE,(NAND_PAGESIZE+NAND_SPARE_ECC)*8+3);
+    fails += Expect("ECC bit",NAND_ReadPage(a+NAND_PAGESIZE,data),NAND_ECC_CORRECTED);
+    fails += Expect("data",memcmp(data,buffer,NAND_PAGESIZE),0);
+
+    // Two bits
+    NANDSim_FlipBit(a+2*NAND_PAGESIZE,100);
+    NANDSim_FlipBit(a+2*NAND_PAGESIZE,2000);
+    fails += Expect("two bits",NAND_ReadPage(a+2*NAND_PAGESIZE,data),NAND_ERR_ECC);
+
+    NANDSim_GetStats(&s);
+    fails += Expect("corrected",s.corrected,2);
+    fails += Expect("uncorrectable",s.uncorrectable,1);
+
+    // Read disturb in 10% of the reads: all corrected
+    NANDSim_ClearStats();
+    NANDSim_SetFlipRate(100000,12345);
+    for(n=0;n<1000;n++) {
+        rc = NAND_ReadPage(a+(3+n%(NAND_PAGESPERBLOCK-3))*NAND_PAGESIZE,data);
+        if( rc < 0 || memcmp(data,buffer,NAND_PAGESIZE) != 0 )
+            break;
+    }
+    NANDSim_SetFlipRate(0,0);
+    NANDSim_GetStats(&s);
+    fails += Expect("reads",n,1000);
+    fails += Expect("corrected flips",s.corrected,s.bitflips);
+    fails += Expect("uncorrectable",s.uncorrectable,0);
+    if( s.bitflips < 50 || s.bitflips > 150 )
+        fails += Expect("flips in 1000 reads (about 100)",s.bitflips,100);
+
+    return Report("bit flips",fails);
+}
+
+/**
+ * @brief  Log over a block that fails to erase and one that fails to program
+ *
+ * @note   The block that fails to erase is retired by NANDLog_Format. Blocks are
+ *         erased before they are used, so the other one starts failing when it is half
+ *         written. The page that fails is written again in the next block, so no record
+ *         is lost. The block is retired only when it is reused.
+ * @note   Block 1500 of FactoryBadTest is also in the log.
+ */
+static int LogFaultTest(void) {
+NANDLog_CursorType cursor;
+NANDLog_InfoType info;
+uint32_t perblock = NAND_PAGESPERBLOCK*(NAND_PAGESIZE/(BENCH_LOGRECORD+NANDLOG_OVERHEAD));
+uint32_t records = 6*perblock;
+uint32_t t,n;
+int fails = 0;
+
+    NANDSim_SetFailingBlock(NANDLOG_FIRSTBLOCK+2);
+    fails += Expect("format",NANDLog_Format(),NAND_OK);
+
+    for(t=0;t<records;t++) {
+        // Third block used (block 2 is bad)
+        if( t == 2*perblock+perblock/2 )
+            NANDSim_SetFailingBlock(NANDLOG_FIRSTBLOCK+3);
+        memcpy(buffer,&t,sizeof(t));
+        if( NANDLog_Append(t,buffer,BENCH_LOGRECORD) < 0 )
+            break;
+        NANDSim_Advance(BENCH_LOGPERIOD);
+    }
+    fails += Expect("appended",t,records);
+    fails += Expect("flush",NANDLog_Flush(),NAND_OK);
+    NANDLog_GetInfo(&info);
+    fails += Expect("bad blocks",info.badblocks,2);
+    fails += Expect("program errors",info.programerrors,1);
+    fails += Expect("retired block in table",NANDBBT_IsBad(NANDLOG_FIRSTBLOCK+2),1);
+
+    fails += Expect("seek",NANDLog_Seek(&cursor,0),NAND_OK);
+    for(n=0;n<records;n++) {
+        if( NANDLog_Read(&cursor,&t,buffer,sizeof(buffer)) != BENCH_LOGRECORD
+            || t != n || memcmp(buffer,&n,sizeof(n)) != 0 )
+            break;
+    }
+    fails += Expect("records read",n,records);
+
+    return Report("log",fails);
+}
+
+/**
+ * @brief  The table is kept when the power fails while the table block is changed
+ *
+ * @note   Blocks are marked bad until the block in use is full and the next version
+ *         goes to the other one. Erasing the block that is not in use is the state
+ *         after a power loss in the next change. The last version must still be loaded.
+ */
+static int TableTest(void) {
+NANDBBT_InfoType info;
+uint32_t first,version,b;
+int fails = 0;
+
+    NANDBBT_GetInfo(&info);
+    first = info.block;
+    for(b=100;info.block==first&&b<100+NAND_PAGESPERBLOCK;b++) {
+        fails += Expect("mark",NANDBBT_MarkBad(b),NAND_OK);
+        NANDBBT_GetInfo(&info);
+    }
+    fails += Expect("other block",info.block,NANDBBT_BLOCK+(first==NANDBBT_BLOCK));
+    fails += Expect("first page",info.page,0);
+    version = info.version;
+
+    fails += Expect("load",NANDBBT_Load(),NAND_OK);
+    NANDBBT_GetInfo(&info);
+    fails += Expect("version",info.version,version);
+
+    fails += Expect("erase",NAND_EraseBlock(first*NAND_BLOCKSIZE),NAND_OK);
+    fails += Expect("load after erase",NANDBBT_Load(),NAND_OK);
+    NANDBBT_GetInfo(&info);
+    fails += Expect("version after erase",info.version,version);
+    fails += Expect("not scanned",info.scanned,0);
+    fails += Expect("marked block",NANDBBT_IsBad(b-1),1);
+    fails += Expect("table block",NANDBBT_MarkBad(NANDBBT_BLOCK+1),NAND_ERR_PARAM);
+
+    return Report("bad block table",fails);
+}
+
+/**
+ * @brief  Fault injection with the expected counts, in a new device
+ *
+ * @return number of failed tests
+ */
+static int FaultTests(void) {
+int fails = 0;
+
+    if( NANDSim_Open(0) < 0 || NAND_Init() < 0 )
+        return 1;
+
+    fails += FactoryBadTest();
+    fails += GrownBadTest();
+    fails += EnduranceTest();
+    fails += BitFlipTest();
+    fails += LogFaultTest();
+    fails += TableTest();
+
+    NANDSim_Close();
+    return fails;
+}
+
+int main(int argc, char *argv[]) {
+NANDSim_StatsType s;
+int fails;
+
+    if( NANDSim_Open(argc>1?argv[1]:0) < 0 ) {
+        fprintf(stderr,"Cannot open %s\n",argv[1]);
+        return 1;
+    }
+    if( NAND_Init() < 0 )
+        return 1;
+
+    BBTBenchmark();
+#ifdef USE_YAFFS
+    YAFFSBenchmark();
+#else
+    NANDBenchmark();
+#endif
+    LogBenchmark();
+
+    PrintWear(0,NAND_BLOCKCOUNT);
+    NANDSim_GetStats(&s);
+    printf("corrected %lu uncorrectable %lu overwrites %lu nop violations %lu\n",
+            (unsigned long) s.corrected,(unsigned long) s.uncorrectable,
+            (unsigned long) s.overwrites,(unsigned long) s.nopviolations);
+
+    // The faults are tested in another device, so the file is closed before
+    NANDSim_Close();
+    fails = FaultTests();
+
+    return fails != 0;
+}
@@ -0,0 +1,698 @@
+/**
+ * @file nand-sim.c
+ * @brief Model of the NAND256 device for a Linux host
+ *
+ * @note
+ *      It implements the NAND_* functions of nand-flash.h with the same return values
+ *      and spare area layout (byte 5 bad block flag, bytes 6-8 ECC).
+ *
+ * @note
+ *      The pages (512+16 bytes) are stored in a file that is mapped into memory, so the
+ *      contents survive between runs (e.g. to measure the mount time). Without a file,
+ *      anonymous memory is used.
+ *
+ * @note
+ *      Program only changes bits from 1 to 0 and erase sets all bits of a block. Erase
+ *      counts, the number of programs of each page and the time are kept in RAM.
+ *
+ * @note
+ *      Time is simulated. Each operation adds the command, transfer and busy times.
+ *      NAND_WritePageStart and NAND_EraseBlockStart do not wait for the busy period,
+ *      that ends when the next operation is started (NANDSim_Advance accounts for the
+ *      CPU time in between).
+ *
+ * @note
+ *      Copy back copies the stored page (with its bit errors) inside the device, so
+ *      only the command and address cycles are added (and the transfer when verified).
+ *
+ * @version 1.0.0
+ * Date:    7 October 2023
+ *
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "nand-flash.h"
+#include "nand-sim.h"
+
+#ifndef BIT
+#define BIT(N)  (1U<<(N))
+#endif
+
+/**
+ *  @brief  Storage layout
+ */
+///@{
+#define PAGESTORAGE                             (NAND_PAGESIZE+NAND_SPARESIZE)
+#define STORAGESIZE                             ((size_t) NAND_PAGECOUNT*PAGESTORAGE)
+#define PAGEINDEX(A)                            ((A)/NAND_PAGESIZE)
+#define BLOCKINDEX(A)                           ((A)/NAND_BLOCKSIZE)
+#define ECCMASK                                 (0x00FFFFFFU)
+#define ECCBITS                                 (12)
+///@}
+
+/**
+ *  @brief  Signature (same as the NAND256W3A)
+ */
+///@{
+#define MFG_CODE                                0x20
+#define DEV_CODE                                0x75
+///@}
+
+static uint8_t *storage = 0;
+static int      fd = -1;
+
+static NANDSim_TimingType timing = {
+    .read       = 12000,
+    .program    = 200000,
+    .erase      = 2000000,
+    .byte       = 83,
+    .command    = 500,
+};
+
+static NANDSim_StatsType stats;
+static uint64_t now         = 0;
+static uint64_t busyuntil   = 0;
+static uint8_t  pending     = 0;
+static int      status      = NAND_OK;              // Result of the running operation
+static int      lasterror   = NAND_OK;
+
+static uint32_t erasecount[NAND_BLOCKCOUNT];
+static uint8_t  failing[NAND_BLOCKCOUNT];
+static uint8_t  nop[NAND_PAGECOUNT];
+static uint32_t endurance   = NANDSIM_ENDURANCE;
+
+static uint32_t flipppm     = 0;
+static uint32_t randstate   = 1;
+
+static uint32_t eccmask[NAND_PAGESIZE*8];
+static int      eccready    = 0;
+
+
+/**
+ * @brief  xorshift32 generator for bit flips
+ */
+static uint32_t Random(void) {
+uint32_t x = randstate;
+
+    x ^= x<<13;
+    x ^= x>>17;
+    x ^= x<<5;
+    randstate = x;
+    return x;
+}
+
+/**
+ * @brief  ECC as expected by getECCerror in nand-flash.c
+ *
+ * @note   For each bit n of the bit index, bit 2n+1 (Pn) is the parity of the bits with
+ *         a one in that position and bit 2n (Pn') the parity of the others.
+ */
+static uint32_t ComputeECC(const uint8_t *data) {
+uint32_t ecc = 0;
+uint32_t i;
+int k;
+
+    if( !eccready ) {
+        for(i=0;i<NAND_PAGESIZE*8;i++) {
+            eccmask[i] = 0;
+            for(k=0;k<ECCBITS;k++)
+                eccmask[i] |= ((i>>k)&1) ? BIT(2*k+1) : BIT(2*k);
+        }
+        eccready = 1;
+    }
+    for(i=0;i<NAND_PAGESIZE*8;i++) {
+        if( data[i>>3]&BIT(i&7) )
+            ecc ^= eccmask[i];
+    }
+    return ecc;
+}
+
+/**
+ * @brief  Check and correct data. Same rules of CheckECC in nand-flash.c
+ */
+static int CheckECC(uint8_t *data, const uint8_t *sp) {
+uint32_t stored,w,wp,index,m;
+
+    stored =  (uint32_t) sp[NAND_SPARE_ECC]
+            |((uint32_t) sp[NAND_SPARE_ECC+1]<<8)
+            |((uint32_t) sp[NAND_SPARE_ECC+2]<<16);
+    if( stored == ECCMASK )
+        return NAND_OK;
+
+    w = (stored^ComputeECC(data))&ECCMASK;
+    if( w == 0 )
+        return NAND_OK;
+    if( (w&(w-1)) == 0 )
+        return NAND_ECC_CORRECTED;
+
+    wp = w&0xAAAAAAU;
+    if( ((wp>>1)^(w&0x555555U)) != 0x555555U )
+        return NAND_ERR_ECC;
+
+    index = 0;
+    for(m=1;wp;m<<=1,wp>>=2) {
+        if( wp&2 )
+            index |= m;
+    }
+    data[index>>3] ^= BIT(index&7);
+    return NAND_ECC_CORRECTED;
+}
+
+static inline uint8_t *Page(uint32_t addr) {
+
+    return storage+(size_t) PAGEINDEX(addr)*PAGESTORAGE;
+}
+
+/**
+ * @brief  Wait for the end of the running operation
+ */
+static int CompletePending(void) {
+
+    if( !pending )
+        return NAND_OK;
+    if( now < busyuntil )
+        now = busyuntil;
+    pending = 0;
+    return status;
+}
+
+static void FinishPending(void) {
+int rc;
+
+    rc = CompletePending();
+    if( rc < 0 && lasterror == NAND_OK )
+        lasterror = rc;
+}
+
+static void StartBusy(uint32_t t, int result) {
+
+    busyuntil = now+t;
+    stats.busytime += t;
+    status  = result;
+    pending = 1;
+}
+
+static inline int BlockFails(uint32_t addr) {
+uint32_t b = BLOCKINDEX(addr);
+
+    return failing[b] || (endurance && erasecount[b] >= endurance);
+}
+
+/**
+ * @brief  Program bits (1 to 0 only)
+ */
+static void Program(uint8_t *dst, const uint8_t *src, int n) {
+int over = 0;
+int i;
+
+    for(i=0;i<n;i++) {
+        if( (dst[i]&src[i]) != src[i] )
+            over = 1;
+        dst[i] &= src[i];
+    }
+    if( over )
+        stats.overwrites++;
+}
+
+static void CountProgram(uint32_t addr) {
+
+    if( ++nop[PAGEINDEX(addr)] > NANDSIM_MAXNOP )
+        stats.nopviolations++;
+}
+
+static int ReadPage(uint32_t addr, uint8_t *data, uint8_t *sp) {
+uint8_t *p;
+uint32_t bit;
+
+    if( addr >= NAND_CAPACITY || data == 0 )
+        return NAND_ERR_PARAM;
+
+    FinishPending();
+
+    p = Page(addr);
+    memcpy(data,p,NAND_PAGESIZE);
+    memcpy(sp,p+NAND_PAGESIZE,NAND_SPARESIZE);
+
+    now += timing.command+timing.read+PAGESTORAGE*timing.byte;
+    stats.busytime += timing.read;
+    stats.reads++;
+
+    if( flipppm && Random()%1000000 < flipppm ) {
+        bit = Random()%(NAND_PAGESIZE*8);
+        data[bit>>3] ^= BIT(bit&7);
+        stats.bitflips++;
+    }
+
+    switch( CheckECC(data,sp) ) {
+    case NAND_ECC_CORRECTED:
+        stats.corrected++;
+        return NAND_ECC_CORRECTED;
+    case NAND_ERR_ECC:
+        stats.uncorrectable++;
+        return NAND_ERR_ECC;
+    }
+    return NAND_OK;
+}
+
+static int ProgramPage(uint32_t addr, const uint8_t *data, const uint8_t *sp) {
+uint8_t oob[NAND_SPARESIZE];
+uint32_t ecc;
+uint8_t *p;
+int fail;
+int i;
+
+    if( addr >= NAND_CAPACITY || data == 0 )
+        return NAND_ERR_PARAM;
+
+    FinishPending();
+
+    for(i=0;i<NAND_SPARESIZE;i++)
+        oob[i] = sp ? sp[i] : 0xFF;
+    oob[NAND_SPARE_BADBLOCK] = 0xFF;
+    ecc = ComputeECC(data);
+    oob[NAND_SPARE_ECC]   = (uint8_t) ecc;
+    oob[NAND_SPARE_ECC+1] = (uint8_t) (ecc>>8);
+    oob[NAND_SPARE_ECC+2] = (uint8_t) (ecc>>16);
+
+    p = Page(addr);
+    Program(p,data,NAND_PAGESIZE);
+    Program(p+NAND_PAGESIZE,oob,NAND_SPARESIZE);
+    CountProgram(addr);
+
+    fail = BlockFails(addr);
+    if( fail )
+        stats.programfails++;
+    stats.programs++;
+    now += timing.command+PAGESTORAGE*timing.byte;
+    StartBusy(timing.program,fail?NAND_ERR_FAIL:NAND_OK);
+
+    return NAND_OK;
+}
+
+static int StartErase(uint32_t addr) {
+uint32_t b;
+int fail;
+
+    if( addr >= NAND_CAPACITY )
+        return NAND_ERR_PARAM;
+
+    FinishPending();
+
+    b = BLOCKINDEX(addr);
+    fail = BlockFails(addr);
+    if( fail ) {
+        stats.erasefails++;
+    } else {
+        memset(storage+(size_t) b*NAND_PAGESPERBLOCK*PAGESTORAGE,0xFF,
+                                            NAND_PAGESPERBLOCK*PAGESTORAGE);
+        memset(nop+b*NAND_PAGESPERBLOCK,0,NAND_PAGESPERBLOCK);
+    }
+    erasecount[b]++;
+    stats.erases++;
+    now += timing.command;
+    StartBusy(timing.erase,fail?NAND_ERR_FAIL:NAND_OK);
+
+    return NAND_OK;
+}
+
+/**
+ * @brief  Copy back program (as in nand-flash.c)
+ */
+static int Copyback(uint32_t src, uint32_t dst, int verify) {
+uint8_t data[NAND_PAGESIZE];
+uint8_t sp[NAND_SPARESIZE];
+int sameplane;
+int fail;
+int rc;
+
+    if( src >= NAND_CAPACITY || dst >= NAND_CAPACITY )
+        return NAND_ERR_PARAM;
+
+    sameplane = NAND_SAMEPLANE(src,dst);
+    if( verify || !sameplane ) {
+        rc = ReadPage(src,data,sp);
+        if( rc < 0 )
+            return rc;
+        if( rc == NAND_ECC_CORRECTED || !sameplane ) {
+            fail = ProgramPage(dst,data,sp);
+            return fail < 0 ? fail : rc;
+        }
+    } else {
+        FinishPending();
+        now += timing.command+timing.read;
+        stats.busytime += timing.read;
+    }
+
+    Program(Page(dst),Page(src),PAGESTORAGE);
+    CountProgram(dst);
+
+    fail = BlockFails(dst);
+    if( fail )
+        stats.programfails++;
+    stats.programs++;
+    stats.copies++;
+    now += timing.command;
+    StartBusy(timing.program,fail?NAND_ERR_FAIL:NAND_OK);
+
+    return NAND_OK;
+}
+
+/**
+ * @brief  Open the storage file
+ *
+ * @note   A new (or resized) file is filled with ones (erased). When filename is
+ *         null, the contents are not kept.
+ *
+ * @return 0 if OK, negative in case of error
+ */
+int NANDSim_Open(const char *filename) {
+struct stat st;
+int fresh = 1;
+
+    NANDSim_Close();
+
+    if( filename ) {
+        fd = open(filename,O_RDWR|O_CREAT,0644);
+        if( fd < 0 )
+            return NAND_ERR_DEVICE;
+        if( fstat(fd,&st) == 0 && (size_t) st.st_size == STORAGESIZE ) {
+            fresh = 0;
+        } else if( ftruncate(fd,(off_t) STORAGESIZE) < 0 ) {
+            close(fd);
+            fd = -1;
+            return NAND_ERR_DEVICE;
+        }
+        storage = mmap(0,STORAGESIZE,PROT_READ|PROT_WRITE,MAP_SHARED,fd,0);
+    } else {
+        storage = mmap(0,STORAGESIZE,PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_ANONYMOUS,-1,0);
+    }
+    if( storage == MAP_FAILED ) {
+        storage = 0;
+        NANDSim_Close();
+        return NAND_ERR_DEVICE;
+    }
+    if( fresh )
+        memset(storage,0xFF,STORAGESIZE);
+
+    memset(erasecount,0,sizeof(erasecount));
+    memset(failing,0,sizeof(failing));
+    memset(nop,0,sizeof(nop));
+    pending   = 0;
+    lasterror = NAND_OK;
+
+    return NAND_OK;
+}
+
+/**
+ * @brief  Write back and unmap the storage
+ */
+void NANDSim_Close(void) {
+
+    if( storage ) {
+        if( fd >= 0 )
+            (void) msync(storage,STORAGESIZE,MS_SYNC);
+        (void) munmap(storage,STORAGESIZE);
+        storage = 0;
+    }
+    if( fd >= 0 ) {
+        close(fd);
+        fd = -1;
+    }
+}
+
+void NANDSim_SetTiming(const NANDSim_TimingType *t) {
+
+    timing = *t;
+}
+
+/**
+ * @brief  Mark a block as a factory bad block
+ *
+ * @note   The bad block flag is cleared in the first two pages and the block fails
+ *         all programs and erases.
+ */
+void NANDSim_SetBadBlock(uint32_t block) {
+uint8_t *p;
+
+    if( block >= NAND_BLOCKCOUNT )
+        return;
+    p = Page(block*NAND_BLOCKSIZE);
+    p[NAND_PAGESIZE+NAND_SPARE_BADBLOCK] = 0;
+    p[PAGESTORAGE+NAND_PAGESIZE+NAND_SPARE_BADBLOCK] = 0;
+    failing[block] = 1;
+}
+
+/**
+ * @brief  Make programs and erases of a block fail (grown bad block)
+ */
+void NANDSim_SetFailingBlock(uint32_t block) {
+
+    if( block < NAND_BLOCKCOUNT )
+        failing[block] = 1;
+}
+
+/**
+ * @brief  Number of erases after which a block fails (0: unlimited)
+ */
+void NANDSim_SetEndurance(uint32_t cycles) {
+
+    endurance = cycles;
+}
+
+/**
+ * @brief  Flip a stored bit (bit index in the page, 0 to 4223, including spare)
+ */
+void NANDSim_FlipBit(uint32_t pageaddr, uint32_t bit) {
+
+    if( pageaddr >= NAND_CAPACITY || bit >= PAGESTORAGE*8 )
+        return;
+    Page(pageaddr)[bit>>3] ^= BIT(bit&7);
+    stats.bitflips++;
+}
+
+/**
+ * @brief  Probability (in parts per million) of a bit flip in the data of a page read
+ *
+ * @note   The flip is not stored (read disturb). seed must not be zero.
+ */
+void NANDSim_SetFlipRate(uint32_t ppm, uint32_t seed) {
+
+    flipppm = ppm;
+    if( seed )
+        randstate = seed;
+}
+
+/**
+ * @brief  Account CPU time between NAND operations
+ */
+void NANDSim_Advance(uint64_t ns) {
+
+    now += ns;
+}
+
+uint64_t NANDSim_GetTime(void) {
+
+    return now;
+}
+
+void NANDSim_GetStats(NANDSim_StatsType *s) {
+
+    *s = stats;
+    s->time = now;
+}
+
+void NANDSim_ClearStats(void) {
+
+    memset(&stats,0,sizeof(stats));
+}
+
+uint32_t NANDSim_GetEraseCount(uint32_t block) {
+
+    return block < NAND_BLOCKCOUNT ? erasecount[block] : 0;
+}
+
+
+/**
+ * @brief  NAND interface (see nand-flash.c)
+ */
+
+int NAND_Init(void) {
+
+    if( storage == 0 && NANDSim_Open(0) < 0 )
+        return NAND_ERR_DEVICE;
+
+    pending   = 0;
+    lasterror = NAND_OK;
+    return NAND_OK;
+}
+
+int NAND_ReadSignature(uint8_t *mfg, uint8_t *dev) {
+
+    FinishPending();
+    *mfg = MFG_CODE;
+    *dev = DEV_CODE;
+    return 0;
+}
+
+int NAND_WritePage(uint32_t pageaddr, const uint8_t *data) {
+
+    return NAND_WritePageSpare(pageaddr,data,0);
+}
+
+int NAND_WritePageSpare(uint32_t pageaddr, const uint8_t *data, const uint8_t *sp) {
+int rc;
+
+    rc = ProgramPage(pageaddr,data,sp);
+    if( rc < 0 )
+        return rc;
+    return CompletePending();
+}
+
+int NAND_WritePageStart(uint32_t pageaddr, const uint8_t *data, const uint8_t *sp) {
+
+    return ProgramPage(pageaddr,data,sp);
+}
+
+int NAND_ReadPage(uint32_t pageaddr, uint8_t *data) {
+uint8_t sp[NAND_SPARESIZE];
+
+    return ReadPage(pageaddr,data,sp);
+}
+
+int NAND_ReadPageSpare(uint32_t pageaddr, uint8_t *data, uint8_t *sp) {
+uint8_t tmp[NAND_SPARESIZE];
+
+    return ReadPage(pageaddr,data,sp ? sp : tmp);
+}
+
+int NAND_ReadSpare(uint32_t pageaddr, uint8_t *sp) {
+
+    if( pageaddr >= NAND_CAPACITY )
+        return NAND_ERR_PARAM;
+
+    FinishPending();
+
+    memcpy(sp,Page(pageaddr)+NAND_PAGESIZE,NAND_SPARESIZE);
+    now += timing.command+timing.read+NAND_SPARESIZE*timing.byte;
+    stats.busytime += timing.read;
+    stats.sparereads++;
+    return NAND_OK;
+}
+
+int NAND_WriteSpare(uint32_t pageaddr, const uint8_t *sp) {
+int fail;
+
+    if( pageaddr >= NAND_CAPACITY )
+        return NAND_ERR_PARAM;
+
+    FinishPending();
+
+    Program(Page(pageaddr)+NAND_PAGESIZE,sp,NAND_SPARESIZE);
+    CountProgram(pageaddr);
+
+    fail = BlockFails(pageaddr);
+    if( fail )
+        stats.programfails++;
+    stats.spareprograms++;
+    now += timing.command+NAND_SPARESIZE*timing.byte;
+    StartBusy(timing.program,fail?NAND_ERR_FAIL:NAND_OK);
+
+    return CompletePending();
+}
+
+int NAND_CopyPage(uint32_t srcaddr, uint32_t dstaddr, int verify) {
+int rc;
+int rc2;
+
+    rc = Copyback(srcaddr,dstaddr,verify);
+    if( rc < 0 )
+        return rc;
+    rc2 = CompletePending();
+    return rc2 < 0 ? rc2 : rc;
+}
+
+int NAND_CopyPageStart(uint32_t srcaddr, uint32_t dstaddr, int verify) {
+
+    return Copyback(srcaddr,dstaddr,verify);
+}
+
+int NAND_EraseBlock(uint32_t blockaddr) {
+int rc;
+
+    rc = StartErase(blockaddr);
+    if( rc < 0 )
+        return rc;
+    return CompletePending();
+}
+
+int NAND_EraseBlockStart(uint32_t blockaddr) {
+
+    return StartErase(blockaddr);
+}
+
+int NAND_Wait(void) {
+int rc;
+
+    rc = CompletePending();
+    if( rc == NAND_OK )
+        rc = lasterror;
+    lasterror = NAND_OK;
+    return rc;
+}
+
+int NAND_Busy(void) {
+
+    return pending && now < busyuntil;
+}
+
+int NAND_IsBadBlock(uint32_t blockaddr) {
+uint8_t sp[NAND_SPARESIZE];
+uint32_t a;
+int rc;
+int i;
+
+    a = blockaddr&~(NAND_BLOCKSIZE-1);
+    for(i=0;i<2;i++) {
+        rc = NAND_ReadSpare(a+i*NAND_PAGESIZE,sp);
+        if( rc < 0 )
+            return rc;
+        if( sp[NAND_SPARE_BADBLOCK] != 0xFF )
+            return 1;
+    }
+    return 0;
+}
+
+int NAND_MarkBadBlock(uint32_t blockaddr) {
+uint8_t sp[NAND_SPARESIZE];
+uint32_t a;
+
+    if( blockaddr >= NAND_CAPACITY )
+        return NAND_ERR_PARAM;
+
+    memset(sp,0xFF,NAND_SPARESIZE);
+    sp[NAND_SPARE_BADBLOCK] = 0;
+
+    a = blockaddr&~(NAND_BLOCKSIZE-1);
+    (void) NAND_WriteSpare(a,sp);
+    (void) NAND_WriteSpare(a+NAND_PAGESIZE,sp);
+
+    return NAND_OK;
+}
+
+int NAND_EnableWriteProtect(void) {
+
+    FinishPending();
+    return 0;
+}
+
+int NAND_DisableWriteProtect(void) {
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+#ifndef NAND_SIM_H
+#define NAND_SIM_H
+
+/**
+ * @file nand-sim.h
+ * @brief Model of the NAND256 device for a Linux host
+ *
+ * @note
+ *      nand-sim.c implements the NAND_* functions of nand-flash.h, so the code above them
+ *      (e.g. yaffs-drv.c) runs unchanged on the host. The functions below configure
+ *      the model and read its statistics.
+ *
+ * @version 1.0.0
+ * Date:    7 October 2023
+ *
+ */
+
+#include <stdint.h>
+#include "nand-flash.h"
+
+/**
+ *  @brief  Timing (in ns)
+ *
+ *  @note   Defaults from the NAND256W3A datasheet (typical values) and the EBI timing
+ *          used by nand-flash.c (4 HFPERCLK cycles per byte at 48 MHz)
+ */
+typedef struct {
+    uint32_t    read;                               /**< tR: array to page buffer */
+    uint32_t    program;                            /**< tPROG                    */
+    uint32_t    erase;                              /**< tBERS                    */
+    uint32_t    byte;                               /**< one byte transfer        */
+    uint32_t    command;                            /**< command and address      */
+} NANDSim_TimingType;
+
+/**
+ *  @brief  Statistics
+ */
+typedef struct {
+    uint64_t    time;                               /**< simulated time (ns)      */
+    uint64_t    busytime;                           /**< device busy time (ns)    */
+    uint32_t    reads;                              /**< page reads               */
+    uint32_t    sparereads;                         /**< spare area reads         */
+    uint32_t    programs;                           /**< page programs            */
+    uint32_t    spareprograms;                      /**< spare area programs      */
+    uint32_t    copies;                             /**< copy back programs       */
+    uint32_t    erases;
+    uint32_t    programfails;
+    uint32_t    erasefails;
+    uint32_t    corrected;                          /**< single bit errors        */
+    uint32_t    uncorrectable;
+    uint32_t    bitflips;                           /**< injected bit flips       */
+    uint32_t    overwrites;                         /**< tried to change 0 to 1   */
+    uint32_t    nopviolations;                      /**< too many partial programs*/
+} NANDSim_StatsType;
+
+/**
+ *  @brief  Maximal number of programs of a page between erases and default endurance
+ */
+///@{
+#define NANDSIM_MAXNOP                          (3)
+#define NANDSIM_ENDURANCE                       (100000UL)
+///@}
+
+int  NANDSim_Open(const char *filename);
+void NANDSim_Close(void);
+
+void NANDSim_SetTiming(const NANDSim_TimingType *timing);
+void NANDSim_SetBadBlock(uint32_t block);
+void NANDSim_SetFailingBlock(uint32_t block);
+void NANDSim_SetEndurance(uint32_t cycles);
+void NANDSim_FlipBit(uint32_t pageaddr, uint32_t bit);
+void NANDSim_SetFlipRate(uint32_t ppm, uint32_t seed);
+
+void NANDSim_Advance(uint64_t ns);
+uint64_t NANDSim_GetTime(void);
+void NANDSim_GetStats(NANDSim_StatsType *stats);
+void NANDSim_ClearStats(void);
+uint32_t NANDSim_GetEraseCount(uint32_t block);
+
+#endif // NAND_SIM_H
@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 /*
  * Including this file, it is possible to define which processor using command line
  * E.g. -DEFM32GG995F1024
@@ -16,6 +17,13 @@
 #include "clock_efm32gg_ext.h"
 
 #include "led.h"
+#include "nand-flash.h"
+#include "nand-bbt.h"
+#include "yaffs-drv.h"
+
+#ifdef USE_YAFFS
+#include "yaffsfs.h"
+#endif
 
 
 //void UART0_TX_IRQHandler(void);
@@ -51,6 +59,192 @@ uint64_t l = tick+delay;
 }
 
 
+/**
+ * @brief  Benchmark parameters
+ *
+ * @note   The raw benchmark erases the last BENCH_BLOCKS blocks of the YAFFS area (lower
+ *         half), so the record log (upper half) is kept. It is only run when YAFFS is
+ *         not used (it would destroy the file system).
+ */
+///@{
+#define BENCH_BLOCKS                        (8)
+#define BENCH_FILESIZE                      (256*1024L)
+#define BENCH_WRITESIZE                     (1024)
+///@}
+
+static uint32_t benchbuffer[BENCH_WRITESIZE/4];
+
+static uint32_t Elapsed(uint64_t start) {
+
+    return (uint32_t) (tick-start);
+}
+
+/// Throughput in KB/s
+static uint32_t Throughput(uint32_t bytes, uint32_t ms) {
+
+    if( ms == 0 )
+        ms = 1;
+    return (uint32_t) ((uint64_t) bytes*1000/1024/ms);
+}
+
+/**
+ * @brief  Load (or build at the first boot) the bad block table
+ */
+static void BBTLoad(void) {
+NANDBBT_InfoType info;
+uint64_t start;
+int rc;
+
+    start = tick;
+    rc = NANDBBT_Load();
+    NANDBBT_GetInfo(&info);
+    printf("bad block table: %lu ms (%s) version %lu bad blocks %lu (%d)\n",
+                (unsigned long) Elapsed(start),info.scanned?"scan":"load",
+                (unsigned long) info.version,(unsigned long) info.badblocks,rc);
+}
+
+#ifndef USE_YAFFS
+/**
+ * @brief  Raw page throughput
+ *
+ * @note   Erase, page program (with and without waiting), page read and spare read
+ */
+static void NANDBenchmark(void) {
+uint8_t *data = (uint8_t *) benchbuffer;
+uint8_t sp[NAND_SPARESIZE];
+uint32_t first = (YDRV_LASTBLOCK+1-BENCH_BLOCKS)*NAND_BLOCKSIZE;
+uint32_t last  = (YDRV_LASTBLOCK+1)*NAND_BLOCKSIZE;
+uint32_t bytes = BENCH_BLOCKS*NAND_BLOCKSIZE;
+uint64_t start;
+uint32_t ms;
+uint32_t a;
+int i;
+
+    for(i=0;i<NAND_PAGESIZE;i++)
+        data[i] = (uint8_t) i;
+
+    start = tick;
+    for(a=first;a<last;a+=NAND_BLOCKSIZE)
+        (void) NAND_EraseBlock(a);
+    ms = Elapsed(start);
+    printf("erase %d blocks: %lu ms\n",BENCH_BLOCKS,(unsigned long) ms);
+
+    start = tick;
+    for(a=first;a<last;a+=NAND_PAGESIZE)
+        (void) NAND_WritePage(a,data);
+    ms = Elapsed(start);
+    printf("write: %lu KB/s\n",(unsigned long) Throughput(bytes,ms));
+
+    for(a=first;a<last;a+=NAND_BLOCKSIZE)
+        (void) NAND_EraseBlock(a);
+    start = tick;
+    for(a=first;a<last;a+=NAND_PAGESIZE)
+        (void) NAND_WritePageStart(a,data,0);
+    (void) NAND_Wait();
+    ms = Elapsed(start);
+    printf("write (overlapped): %lu KB/s\n",(unsigned long) Throughput(bytes,ms));
+
+    start = tick;
+    for(a=first;a<last;a+=NAND_PAGESIZE)
+        (void) NAND_ReadPage(a,data);
+    ms = Elapsed(start);
+    printf("read: %lu KB/s\n",(unsigned long) Throughput(bytes,ms));
+
+    start = tick;
+    for(a=first;a<last;a+=NAND_PAGESIZE)
+        (void) NAND_ReadSpare(a,sp);
+    ms = Elapsed(start);
+    printf("spare read: %lu us/page\n",
+                (unsigned long) (ms*1000/(bytes/NAND_PAGESIZE)));
+
+    // Relocation of the first blocks (garbage collection)
+    for(a=first;a<first+BENCH_BLOCKS/2*NAND_BLOCKSIZE;a+=NAND_BLOCKSIZE)
+        (void) NAND_EraseBlock(a+BENCH_BLOCKS/2*NAND_BLOCKSIZE);
+    start = tick;
+    for(a=first;a<first+BENCH_BLOCKS/2*NAND_BLOCKSIZE;a+=NAND_PAGESIZE)
+        (void) NAND_CopyPage(a,a+BENCH_BLOCKS/2*NAND_BLOCKSIZE,0);
+    ms = Elapsed(start);
+    printf("copy back: %lu us/page\n",
+                (unsigned long) (ms*1000/(bytes/2/NAND_PAGESIZE)));
+}
+#else
+/**
+ * @brief  YAFFS mount time and file throughput
+ *
+ * @note   The mount after a power loss is simulated by a forced unmount without
+ *         checkpoint and a mount that ignores the checkpoint (full scan of the tags).
+ */
+static void YAFFSBenchmark(void) {
+struct yaffs_dev *dev;
+YDRV_StatsType st;
+uint64_t start;
+uint32_t ms;
+long n;
+int fd;
+
+    dev = YDRV_Install("/nand");
+
+    start = tick;
+    if( yaffs_mount("/nand") < 0 ) {
+        printf("mount failed\n");
+        return;
+    }
+    ms = Elapsed(start);
+    printf("mount: %lu ms\n",(unsigned long) ms);
+
+    memset(benchbuffer,0x5A,sizeof(benchbuffer));
+    YDRV_ClearStats();
+    start = tick;
+    fd = yaffs_open("/nand/bench",O_CREAT|O_RDWR|O_TRUNC,S_IREAD|S_IWRITE);
+    for(n=0;n<BENCH_FILESIZE;n+=BENCH_WRITESIZE)
+        (void) yaffs_write(fd,benchbuffer,BENCH_WRITESIZE);
+    (void) yaffs_close(fd);
+    (void) yaffs_sync("/nand");
+    (void) YDRV_Flush();
+    ms = Elapsed(start);
+    printf("file write: %lu KB/s\n",(unsigned long) Throughput(BENCH_FILESIZE,ms));
+
+    start = tick;
+    fd = yaffs_open("/nand/bench",O_RDONLY,0);
+    for(n=0;n<BENCH_FILESIZE;n+=BENCH_WRITESIZE)
+        (void) yaffs_read(fd,benchbuffer,BENCH_WRITESIZE);
+    (void) yaffs_close(fd);
+    ms = Elapsed(start);
+    printf("file read: %lu KB/s\n",(unsigned long) Throughput(BENCH_FILESIZE,ms));
+
+    YDRV_GetStats(&st);
+    printf("reads %lu tags %lu hits %lu writes %lu erases %lu\n",
+            (unsigned long) st.reads,(unsigned long) st.tagreads,
+            (unsigned long) st.hits,(unsigned long) st.writes,
+            (unsigned long) st.erases);
+
+    // Clean unmount. The checkpoint is written
+    (void) yaffs_unmount("/nand");
+    start = tick;
+    (void) yaffs_mount("/nand");
+    ms = Elapsed(start);
+    printf("mount (checkpoint): %lu ms\n",(unsigned long) ms);
+
+    // Power loss
+    dev->param.skip_checkpt_wr = 1;
+    (void) yaffs_unmount2("/nand",1);
+    dev->param.skip_checkpt_rd = 1;
+    YDRV_ClearStats();
+    start = tick;
+    (void) yaffs_mount("/nand");
+    ms = Elapsed(start);
+    YDRV_GetStats(&st);
+    printf("mount (scan): %lu ms, %lu tag reads\n",(unsigned long) ms,
+                                                (unsigned long) st.tagreads);
+    dev->param.skip_checkpt_wr = 0;
+    dev->param.skip_checkpt_rd = 0;
+
+    (void) yaffs_unlink("/nand/bench");
+    (void) yaffs_unmount("/nand");
+}
+#endif
+
+
 /**************************************************************************//**
  * @brief  Main function
  *
@@ -79,6 +273,18 @@ int tryn = 0;
     __enable_irq();
 
     printf("Hello\n");
+
+    if( NAND_Init() < 0 ) {
+        printf("NAND not found\n");
+    } else {
+        BBTLoad();
+#ifdef USE_YAFFS
+        YAFFSBenchmark();
+#else
+        NANDBenchmark();
+#endif
+    }
+
     while (1) {
         putchar('+');
         Delay(100);
@@ -0,0 +1,319 @@
+/**
+ * @file nand-bbt.c
+ * @brief Bad block table of the NAND256 device
+ *
+ * @note
+ *      Checking the factory markers of all blocks reads two spare areas per block
+ *      (4096 reads). The table is built once and saved in the NANDBBT_BLOCKS blocks
+ *      starting at NANDBBT_BLOCK. Each version goes to the next free page of the block
+ *      in use. When it is full, the other block is erased and used, so the last
+ *      version is kept until a new one is written. At boot, a binary search of the
+ *      spare areas finds the last saved page of each block and the newest valid
+ *      version is loaded.
+ *
+ * @note
+ *      Page format: magic (4 bytes, also the format version), version (4 bytes),
+ *      number of blocks (2 bytes), number of bad blocks (2 bytes), bitmap and CRC16.
+ *      Byte 0 of the spare area marks a saved page.
+ *
+ * @note
+ *      When the table can not be read (e.g. power loss while it was saved), the
+ *      previous version is used. When there is none, the markers are scanned again.
+ *      NANDBBT_MarkBad also writes the marker in the block, so no information is lost.
+ *
+ * @note
+ *      When the second block is bad, only the first one is used and it is erased
+ *      before a new version is written, as before.
+ *
+ * @version 1.0.0
+ * Date:    7 October 2023
+ *
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "nand-flash.h"
+#include "nand-bbt.h"
+
+#ifndef BIT
+#define BIT(N)  (1U<<(N))
+#endif
+
+/**
+ *  @brief  Table page
+ */
+///@{
+#define TABLEMAGIC                              (0x31544242)    // "BBT1"
+#define SPAREMARK                               (0x42)
+#define OFF_MAGIC                               (0)
+#define OFF_VERSION                             (4)
+#define OFF_BLOCKS                              (8)
+#define OFF_BAD                                 (10)
+#define OFF_MAP                                 (12)
+#define MAPSIZE                                 (NAND_BLOCKCOUNT/8)
+#define OFF_CRC                                 (OFF_MAP+MAPSIZE)
+///@}
+
+#define CRC_POLY                                (0x1021)
+#define TABLEADDR(B,P)                          ((uint32_t) (NANDBBT_BLOCK+(B))*NAND_BLOCKSIZE\
+                                                    +(uint32_t) (P)*NAND_PAGESIZE)
+#define ISBAD(B)                                ((map[(B)>>3]&BIT((B)&7)) != 0)
+
+static uint8_t          map[MAPSIZE];
+static uint32_t         pagebuf[NAND_PAGESIZE/4];       // Word aligned for DMA
+static uint8_t          loaded      = 0;
+static uint32_t         curblock    = 0;                // relative to NANDBBT_BLOCK
+static uint32_t         nextpage    = NAND_PAGESPERBLOCK;
+static NANDBBT_InfoType info;
+
+
+static inline void PutWord(uint8_t *p, uint32_t w) {
+
+    p[0] = (uint8_t) w;
+    p[1] = (uint8_t) (w>>8);
+    p[2] = (uint8_t) (w>>16);
+    p[3] = (uint8_t) (w>>24);
+}
+
+static inline uint32_t GetWord(const uint8_t *p) {
+
+    return (uint32_t) p[0]|((uint32_t) p[1]<<8)|((uint32_t) p[2]<<16)|((uint32_t) p[3]<<24);
+}
+
+/**
+ * @brief  CRC16 (CCITT) of the table
+ */
+static uint16_t CRC16(const uint8_t *p, int n) {
+uint16_t crc = 0xFFFF;
+int i;
+
+    while( n-- > 0 ) {
+        crc ^= (uint16_t) (*p++)<<8;
+        for(i=0;i<8;i++) {
+            if( crc&0x8000 )
+                crc = (uint16_t) ((crc<<1)^CRC_POLY);
+            else
+                crc = (uint16_t) (crc<<1);
+        }
+    }
+    return crc;
+}
+
+static uint32_t CountBad(void) {
+uint32_t n = 0;
+uint32_t b;
+
+    for(b=0;b<NAND_BLOCKCOUNT;b++) {
+        if( map[b>>3]&BIT(b&7) )
+            n++;
+    }
+    return n;
+}
+
+/**
+ * @brief  Read the table saved in page p of table block b
+ *
+ * @return 1 if valid
+ */
+static int ReadTable(uint32_t b, uint32_t p) {
+uint8_t *d = (uint8_t *) pagebuf;
+uint16_t crc;
+
+    if( NAND_ReadPage(TABLEADDR(b,p),d) < 0 )
+        return 0;
+    if( GetWord(d+OFF_MAGIC) != TABLEMAGIC )
+        return 0;
+    if( (d[OFF_BLOCKS]|(d[OFF_BLOCKS+1]<<8)) != NAND_BLOCKCOUNT )
+        return 0;
+    crc = CRC16(d,OFF_CRC);
+    if( crc != (uint16_t) (d[OFF_CRC]|(d[OFF_CRC+1]<<8)) )
+        return 0;
+
+    memcpy(map,d+OFF_MAP,MAPSIZE);
+    info.version   = GetWord(d+OFF_VERSION);
+    info.badblocks = CountBad();
+    info.block     = NANDBBT_BLOCK+b;
+    info.page      = p;
+    return 1;
+}
+
+/**
+ * @brief  Find the last saved page of table block b (pages are saved in order)
+ *
+ * @return page or -1 if there is none
+ */
+static int LastPage(uint32_t b) {
+uint8_t sp[NAND_SPARESIZE];
+int lo,hi,mid,last;
+
+    lo = 0;
+    hi = NAND_PAGESPERBLOCK-1;
+    last = -1;
+    while( lo <= hi ) {
+        mid = (lo+hi)/2;
+        if( NAND_ReadSpare(TABLEADDR(b,mid),sp) < 0 )
+            return -1;
+        if( sp[0] == SPAREMARK ) {
+            last = mid;
+            lo = mid+1;
+        } else {
+            hi = mid-1;
+        }
+    }
+    return last;
+}
+
+/**
+ * @brief  Save a new version of the table in the next free page
+ *
+ * @note   When the block in use is full, the new version goes to the other one
+ */
+static int Save(void) {
+uint8_t sp[NAND_SPARESIZE];
+uint8_t *d = (uint8_t *) pagebuf;
+uint32_t b;
+uint16_t crc;
+int rc;
+
+    if( nextpage >= NAND_PAGESPERBLOCK ) {
+        b = (curblock+1)%NANDBBT_BLOCKS;
+        if( !ISBAD(NANDBBT_BLOCK+b) && NAND_EraseBlock(TABLEADDR(b,0)) < 0 ) {
+            (void) NAND_MarkBadBlock(TABLEADDR(b,0));
+            map[(NANDBBT_BLOCK+b)>>3] |= BIT((NANDBBT_BLOCK+b)&7);
+        }
+        if( ISBAD(NANDBBT_BLOCK+b) ) {
+            // Only this block is left. The table is lost if the power fails now
+            b = curblock;
+            rc = NAND_EraseBlock(TABLEADDR(b,0));
+            if( rc < 0 )
+                return rc;
+        }
+        curblock = b;
+        nextpage = 0;
+    }
+
+    info.version++;
+    info.badblocks = CountBad();
+    memset(d,0xFF,NAND_PAGESIZE);
+    PutWord(d+OFF_MAGIC,TABLEMAGIC);
+    PutWord(d+OFF_VERSION,info.version);
+    d[OFF_BLOCKS]   = (uint8_t) NAND_BLOCKCOUNT;
+    d[OFF_BLOCKS+1] = (uint8_t) (NAND_BLOCKCOUNT>>8);
+    d[OFF_BAD]      = (uint8_t) info.badblocks;
+    d[OFF_BAD+1]    = (uint8_t) (info.badblocks>>8);
+    memcpy(d+OFF_MAP,map,MAPSIZE);
+    crc = CRC16(d,OFF_CRC);
+    d[OFF_CRC]      = (uint8_t) crc;
+    d[OFF_CRC+1]    = (uint8_t) (crc>>8);
+
+    memset(sp,0xFF,NAND_SPARESIZE);
+    sp[0] = SPAREMARK;
+    rc = NAND_WritePageSpare(TABLEADDR(curblock,nextpage),d,sp);
+    info.block = NANDBBT_BLOCK+curblock;
+    info.page  = nextpage++;
+    return rc;
+}
+
+
+/**
+ * @brief  Build the table from the factory markers and save it
+ *
+ * @note   The table blocks are erased before, as an older version there could be
+ *         loaded instead of the new one
+ */
+int NANDBBT_Scan(void) {
+uint32_t b;
+int rc;
+
+    memset(map,0,sizeof(map));
+    for(b=0;b<NAND_BLOCKCOUNT;b++) {
+        if( b == NANDBBT_BLOCK )
+            continue;
+        rc = NAND_IsBadBlock(b*NAND_BLOCKSIZE);
+        if( rc < 0 )
+            return rc;
+        if( rc )
+            map[b>>3] |= BIT(b&7);
+    }
+    for(b=NANDBBT_BLOCKS-1;b>0;b--) {
+        if( !ISBAD(NANDBBT_BLOCK+b) && NAND_EraseBlock(TABLEADDR(b,0)) < 0 ) {
+            (void) NAND_MarkBadBlock(TABLEADDR(b,0));
+            map[(NANDBBT_BLOCK+b)>>3] |= BIT((NANDBBT_BLOCK+b)&7);
+        }
+    }
+    loaded = 1;
+    info.scanned = 1;
+    curblock = NANDBBT_BLOCKS-1;
+    nextpage = NAND_PAGESPERBLOCK;
+    return Save();
+}
+
+/**
+ * @brief  Load the table, or build it when there is no valid one
+ *
+ * @note   NAND_Init must be called before. It is called by NANDBBT_IsBad when needed.
+ */
+int NANDBBT_Load(void) {
+int last[NANDBBT_BLOCKS];
+int page[NANDBBT_BLOCKS];
+uint32_t version[NANDBBT_BLOCKS];
+int b,best;
+
+    // Newest valid version of each block
+    memset(&info,0,sizeof(info));
+    best = -1;
+    for(b=0;b<NANDBBT_BLOCKS;b++) {
+        last[b] = LastPage(b);
+        for(page[b]=last[b];page[b]>=0&&!ReadTable(b,page[b]);page[b]--) {}
+        version[b] = info.version;
+        if( page[b] >= 0 && (best < 0 || version[b] > version[best]) )
+            best = b;
+    }
+    if( best < 0 || !ReadTable(best,page[best]) )
+        return NANDBBT_Scan();
+
+    loaded   = 1;
+    curblock = best;
+    nextpage = last[best]+1;
+    return NAND_OK;
+}
+
+/**
+ * @brief  Check a block
+ *
+ * @return 1 if bad, 0 if good, negative for error
+ */
+int NANDBBT_IsBad(uint32_t block) {
+
+    if( block >= NAND_BLOCKCOUNT )
+        return NAND_ERR_PARAM;
+    if( !loaded && NANDBBT_Load() < 0 )
+        return NAND_IsBadBlock(block*NAND_BLOCKSIZE);
+
+    return (map[block>>3]&BIT(block&7)) != 0;
+}
+
+/**
+ * @brief  Mark a block as bad (marker in the block and table)
+ *
+ * @note   The table blocks can not be marked
+ */
+int NANDBBT_MarkBad(uint32_t block) {
+
+    if( block >= NAND_BLOCKCOUNT
+        || (block >= NANDBBT_BLOCK && block < NANDBBT_BLOCK+NANDBBT_BLOCKS) )
+        return NAND_ERR_PARAM;
+    if( !loaded )
+        (void) NANDBBT_Load();
+
+    (void) NAND_MarkBadBlock(block*NAND_BLOCKSIZE);
+    if( map[block>>3]&BIT(block&7) )
+        return NAND_OK;
+    map[block>>3] |= BIT(block&7);
+    return Save();
+}
+
+void NANDBBT_GetInfo(NANDBBT_InfoType *inf) {
+
+    *inf = info;
+}
@@ -0,0 +1,50 @@
+#ifndef NAND_BBT_H
+#define NAND_BBT_H
+
+/**
+ * @file nand-bbt.h
+ * @brief Bad block table of the NAND256 device
+ *
+ * @note
+ *      A bitmap in RAM with one bit for each block (1 = bad). It is built once by
+ *      scanning the factory markers and saved in the NANDBBT_BLOCKS blocks starting
+ *      at NANDBBT_BLOCK, so later boots only read it.
+ *
+ * @version 1.0.0
+ * Date:    7 October 2023
+ *
+ */
+
+#include <stdint.h>
+#include "nand-flash.h"
+
+/**
+ *  @brief  Blocks reserved for the table
+ *
+ *  @note   Block 0 is guaranteed good by the manufacturer. The versions are written
+ *          alternately in the two blocks, so there is always a complete one.
+ */
+///@{
+#define NANDBBT_BLOCK                           (0)
+#define NANDBBT_BLOCKS                          (2)
+///@}
+
+/**
+ *  @brief  Information about the table
+ */
+typedef struct {
+    uint32_t    version;                            /**< incremented at each save */
+    uint32_t    badblocks;
+    uint32_t    block;                              /**< where it was saved       */
+    uint32_t    page;
+    uint8_t     scanned;                            /**< built from the markers   */
+} NANDBBT_InfoType;
+
+int  NANDBBT_Load(void);
+int  NANDBBT_Scan(void);
+int  NANDBBT_IsBad(uint32_t block);
+int  NANDBBT_MarkBad(uint32_t block);
+
+void NANDBBT_GetInfo(NANDBBT_InfoType *info);
+
+#endif // NAND_BBT_H
@@ -7,6 +7,16 @@
  *
  *      It does not have Garbage Collection nor Wear-Leveling mechanims
  *
+ * @note
+ *      Page data is moved by DMA (word transfers from/to the EBI data window) and the
+ *      EBI generates the ECC while it is transferred. The ECC is stored in the spare
+ *      area and single bit errors are corrected when reading (getECCerror).
+ *
+ * @note
+ *      The end of a busy period is signalled by the rising edge of R/B, that generates
+ *      an interrupt. Program and erase can be started without waiting for their end
+ *      (NAND_WritePageStart, NAND_EraseBlockStart).
+ *
  * @version 1.0.0
  * Date:    7 October 2023
  *
@@ -41,6 +51,8 @@
 #include <em_device.h>
 #include <stdint.h>
 #include "gpio.h"
+#include "dma.h"
+#include "nand-flash.h"
 
 #ifndef BIT
 #define BIT(N)  (1U<<(N))
@@ -65,7 +77,8 @@
 #define CE_PINMODE                          GPIO_MODE_PUSHPULL
 
 #define RB_GPIO                             GPIOD
-#define RB_PINMASK                          BIT(15)
+#define RB_PIN                              (15)
+#define RB_PINMASK                          BIT(RB_PIN)
 #define RB_PINMODE                          GPIO_MODE_INPUT
 
 #define PWR_GPIO                            GPIOB
@@ -158,12 +171,12 @@
  * @brief  Adresses used to access NAND Flash
  */
 ///@{
-static       uint8_t * const pntData     = (uint8_t *) 0x80000000;
-static       uint8_t * const pntAddress  = (uint8_t *) 0x81000000;
-static       uint8_t * const pntCommand  = (uint8_t *) 0x82000000;
+static volatile uint8_t * const pntData     = (uint8_t *) 0x80000000;
+static volatile uint8_t * const pntAddress  = (uint8_t *) 0x81000000;
+static volatile uint8_t * const pntCommand  = (uint8_t *) 0x82000000;
 // To make write to or read from NAND Flash easier
 #define NAND_DATA       *pntData
-#define NAND_ADDRESS    *pntData
+#define NAND_ADDRESS    *pntAddress
 #define NAND_COMMAND    *pntCommand
 ///@}
 
@@ -171,13 +184,16 @@ static       uint8_t * const pntCommand  = (uint8_t *) 0x82000000;
  *  @brief  Spare Area (Area C)
  */
 ///@{
-#define BADBLOCKFLAG                     (5)
+#define BADBLOCKFLAG                     NAND_SPARE_BADBLOCK
 #define OKVALUE                         '\xFF'
-#define ECC0_POS                         (6)
-#define ECC1_POS                         (7)
-#define ECC2_POS                         (8)
+#define ECC0_POS                         (NAND_SPARE_ECC)
+#define ECC1_POS                         (NAND_SPARE_ECC+1)
+#define ECC2_POS                         (NAND_SPARE_ECC+2)
 
-static uint8_t spare[SPARESIZE];
+static uint8_t spare[NAND_SPARESIZE];
+
+/// Page data for copies with verification (word aligned for DMA)
+static uint32_t copybuffer[NAND_PAGESIZE/4];
 ///@}
 /**
  * @brief  Auxiliary routines.
@@ -195,7 +211,7 @@ static inline void DisableNANDPower(void) {
 }
 
 static inline void EnableNANDDevice(void) {
-    GPIO_WritePins(CE_GPIO, 0, CE_PINMASK);             // Set to High
+    GPIO_WritePins(CE_GPIO, CE_PINMASK, 0);             // Set to Low (negative logic)
 }
 
 static inline void DisableNANDDevice(void) {
@@ -227,6 +243,9 @@ static inline void EnableEBIClock(void) {
  */
 static inline void ConfigGPIOPins(void) {
 
+    CMU->HFPERCLKDIV |= CMU_HFPERCLKDIV_HFPERCLKEN;     // Enable HFPERCLK
+    CMU->HFPERCLKEN0 |= CMU_HFPERCLKEN0_GPIO;           // Enable HFPERCLK for GPIO
+
     GPIO_ConfigPins(WP_GPIO, WP_PINMASK, WP_PINMODE);
     GPIO_ConfigPins(CE_GPIO,  CE_PINMASK,  CE_PINMODE);
     GPIO_ConfigPins(PWR_GPIO, PWR_PINMASK, PWR_PINMODE);
@@ -289,7 +308,7 @@ static inline void ConfigEBIPins(void) {
 void ConfigEBI(void) {
 
     EBI->ADDRTIMING =  (ADDR_HOLDTIME<<_EBI_ADDRTIMING_ADDRHOLD_SHIFT)
-                      |(ADDR_SETUPTIME<<_EBI_ADDRTIMING_ADDRSETUP_MASK);
+                      |(ADDR_SETUPTIME<<_EBI_ADDRTIMING_ADDRSETUP_SHIFT);
     EBI->RDTIMING   =  (RD_HOLDTIME<<_EBI_RDTIMING_RDHOLD_SHIFT)
                       |(RD_SETUPTIME<<_EBI_RDTIMING_RDSETUP_SHIFT)
                       |(RD_STROBETIME<<_EBI_RDTIMING_RDSTRB_SHIFT);
@@ -308,41 +327,6 @@ void ConfigEBI(void) {
 }
 
 
-/**
- * @brief   Copy bach programm
- *
- * @note    Copy from one page to another without external access
- *
- * @note    It uses a 4-step procedure
- *
- *          1. Use READ_A command ot get a certain page to the Page Buffer;
- *             Address must be written into the NAND device
-               It will copy 528 bytes to the Page Buffer
- *          2. Wait until device is ready (RB=0)
- *          3. Send the COPY_BACK command (0x8A).
- *             Send the address.
- *             Send command 0x10
- *          4. Send command 0x70 to get SR0
- *          5. Confirm operation by sending CONFIRM command ????!??!??!
- *
- *  @note
- *          In a 256 Mbyte device the 24th bit must be the same
- *
- *          | Density   |   Same address bit   |
- *          |-----------|----------------------|
- *          |  128 MB   |       A23            |
- *          |  256 MB   |       A24            |
- *          |  512 MB   |       A25            |
- *          | 1024 MB   |       A25,A26        |
- */
-static int
-Copyback(int param) {
-
-
-    return 0;
-}
-
-
 /**
  *  @brief  Get ECC Error Information
  *
@@ -435,13 +419,417 @@ uint32_t m;
     return NAND_ONEERROR;
 }
 
+/**
+ * @brief  DMA channel used for page data
+ *
+ * @note   -1: data is moved by the CPU. DMA is also not used when the buffer is not word
+ *         aligned.
+ */
+#define NAND_DMACHANNEL                     (7)
+
+/**
+ * @brief  Maximal number of iterations waiting for R/B or DMA
+ *
+ * @note   The longest operation is the block erase (3 ms)
+ */
+#define NAND_TIMEOUT                        (1000000UL)
+
+/**
+ * @brief  Driver state
+ */
+///@{
+static volatile uint8_t nandready = 1;      // Set by the rising edge of R/B
+static volatile uint8_t dmadone   = 1;
+static uint8_t  pending           = 0;      // Program or erase not confirmed yet
+static int      lasterror         = NAND_OK;// Error of a started operation not reported
+static uint8_t  writeprotect      = 1;      // WP# low when no program/erase is running
+///@}
+
+/**
+ * @brief  R/B interrupt (rising edge: end of busy period)
+ */
+static void ReadyCallback(uint32_t in) {
+
+    (void) in;
+    nandready = 1;
+}
+
+/**
+ * @brief  DMA interrupt (end of page data)
+ */
+static void DMACallback(int chn) {
+
+    (void) chn;
+    dmadone = 1;
+}
+
+/**
+ * @brief  Wait for the R/B rising edge
+ *
+ * @note   nandready must be cleared before the command that makes the device busy,
+ *         because R/B only goes low some time (tWB) after it.
+ */
+static int WaitReady(void) {
+uint32_t n;
+
+    for(n=0;n<NAND_TIMEOUT;n++) {
+        if( nandready )
+            return NAND_OK;
+    }
+    return NAND_ERR_TIMEOUT;
+}
+
+/**
+ * @brief  Address cycles
+ *
+ * @note   Page: column (always 0), A16-A9 and A24-A17. Block: A16-A9 and A24-A17 (the
+ *         page bits are ignored)
+ */
+///@{
+static inline void SendPageAddress(uint32_t addr) {
+
+    NAND_ADDRESS = 0;
+    NAND_ADDRESS = (uint8_t) (addr>>9);
+    NAND_ADDRESS = (uint8_t) (addr>>17);
+}
+
+static inline void SendBlockAddress(uint32_t addr) {
+
+    NAND_ADDRESS = (uint8_t) (addr>>9);
+    NAND_ADDRESS = (uint8_t) (addr>>17);
+}
+///@}
+
+/**
+ * @brief  ECC generation by the EBI
+ *
+ * @note   All data read or written between start and stop is used
+ */
+///@{
+static inline void StartECC(void) {
+
+    EBI->CMD = EBI_CMD_ECCCLEAR|EBI_CMD_ECCSTART;
+}
+
+static inline uint32_t StopECC(void) {
+
+    EBI->CMD = EBI_CMD_ECCSTOP;
+    return EBI->ECCPARITY&ECCMASK;
+}
+///@}
+
+/**
+ * @brief  Transfer data from/to the data window
+ *
+ * @note   With DMA, the CPU only waits for the end of transfer
+ */
+///@{
+static int WaitDMA(void) {
+uint32_t n;
+
+    for(n=0;n<NAND_TIMEOUT;n++) {
+        if( dmadone )
+            return NAND_OK;
+    }
+    DMA_Stop(NAND_DMACHANNEL);
+    return NAND_ERR_TIMEOUT;
+}
+
+static int ReadData(uint8_t *data, int n) {
+int i;
+
+    if( NAND_DMACHANNEL >= 0 && ((uint32_t) data&3) == 0 ) {
+        dmadone = 0;
+        if( DMA_StartMemRx(NAND_DMACHANNEL,pntData,data,n,DMACallback) == 0 )
+            return WaitDMA();
+        dmadone = 1;
+    }
+    for(i=0;i<n;i++)
+        data[i] = NAND_DATA;
+    return NAND_OK;
+}
+
+static int WriteData(const uint8_t *data, int n) {
+int i;
+
+    if( NAND_DMACHANNEL >= 0 && ((uint32_t) data&3) == 0 ) {
+        dmadone = 0;
+        if( DMA_StartMemTx(NAND_DMACHANNEL,pntData,data,n,DMACallback) == 0 )
+            return WaitDMA();
+        dmadone = 1;
+    }
+    for(i=0;i<n;i++)
+        NAND_DATA = data[i];
+    return NAND_OK;
+}
+///@}
+
+/**
+ * @brief  Write protection around program and erase
+ */
+///@{
+static inline void Unprotect(void) {
+
+    if( writeprotect )
+        DisableWriteProtect();
+}
+
+static inline void Reprotect(void) {
+
+    if( writeprotect )
+        EnableWriteProtect();
+}
+///@}
+
+/**
+ * @brief  Read status register
+ */
+static inline uint8_t ReadStatus(void) {
+
+    NAND_COMMAND = CMD_READ_STATUS;
+    return NAND_DATA;
+}
+
+/**
+ * @brief  Wait for the end of a program or erase and get its result
+ *
+ * @return NAND_OK if none is running
+ */
+static int CompletePending(void) {
+int rc;
+
+    if( !pending )
+        return NAND_OK;
+
+    pending = 0;
+    rc = WaitReady();
+    if( rc == NAND_OK && (ReadStatus()&STATUS_ERROR) != 0 )
+        rc = NAND_ERR_FAIL;
+    Reprotect();
+    return rc;
+}
+
+/**
+ * @brief  Before a new operation, the pending one must end
+ *
+ * @note   Its error is kept to be reported by NAND_Wait
+ */
+static inline void FinishPending(void) {
+int rc;
+
+    rc = CompletePending();
+    if( rc < 0 && lasterror == NAND_OK )
+        lasterror = rc;
+}
+
+/**
+ * @brief  Check and correct data using the ECC
+ *
+ * @note   The ECC is stored in bytes 6 to 8 of the spare area. When they are all ones,
+ *         the page was erased (or written without ECC) and is not checked.
+ */
+static int CheckECC(uint8_t *data, const uint8_t *sp, uint32_t ecc) {
+uint32_t stored;
+uint32_t index;
+
+    stored =  (uint32_t) sp[ECC0_POS]
+            |((uint32_t) sp[ECC1_POS]<<8)
+            |((uint32_t) sp[ECC2_POS]<<16);
+
+    if( stored == ECCMASK )
+        return NAND_OK;
+
+    switch( getECCerror(stored^ecc,&index) ) {
+    case NAND_NOERROR:
+        return NAND_OK;
+    case NAND_ECCERROR:
+        // Error in the stored ECC. Data is OK
+        return NAND_ECC_CORRECTED;
+    case NAND_ONEERROR:
+        if( (index>>3) >= NAND_PAGESIZE )
+            return NAND_ERR_ECC;
+        data[index>>3] ^= BIT(index&7);
+        return NAND_ECC_CORRECTED;
+    default:
+        return NAND_ERR_ECC;
+    }
+}
+
+/**
+ * @brief  Read page data and spare area
+ */
+static int ReadPage(uint32_t addr, uint8_t *data, uint8_t *sp) {
+uint32_t ecc;
+int rc;
+int i;
+
+    if( addr >= NAND_CAPACITY || data == 0 )
+        return NAND_ERR_PARAM;
+
+    FinishPending();
+
+    nandready = 0;
+    NAND_COMMAND = CMD_READ_A;
+    SendPageAddress(addr);
+    if( WaitReady() < 0 )
+        return NAND_ERR_TIMEOUT;
+
+    // Areas A, B and C are read sequentially
+    StartECC();
+    rc = ReadData(data,NAND_PAGESIZE);
+    ecc = StopECC();
+    if( rc < 0 )
+        return rc;
+    for(i=0;i<NAND_SPARESIZE;i++)
+        sp[i] = NAND_DATA;
+
+    return CheckECC(data,sp,ecc);
+}
+
+/**
+ * @brief  Transfer data and spare area to the device and start programming
+ *
+ * @note   The bad block flag is always written as 0xFF. The ECC is inserted in the
+ *         spare area.
+ */
+static int ProgramPage(uint32_t addr, const uint8_t *data, const uint8_t *sp) {
+uint8_t oob[NAND_SPARESIZE];
+uint32_t ecc;
+int rc;
+int i;
+
+    if( addr >= NAND_CAPACITY || data == 0 )
+        return NAND_ERR_PARAM;
+
+    FinishPending();
+
+    for(i=0;i<NAND_SPARESIZE;i++)
+        oob[i] = sp ? sp[i] : OKVALUE;
+    oob[BADBLOCKFLAG] = OKVALUE;
+
+    Unprotect();
+    NAND_COMMAND = CMD_READ_A;
+    NAND_COMMAND = CMD_PROGRAM_1;
+    SendPageAddress(addr);
+
+    StartECC();
+    rc = WriteData(data,NAND_PAGESIZE);
+    ecc = StopECC();
+    if( rc < 0 ) {
+        // Abort programming
+        nandready = 0;
+        NAND_COMMAND = CMD_RESET;
+        (void) WaitReady();
+        Reprotect();
+        return rc;
+    }
+
+    oob[ECC0_POS] = (uint8_t) ecc;
+    oob[ECC1_POS] = (uint8_t) (ecc>>8);
+    oob[ECC2_POS] = (uint8_t) (ecc>>16);
+    for(i=0;i<NAND_SPARESIZE;i++)
+        NAND_DATA = oob[i];
+
+    nandready = 0;
+    NAND_COMMAND = CMD_PROGRAM_2;
+    pending = 1;
+
+    return NAND_OK;
+}
+
+/**
+ * @brief  Start a block erase
+ */
+static int StartErase(uint32_t addr) {
+
+    if( addr >= NAND_CAPACITY )
+        return NAND_ERR_PARAM;
+
+    FinishPending();
+
+    Unprotect();
+    nandready = 0;
+    NAND_COMMAND = CMD_BLOCK_ERASE_1;
+    SendBlockAddress(addr);
+    NAND_COMMAND = CMD_BLOCK_ERASE_2;
+    pending = 1;
+
+    return NAND_OK;
+}
+
+/**
+ * @brief   Copy back program
+ *
+ * @note    Copy from one page to another (528 bytes) without external access
+ *
+ *          1. Send the READ_A command (0x00) and the source address. The device copies
+ *             the page to the page buffer.
+ *          2. Wait until the device is ready (R/B high)
+ *          3. Send the COPY_BACK command (0x8A), the destination address and the
+ *             confirm command (0x10)
+ *          4. The result is read from the status register (CompletePending)
+ *
+ * @note    Source and destination must be in the same plane (same address bit)
+ *
+ *          | Density   |   Same address bit   |
+ *          |-----------|----------------------|
+ *          |  128 Mbit |       A23            |
+ *          |  256 Mbit |       A24            |
+ *          |  512 Mbit |       A25            |
+ *          |    1 Gbit |       A25,A26        |
+ *
+ * @note    The ECC is copied with the data, but a bit error in the source is copied
+ *          too. With verify, the page is also read out of the page buffer with the EBI
+ *          computing the ECC. If an error was corrected, the corrected data is
+ *          programmed instead (as for pages in different planes).
+ */
+static int Copyback(uint32_t src, uint32_t dst, int verify) {
+uint8_t sp[NAND_SPARESIZE];
+int sameplane;
+int rc;
+int rc2;
+
+    if( src >= NAND_CAPACITY || dst >= NAND_CAPACITY )
+        return NAND_ERR_PARAM;
+
+    sameplane = NAND_SAMEPLANE(src,dst);
+    if( verify || !sameplane ) {
+        rc = ReadPage(src,(uint8_t *) copybuffer,sp);
+        if( rc < 0 )
+            return rc;
+        if( rc == NAND_ECC_CORRECTED || !sameplane ) {
+            rc2 = ProgramPage(dst,(uint8_t *) copybuffer,sp);
+            return rc2 < 0 ? rc2 : rc;
+        }
+    } else {
+        FinishPending();
+        nandready = 0;
+        NAND_COMMAND = CMD_COPY_BACK_1;
+        SendPageAddress(src);
+        if( WaitReady() < 0 )
+            return NAND_ERR_TIMEOUT;
+    }
+
+    Unprotect();
+    NAND_COMMAND = CMD_COPY_BACK_2;
+    SendPageAddress(dst);
+    nandready = 0;
+    NAND_COMMAND = CMD_COPY_BACK_3;
+    pending = 1;
+
+    return NAND_OK;
+}
+
 /**
  * @brief  Initialize NAND device including EBI
  *
+ * @note   The device is reset and its signature checked
+ *
  * @return 0 if OK, negative in case of error
  */
 
 int NAND_Init(void) {
+uint8_t mfg,dev;
 
     EnableEBIClock();
 
@@ -453,127 +841,303 @@ int NAND_Init(void) {
     EnableNANDPower();
     EnableNANDDevice();
 
+    GPIO_SetIRQ(RB_GPIO,RB_PIN,GPIO_IRQ_SENSE_RISING,ReadyCallback);
+
+    if( NAND_DMACHANNEL >= 0 && (DMA->STATUS&DMA_STATUS_EN) == 0 )
+        DMA_Init(0);
+
+    pending   = 0;
+    lasterror = NAND_OK;
+
+    nandready = 0;
+    NAND_COMMAND = CMD_RESET;
+    if( WaitReady() < 0 )
+        return NAND_ERR_TIMEOUT;
+
+    NAND_ReadSignature(&mfg,&dev);
+    if( mfg != MFG_CODE || dev != DEV_CODE )
+        return NAND_ERR_DEVICE;
+
     return 0;
 
 }
 
 
 /**
- * @/**
-  * @brief   NAND_ReadPage
+ * @brief   Read electronic signature
+ */
+int NAND_ReadSignature(uint8_t *mfg, uint8_t *dev) {
+
+    FinishPending();
+
+    NAND_COMMAND = CMD_READ_SIGNATURE;
+    NAND_ADDRESS = 0;
+    *mfg = NAND_DATA;
+    *dev = NAND_DATA;
+
+    return 0;
+}
+
+
+/**
+  * @brief   NAND_WritePage
   *
   * @note    Write a page (512 bytes) into NAND device starting at given page address
+  *
+  * @note    pageaddr is a byte address (see NAND_PAGEADDRMASK). The spare area is
+  *          written with the ECC and the other bytes set to 0xFF.
   */
-int NAND_WritePage(uint32_t pageaddr, uint8_t *data) {
+int NAND_WritePage(uint32_t pageaddr, const uint8_t *data) {
 
-    DisableWriteProtect();
-    EnableWriteProtect();
+    return NAND_WritePageSpare(pageaddr,data,0);
+}
 
-    return 0;
+/**
+ * @brief   Write a page and its spare area
+ *
+ * @note    The ECC (bytes 6 to 8) and the bad block flag (byte 5) in spare are ignored.
+ *          spare can be null.
+ */
+int NAND_WritePageSpare(uint32_t pageaddr, const uint8_t *data, const uint8_t *sp) {
+int rc;
+
+    rc = ProgramPage(pageaddr,data,sp);
+    if( rc < 0 )
+        return rc;
+    return CompletePending();
+}
+
+/**
+ * @brief   Start writing a page and its spare area
+ *
+ * @note    It returns when the data has been transferred to the device. The buffers can
+ *          be reused. The result is returned by NAND_Wait.
+ */
+int NAND_WritePageStart(uint32_t pageaddr, const uint8_t *data, const uint8_t *sp) {
+
+    return ProgramPage(pageaddr,data,sp);
 }
 
 
 /**
- * @/**
   * @brief   NAND_ReadPage
   *
-  * @note    Read a page (512 bytes from NAND device
+  * @note    Read a page (512 bytes) from NAND device
+  *
+  * @return  NAND_OK, NAND_ECC_CORRECTED (single bit error corrected) or a negative
+  *          value (NAND_ERR_ECC for uncorrectable errors)
   */
 int NAND_ReadPage(uint32_t pageaddr, uint8_t *data) {
 
-
-    return 0;
+    return ReadPage(pageaddr,data,spare);
 }
 
-
 /**
- * @brief  YAFFS Hardware Interface
+ * @brief   Read a page and its spare area (16 bytes)
  */
+int NAND_ReadPageSpare(uint32_t pageaddr, uint8_t *data, uint8_t *sp) {
+
+    return ReadPage(pageaddr,data,sp ? sp : spare);
+}
 
 
 /**
- * @brief  Write a chunk into flash
+ * @brief   Read only the spare area (Area C) of a page
  *
- * @note   This function writes the specified chunk data and oob/spare data to flash.
- *         This function should return YAFFS_OK on success or YAFFS_FAIL on failure.
- *         If this is a Yaffs2 device, or Yaffs1 with use_nand_ecc set, then this function
- *         must take care of any ECC that is required.
+ * @note    There is no ECC for the spare area
  */
-int DRIVE_write_chunk(struct yaffs_dev *dev, int nand_chunk,
-            const u8 *data, int data_len,
-            const u8 *oob, int oob_len) {
+int NAND_ReadSpare(uint32_t pageaddr, uint8_t *sp) {
+int i;
+
+    if( pageaddr >= NAND_CAPACITY )
+        return NAND_ERR_PARAM;
+
+    FinishPending();
+
+    nandready = 0;
+    NAND_COMMAND = CMD_READ_C;
+    SendPageAddress(pageaddr);
+    if( WaitReady() < 0 )
+        return NAND_ERR_TIMEOUT;
+
+    for(i=0;i<NAND_SPARESIZE;i++)
+        sp[i] = NAND_DATA;
 
-    return YAFFS_OK;
+    return NAND_OK;
 }
 
 /**
- *  @brief  Read function
+ * @brief   Program only the spare area of a page
  *
- *  @note  This function reads the specified chunk data and oob/spare data from flash.
- *         This function should return YAFFS_OK on success or YAFFS_FAIL on failure.
- *         If this is a Yaffs2 device, or Yaffs1 with use_nand_ecc set, then this function
- *         must take care of any ECC that is required and set the ecc_result.
+ * @note    It is a partial page program (at most three for each page between erases)
  */
-int DRIVE_read_chunk(struct yaffs_dev *dev, int nand_chunk,
-            u8 *data, int data_len,
-            u8 *oob, int oob_len,
-            enum yaffs_ecc_result *ecc_result) {
+int NAND_WriteSpare(uint32_t pageaddr, const uint8_t *sp) {
+int i;
 
-    return YAFFS_OK;
+    if( pageaddr >= NAND_CAPACITY )
+        return NAND_ERR_PARAM;
+
+    FinishPending();
+
+    Unprotect();
+    NAND_COMMAND = CMD_READ_C;
+    NAND_COMMAND = CMD_PROGRAM_1;
+    SendPageAddress(pageaddr);
+    for(i=0;i<NAND_SPARESIZE;i++)
+        NAND_DATA = sp[i];
+    nandready = 0;
+    NAND_COMMAND = CMD_PROGRAM_2;
+    pending = 1;
+
+    return CompletePending();
 }
 
 
 /**
- *  @brief  Erase function
+ * @brief   Move a page inside the device (copy back program)
+ *
+ * @note    Used to relocate live pages during garbage collection. The data only crosses
+ *          the EBI when verify is set (ECC check of the source) or when the pages are in
+ *          different planes (see NAND_SAMEPLANE). The spare area is copied.
  *
- *  @note   This function erases the specified block. This function should return YAFFS_OK
- *          on success or AFFS_FAIL on failure.
+ * @return  NAND_OK, NAND_ECC_CORRECTED (corrected data was programmed) or a negative
+ *          value. With NAND_ERR_ECC nothing is programmed.
  */
-int DRIVE_erase(struct yaffs_dev *dev, int block_no) {
+int NAND_CopyPage(uint32_t srcaddr, uint32_t dstaddr, int verify) {
+int rc;
+int rc2;
+
+    rc = Copyback(srcaddr,dstaddr,verify);
+    if( rc < 0 )
+        return rc;
+    rc2 = CompletePending();
+    return rc2 < 0 ? rc2 : rc;
+}
 
-    return YAFFS_OK;
+/**
+ * @brief   Start moving a page inside the device
+ *
+ * @note    The result of the program is returned by NAND_Wait
+ */
+int NAND_CopyPageStart(uint32_t srcaddr, uint32_t dstaddr, int verify) {
+
+    return Copyback(srcaddr,dstaddr,verify);
 }
 
 
 /**
- *  @brief  Mark a bad block
+ * @brief   Erase the block containing blockaddr (byte address)
+ */
+int NAND_EraseBlock(uint32_t blockaddr) {
+int rc;
+
+    rc = StartErase(blockaddr);
+    if( rc < 0 )
+        return rc;
+    return CompletePending();
+}
+
+/**
+ * @brief   Start erasing a block
  *
- *  @note   This function is only required for Yaffs2 mode. It marks a block bad.
+ * @note    The result is returned by NAND_Wait. The next operation waits for its end.
  */
-int DRIVE_mark_bad(struct yaffs_dev *dev, int block_no) {
+int NAND_EraseBlockStart(uint32_t blockaddr) {
 
-    return YAFFS_OK;
+    return StartErase(blockaddr);
 }
 
 
 /**
- *  @brief  Check is a sector is a a bad block
+ * @brief   Wait for the end of the started program or erase
  *
- *  @note   This function is only required for Yaffs2 mode. It check if it is bad.block.
+ * @return  NAND_OK or the error of an operation started by NAND_WritePageStart or
+ *          NAND_EraseBlockStart
  */
-int DRIVE_check_bad(struct yaffs_dev *dev, int block_no) {
+int NAND_Wait(void) {
+int rc;
+
+    rc = CompletePending();
+    if( rc == NAND_OK )
+        rc = lasterror;
+    lasterror = NAND_OK;
+    return rc;
+}
 
-    return YAFFS_OK;
+/**
+ * @brief   Return 1 while a program or erase is running
+ */
+int NAND_Busy(void) {
+
+    return pending && !nandready;
 }
 
 
 /**
- *  @brief  Initialization
+ * @brief   Check the factory bad block flag
+ *
+ * @note    The flag is in byte 5 of the spare area of the first or the second page
  *
- *  @note   This function provides hooks for initialising the flash driver
+ * @return  1 if bad, 0 if good, negative for error
  */
-int DRIVE_initialise(struct yaffs_dev *dev) {
+int NAND_IsBadBlock(uint32_t blockaddr) {
+uint8_t sp[NAND_SPARESIZE];
+uint32_t a;
+int rc;
+int i;
+
+    a = blockaddr&~(NAND_BLOCKSIZE-1);
+    for(i=0;i<2;i++) {
+        rc = NAND_ReadSpare(a+i*NAND_PAGESIZE,sp);
+        if( rc < 0 )
+            return rc;
+        if( sp[BADBLOCKFLAG] != (uint8_t) OKVALUE )
+            return 1;
+    }
+    return 0;
+}
 
-    return YAFFS_OK;
+/**
+ * @brief   Mark a block as bad
+ *
+ * @note    The flag is written in the first two pages. Program errors are ignored.
+ */
+int NAND_MarkBadBlock(uint32_t blockaddr) {
+uint8_t sp[NAND_SPARESIZE];
+uint32_t a;
+int i;
+
+    if( blockaddr >= NAND_CAPACITY )
+        return NAND_ERR_PARAM;
+
+    for(i=0;i<NAND_SPARESIZE;i++)
+        sp[i] = OKVALUE;
+    sp[BADBLOCKFLAG] = 0;
+
+    a = blockaddr&~(NAND_BLOCKSIZE-1);
+    (void) NAND_WriteSpare(a,sp);
+    (void) NAND_WriteSpare(a+NAND_PAGESIZE,sp);
+
+    return NAND_OK;
 }
 
 
 /**
- *  @brief  De-initialization
+ * @brief   Write protection
  *
- *  @note   This function provides hooks for deinitialising the flash driver
+ * @note    When enabled (default), WP# is only released during program and erase
  */
-int DRIVE_deinitialise(struct yaffs_dev *dev) {
+int NAND_EnableWriteProtect(void) {
 
-    return YAFFS_OK;
+    FinishPending();
+    writeprotect = 1;
+    EnableWriteProtect();
+    return 0;
+}
+
+int NAND_DisableWriteProtect(void) {
+
+    writeprotect = 0;
+    DisableWriteProtect();
+    return 0;
 }
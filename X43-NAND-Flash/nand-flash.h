@@ -1,6 +1,8 @@
 #ifndef NAND_FLASH_H
 #define NAND_FLASH_H
 
+#include <stdint.h>
+
 /**
  * @file nand-flash.h
  * @brief Interface routine for the ST NAND256 Flash device in the EFM32GG-STK3700 board
@@ -25,14 +27,61 @@
 #define NAND_BLOCKSIZE                          (32*NAND_PAGESIZE)
 #define NAND_PAGECOUNT                          (NAND_CAPACITY/NAND_PAGESIZE)
 #define NAND_PAGEADDRMASK                       ((NAND_PAGECOUNT-1)<<9)
+#define NAND_BLOCKCOUNT                         (NAND_CAPACITY/NAND_BLOCKSIZE)
+#define NAND_PAGESPERBLOCK                      (NAND_BLOCKSIZE/NAND_PAGESIZE)
 
+/**
+ *  @brief  Planes (copy back only inside a plane: A24 must be the same)
+ */
+#define NAND_PLANEMASK                          (NAND_CAPACITY/2)
+#define NAND_SAMEPLANE(A,B)                     ((((A)^(B))&NAND_PLANEMASK)==0)
 
+/**
+ *  @brief  Spare area layout
+ *
+ *  @note   Byte 5 is the bad block flag (0xFF when good). Bytes 6 to 8 store the ECC
+ *          of the page data. The other bytes are free.
+ */
+#define NAND_SPARE_BADBLOCK                     (5)
+#define NAND_SPARE_ECC                          (6)
 
+/**
+ *  @brief  Return values
+ */
+///@{
+#define NAND_OK                                 (0)
+#define NAND_ECC_CORRECTED                      (1)
+#define NAND_ERR_PARAM                          (-1)
+#define NAND_ERR_TIMEOUT                        (-2)
+#define NAND_ERR_FAIL                           (-3)
+#define NAND_ERR_ECC                            (-4)
+#define NAND_ERR_DEVICE                         (-5)
+///@}
 
-
+/**
+ *  @brief  Addresses are byte addresses. Only the page (or block) bits are used.
+ */
 int NAND_Init(void);
-int NAND_WritePage(uint32_t pageaddr, uint8_t *data);
+int NAND_ReadSignature(uint8_t *mfg, uint8_t *dev);
+
+int NAND_WritePage(uint32_t pageaddr, const uint8_t *data);
 int NAND_ReadPage(uint32_t pageaddr, uint8_t *data);
+int NAND_WritePageSpare(uint32_t pageaddr, const uint8_t *data, const uint8_t *spare);
+int NAND_ReadPageSpare(uint32_t pageaddr, uint8_t *data, uint8_t *spare);
+int NAND_WriteSpare(uint32_t pageaddr, const uint8_t *spare);
+int NAND_ReadSpare(uint32_t pageaddr, uint8_t *spare);
+int NAND_EraseBlock(uint32_t blockaddr);
+
+int NAND_WritePageStart(uint32_t pageaddr, const uint8_t *data, const uint8_t *spare);
+int NAND_EraseBlockStart(uint32_t blockaddr);
+int NAND_Wait(void);
+
+int NAND_CopyPage(uint32_t srcaddr, uint32_t dstaddr, int verify);
+int NAND_CopyPageStart(uint32_t srcaddr, uint32_t dstaddr, int verify);
+int NAND_Busy(void);
+
+int NAND_IsBadBlock(uint32_t blockaddr);
+int NAND_MarkBadBlock(uint32_t blockaddr);
 
 int NAND_EnableWriteProtect(void);
 int NAND_DisableWriteProtect(void);
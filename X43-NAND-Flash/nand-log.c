@@ -0,0 +1,765 @@
+/**
+ * @file nand-log.c
+ * @brief Log-structured record store on the NAND256 device
+ *
+ * @note
+ *      Records are packed in a RAM page buffer. When it is full (or NANDLog_Flush is
+ *      called) it is programmed with NAND_WritePageStart and the other buffer is used.
+ *      A record never crosses a page boundary and has its own CRC16.
+ *
+ * @note
+ *      Page header (free bytes of the spare area): sequence number of the block (bytes
+ *      0-3), number of records (byte 4), time of the first record (bytes 9-12), magic
+ *      (byte 13) and CRC16 (bytes 14-15). The sequence number increases for each new
+ *      block, so after a power loss the newest block (head) and the oldest (tail) are
+ *      found by reading the spare area of the first page of each block.
+ *
+ * @note
+ *      The blocks are used in circular order, skipping bad blocks, so all blocks are
+ *      erased the same number of times. The block to be used after the current one is
+ *      erased in advance (NAND_EraseBlockStart), when the device is idle. So appends do
+ *      not wait for erases, unless pages are written faster than a block is erased.
+ *
+ * @note
+ *      Bad blocks are taken from the bad block table (nand-bbt.c), so NANDLog_Open
+ *      reads only one spare area per block.
+ *
+ * @note
+ *      The time of the first record of each block is kept in RAM (sparse index). A seek
+ *      selects the block from it and the page by a binary search of the page headers.
+ *
+ * @note
+ *      A program error is detected before the next page is programmed. The page is
+ *      written again in a new block and the failed block is marked bad when it is
+ *      reused.
+ *
+ * @note
+ *      Not reentrant. It must not be called from interrupts.
+ *
+ * @version 1.0.0
+ * Date:    7 October 2023
+ *
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "nand-flash.h"
+#include "nand-bbt.h"
+#include "nand-log.h"
+
+#ifndef BIT
+#define BIT(N)  (1U<<(N))
+#endif
+
+/**
+ *  @brief  Addresses and block indexes (relative to NANDLOG_FIRSTBLOCK)
+ */
+///@{
+#define BLOCKADDR(B)                            ((uint32_t) (NANDLOG_FIRSTBLOCK+(B))*NAND_BLOCKSIZE)
+#define PAGEADDR(B,P)                           (BLOCKADDR(B)+(uint32_t) (P)*NAND_PAGESIZE)
+#define NONE                                    (0xFFFFFFFFU)
+///@}
+
+/**
+ *  @brief  Page header in the spare area
+ */
+///@{
+#define HDR_SEQ                                 (0)
+#define HDR_COUNT                               (4)
+#define HDR_TIME                                (9)
+#define HDR_MAGIC                               (13)
+#define HDR_CRC                                 (14)
+#define MAGIC                                   (0x4C)
+///@}
+
+#define CRC_POLY                                (0x1021)
+#define MAXRETRIES                              (4)
+
+/**
+ *  @brief  Operation started and not yet checked
+ */
+///@{
+#define OP_NONE                                 (0)
+#define OP_PROGRAM                              (1)
+#define OP_ERASE                                (2)
+///@}
+
+/**
+ *  @brief  State of the block to be used after head
+ */
+///@{
+#define NEXT_NEEDERASE                          (0)
+#define NEXT_ERASING                            (1)
+#define NEXT_READY                              (2)
+///@}
+
+typedef struct {
+    uint32_t    data[NAND_PAGESIZE/4];
+    uint32_t    time;                               /**< of first record          */
+    uint16_t    used;
+    uint8_t     count;
+} PageBuffer;
+
+static PageBuffer   pagebuf[2];
+static int          fill            = 0;
+static int          inflight        = -1;       // Buffer being programmed
+static uint32_t     inflightblock   = NONE;
+static uint32_t     inflightpage    = 0;
+static int          failedbuf       = -1;       // Buffer to be programmed again
+static uint8_t      lastop          = OP_NONE;
+
+static uint32_t     blocktime[NANDLOG_BLOCKS];
+static uint8_t      badmap[(NANDLOG_BLOCKS+7)/8];
+static uint8_t      retiremap[(NANDLOG_BLOCKS+7)/8];
+
+static uint32_t     head            = NONE;     // Block being written
+static uint32_t     headpage        = 0;        // Next page to be programmed
+static uint32_t     tail            = NONE;     // Oldest block
+static uint32_t     next            = NONE;     // Block to be used after head
+static uint8_t      nextstate       = NEXT_NEEDERASE;
+static uint32_t     sequence        = 0;
+static uint32_t     lasttime        = 0;
+static NANDLog_InfoType info;
+
+
+static inline int  TestBit(const uint8_t *m, uint32_t b) { return (m[b>>3]&BIT(b&7)) != 0; }
+static inline void SetBit(uint8_t *m, uint32_t b)        { m[b>>3] |= BIT(b&7); }
+static inline void ClearBit(uint8_t *m, uint32_t b)      { m[b>>3] &= ~BIT(b&7); }
+
+static inline void PutWord(uint8_t *p, uint32_t w) {
+
+    p[0] = (uint8_t) w;
+    p[1] = (uint8_t) (w>>8);
+    p[2] = (uint8_t) (w>>16);
+    p[3] = (uint8_t) (w>>24);
+}
+
+static inline uint32_t GetWord(const uint8_t *p) {
+
+    return (uint32_t) p[0]|((uint32_t) p[1]<<8)|((uint32_t) p[2]<<16)|((uint32_t) p[3]<<24);
+}
+
+/**
+ * @brief  CRC16 (CCITT)
+ */
+static uint16_t CRC16(const uint8_t *p, int n) {
+uint16_t crc = 0xFFFF;
+int i;
+
+    while( n-- > 0 ) {
+        crc ^= (uint16_t) (*p++)<<8;
+        for(i=0;i<8;i++) {
+            if( crc&0x8000 )
+                crc = (uint16_t) ((crc<<1)^CRC_POLY);
+            else
+                crc = (uint16_t) (crc<<1);
+        }
+    }
+    return crc;
+}
+
+static int IsErased(const uint8_t *p, int n) {
+
+    while( n-- > 0 ) {
+        if( *p++ != 0xFF )
+            return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief  Page header
+ */
+///@{
+static uint16_t HeaderCRC(const uint8_t *sp) {
+uint8_t h[10];
+
+    memcpy(h,sp+HDR_SEQ,5);
+    memcpy(h+5,sp+HDR_TIME,5);
+    return CRC16(h,10);
+}
+
+static void MakeHeader(uint8_t *sp, uint32_t seq, uint8_t count, uint32_t time) {
+uint16_t crc;
+
+    memset(sp,0xFF,NAND_SPARESIZE);
+    PutWord(sp+HDR_SEQ,seq);
+    sp[HDR_COUNT] = count;
+    PutWord(sp+HDR_TIME,time);
+    sp[HDR_MAGIC] = MAGIC;
+    crc = HeaderCRC(sp);
+    sp[HDR_CRC]   = (uint8_t) crc;
+    sp[HDR_CRC+1] = (uint8_t) (crc>>8);
+}
+
+static int GetHeader(const uint8_t *sp, uint32_t *seq, uint32_t *time) {
+
+    if( sp[HDR_MAGIC] != MAGIC )
+        return 0;
+    if( HeaderCRC(sp) != (uint16_t) (sp[HDR_CRC]|(sp[HDR_CRC+1]<<8)) )
+        return 0;
+    *seq  = GetWord(sp+HDR_SEQ);
+    *time = GetWord(sp+HDR_TIME);
+    return 1;
+}
+///@}
+
+static void ClearBuffer(PageBuffer *pb) {
+
+    memset(pb->data,0xFF,NAND_PAGESIZE);
+    pb->used  = 0;
+    pb->count = 0;
+    pb->time  = 0;
+}
+
+/**
+ * @brief  Next good block in circular order
+ */
+static uint32_t NextGood(uint32_t b) {
+uint32_t i;
+
+    if( b == NONE )
+        b = NANDLOG_BLOCKS-1;
+    for(i=0;i<NANDLOG_BLOCKS;i++) {
+        b = (b+1)%NANDLOG_BLOCKS;
+        if( !TestBit(badmap,b) )
+            return b;
+    }
+    return NONE;
+}
+
+static void RetireBlock(uint32_t b) {
+
+    (void) NANDBBT_MarkBad(NANDLOG_FIRSTBLOCK+b);
+    SetBit(badmap,b);
+    ClearBit(retiremap,b);
+    info.badblocks++;
+}
+
+/**
+ * @brief  Select the block to be used after head
+ *
+ * @note   When it is the oldest block, it leaves the log now, before being erased
+ */
+static int ChooseNext(void) {
+
+    for(;;) {
+        next = NextGood(head);
+        if( next == NONE || next == head ) {
+            next = NONE;
+            return NANDLOG_ERR_NOSPACE;
+        }
+        if( next == tail )
+            tail = NextGood(tail);
+        if( !TestBit(retiremap,next) )
+            break;
+        RetireBlock(next);
+    }
+    nextstate = NEXT_NEEDERASE;
+    return NAND_OK;
+}
+
+/**
+ * @brief  Clear the magic of a page that failed, so readers skip it
+ */
+static void InvalidatePage(uint32_t b, uint32_t p) {
+uint8_t sp[NAND_SPARESIZE];
+
+    memset(sp,0xFF,NAND_SPARESIZE);
+    sp[HDR_MAGIC] = 0;
+    (void) NAND_WriteSpare(PAGEADDR(b,p),sp);
+}
+
+/**
+ * @brief  Check the result of the last started operation
+ */
+static int Collect(void) {
+int rc;
+
+    if( lastop == OP_NONE )
+        return NAND_OK;
+
+    rc = NAND_Wait();
+    if( lastop == OP_PROGRAM ) {
+        if( rc < 0 ) {
+            info.programerrors++;
+            InvalidatePage(inflightblock,inflightpage);
+            SetBit(retiremap,inflightblock);
+            failedbuf = inflight;
+            if( inflightblock == head )
+                headpage = NAND_PAGESPERBLOCK;
+        }
+        inflight = -1;
+    } else {
+        if( rc < 0 ) {
+            RetireBlock(next);
+            (void) ChooseNext();
+        } else {
+            nextstate = NEXT_READY;
+        }
+    }
+    lastop = OP_NONE;
+    return rc;
+}
+
+static void StartErase(void) {
+
+    if( NAND_EraseBlockStart(BLOCKADDR(next)) < 0 ) {
+        RetireBlock(next);
+        (void) ChooseNext();
+        return;
+    }
+    lastop = OP_ERASE;
+    nextstate = NEXT_ERASING;
+}
+
+/**
+ * @brief  Move head to the next block
+ *
+ * @note   It only waits when the next block is not erased yet
+ */
+static int NewBlock(void) {
+int stalled = 0;
+int tries = 0;
+int rc;
+
+    if( next == NONE ) {
+        rc = ChooseNext();
+        if( rc < 0 )
+            return rc;
+    }
+    while( nextstate != NEXT_READY ) {
+        if( next == NONE || ++tries > MAXRETRIES*2 )
+            return NANDLOG_ERR_NOSPACE;
+        stalled = 1;
+        if( lastop == OP_NONE && nextstate == NEXT_NEEDERASE )
+            StartErase();
+        (void) Collect();
+    }
+    if( stalled )
+        info.stalls++;
+
+    head     = next;
+    headpage = 0;
+    sequence++;
+    if( tail == NONE )
+        tail = head;
+    (void) ChooseNext();
+
+    return NAND_OK;
+}
+
+/**
+ * @brief  Start programming a buffer in the next page
+ */
+static int ProgramBuffer(int b) {
+PageBuffer *pb = &pagebuf[b];
+uint8_t sp[NAND_SPARESIZE];
+int rc;
+
+    if( head == NONE || headpage >= NAND_PAGESPERBLOCK ) {
+        rc = NewBlock();
+        if( rc < 0 )
+            return rc;
+    }
+    if( headpage == 0 )
+        blocktime[head] = pb->time;
+
+    MakeHeader(sp,sequence,pb->count,pb->time);
+    rc = NAND_WritePageStart(PAGEADDR(head,headpage),(uint8_t *) pb->data,sp);
+    if( rc < 0 )
+        return rc;
+
+    lastop        = OP_PROGRAM;
+    inflight      = b;
+    inflightblock = head;
+    inflightpage  = headpage;
+    headpage++;
+    return NAND_OK;
+}
+
+/**
+ * @brief  Program a buffer, after writing again the previous one if it failed
+ */
+static int FlushBuffer(int b) {
+int tries = 0;
+int rc;
+int f;
+
+    if( lastop != OP_NONE && NAND_Busy() )
+        info.stalls++;
+    (void) Collect();
+
+    while( failedbuf >= 0 ) {
+        f = failedbuf;
+        failedbuf = -1;
+        if( ++tries > MAXRETRIES )
+            return NAND_ERR_FAIL;
+        rc = ProgramBuffer(f);
+        if( rc < 0 )
+            return rc;
+        (void) Collect();
+    }
+    return ProgramBuffer(b);
+}
+
+static void ResetState(void) {
+
+    ClearBuffer(&pagebuf[0]);
+    ClearBuffer(&pagebuf[1]);
+    fill          = 0;
+    inflight      = -1;
+    inflightblock = NONE;
+    inflightpage  = 0;
+    failedbuf     = -1;
+    lastop        = OP_NONE;
+    head          = NONE;
+    headpage      = 0;
+    tail          = NONE;
+    next          = NONE;
+    nextstate     = NEXT_NEEDERASE;
+    sequence      = 0;
+    lasttime      = 0;
+    memset(badmap,0,sizeof(badmap));
+    memset(retiremap,0,sizeof(retiremap));
+    memset(&info,0,sizeof(info));
+}
+
+
+/**
+ * @brief  Find the log after a reset or power loss
+ *
+ * @note   It reads the first page header of each block to find the newest and the
+ *         oldest blocks, then the first free page of the newest block. A page that was
+ *         being programmed at the power loss is skipped.
+ *
+ * @note   NAND_Init must be called before
+ */
+int NANDLog_Open(void) {
+uint8_t sp[NAND_SPARESIZE];
+uint8_t *data = (uint8_t *) pagebuf[0].data;
+uint32_t seq,t,minseq = NONE,maxseq = 0;
+uint32_t b,p,last;
+uint8_t *r;
+int rc;
+
+    ResetState();
+
+    for(b=0;b<NANDLOG_BLOCKS;b++) {
+        blocktime[b] = NONE;
+        rc = NANDBBT_IsBad(NANDLOG_FIRSTBLOCK+b);
+        if( rc != 0 ) {
+            SetBit(badmap,b);
+            info.badblocks++;
+            continue;
+        }
+        if( NAND_ReadSpare(BLOCKADDR(b),sp) < 0 || !GetHeader(sp,&seq,&t) )
+            continue;
+        blocktime[b] = t;
+        if( head == NONE || seq > maxseq ) {
+            maxseq = seq;
+            head = b;
+        }
+        if( seq < minseq ) {
+            minseq = seq;
+            tail = b;
+        }
+    }
+
+    if( head == NONE )
+        return ChooseNext();
+
+    sequence = maxseq;
+    last = 0;
+    for(p=1;p<NAND_PAGESPERBLOCK;p++) {
+        if( NAND_ReadSpare(PAGEADDR(head,p),sp) < 0 )
+            break;
+        if( GetHeader(sp,&seq,&t) ) {
+            last = p;
+            continue;
+        }
+        if( !IsErased(sp,NAND_SPARESIZE) )
+            continue;
+        // Spare area erased: check that the data was not partially programmed
+        if( NAND_ReadPage(PAGEADDR(head,p),data) == NAND_OK && IsErased(data,NAND_PAGESIZE) )
+            break;
+    }
+    headpage = p;
+
+    // Time of the newest record
+    lasttime = blocktime[head];
+    if( NAND_ReadPage(PAGEADDR(head,last),data) >= 0 ) {
+        for(r=data;r+NANDLOG_OVERHEAD<=data+NAND_PAGESIZE;r+=r[0]+NANDLOG_OVERHEAD) {
+            if( r[0] == 0 || r[0] > NANDLOG_MAXDATA
+                || r+r[0]+NANDLOG_OVERHEAD > data+NAND_PAGESIZE
+                || CRC16(r,r[0]+5) != (uint16_t) (r[r[0]+5]|(r[r[0]+6]<<8)) )
+                break;
+            lasttime = GetWord(r+1);
+        }
+    }
+    ClearBuffer(&pagebuf[0]);
+
+    return ChooseNext();
+}
+
+/**
+ * @brief  Erase all blocks of the log
+ *
+ * @note   Blocks that fail to erase are marked bad
+ */
+int NANDLog_Format(void) {
+uint32_t b;
+
+    ResetState();
+
+    for(b=0;b<NANDLOG_BLOCKS;b++) {
+        blocktime[b] = NONE;
+        if( NANDBBT_IsBad(NANDLOG_FIRSTBLOCK+b) != 0 ) {
+            SetBit(badmap,b);
+            info.badblocks++;
+        } else if( NAND_EraseBlock(BLOCKADDR(b)) < 0 ) {
+            RetireBlock(b);
+        }
+    }
+    if( ChooseNext() < 0 )
+        return NANDLOG_ERR_NOSPACE;
+    nextstate = NEXT_READY;
+    return NAND_OK;
+}
+
+/**
+ * @brief  Append a record
+ *
+ * @note   The record is copied into the page buffer. A page is programmed when the
+ *         buffer is full. The time must not be less than the one of the last record.
+ *
+ * @return NAND_OK or a negative value if the page could not be written
+ */
+int NANDLog_Append(uint32_t time, const void *data, int len) {
+PageBuffer *pb;
+uint16_t crc;
+uint8_t *p;
+int rc = NAND_OK;
+
+    if( data == 0 || len <= 0 || len > NANDLOG_MAXDATA || time < lasttime )
+        return NAND_ERR_PARAM;
+
+    pb = &pagebuf[fill];
+    if( pb->used+len+NANDLOG_OVERHEAD > NAND_PAGESIZE ) {
+        rc = NANDLog_Flush();
+        pb = &pagebuf[fill];
+    }
+
+    if( pb->count == 0 )
+        pb->time = time;
+    p = (uint8_t *) pb->data+pb->used;
+    p[0] = (uint8_t) len;
+    PutWord(p+1,time);
+    memcpy(p+5,data,len);
+    crc = CRC16(p,len+5);
+    p[len+5] = (uint8_t) crc;
+    p[len+6] = (uint8_t) (crc>>8);
+    pb->used += len+NANDLOG_OVERHEAD;
+    pb->count++;
+    lasttime = time;
+
+    NANDLog_Poll();
+
+    return rc;
+}
+
+/**
+ * @brief  Program the page buffer, even if not full
+ *
+ * @note   The rest of the page is not used
+ */
+int NANDLog_Flush(void) {
+int rc;
+
+    if( pagebuf[fill].count == 0 )
+        return NAND_OK;
+
+    rc = FlushBuffer(fill);
+    fill ^= 1;
+    ClearBuffer(&pagebuf[fill]);
+    failedbuf = -1;
+    return rc;
+}
+
+/**
+ * @brief  Check the end of the started operation and erase the next block
+ *
+ * @note   Called by NANDLog_Append. It never waits.
+ */
+void NANDLog_Poll(void) {
+
+    if( lastop != OP_NONE ) {
+        if( NAND_Busy() )
+            return;
+        (void) Collect();
+    }
+    if( next != NONE && nextstate == NEXT_NEEDERASE )
+        StartErase();
+}
+
+/**
+ * @brief  Get the record at the cursor
+ *
+ * @return 1 if there is one, 0 at the end of the log or negative in case of error
+ */
+static int Peek(NANDLog_CursorType *c, uint32_t *time, uint8_t **pdata, int *plen) {
+uint8_t sp[NAND_SPARESIZE];
+uint32_t seq,t;
+uint8_t *p;
+int len;
+int rc;
+
+    if( head == NONE )
+        return 0;
+
+    for(;;) {
+        if( !c->loaded ) {
+            if( c->block == head && c->page >= headpage )
+                return 0;
+            if( c->page >= NAND_PAGESPERBLOCK ) {
+                c->block = NextGood(c->block);
+                c->page  = 0;
+                continue;
+            }
+            rc = NAND_ReadPageSpare(PAGEADDR(c->block,c->page),(uint8_t *) c->data,sp);
+            if( rc < 0 && rc != NAND_ERR_ECC )
+                return rc;
+            if( !GetHeader(sp,&seq,&t) ) {
+                // Erased: the block was left early. Otherwise a torn page
+                if( IsErased(sp,NAND_SPARESIZE) && c->block != head )
+                    c->page = NAND_PAGESPERBLOCK;
+                else
+                    c->page++;
+                continue;
+            }
+            c->loaded = 1;
+            c->offset = 0;
+        }
+
+        p = (uint8_t *) c->data+c->offset;
+        len = p[0];
+        if( c->offset+NANDLOG_OVERHEAD > NAND_PAGESIZE || len == 0 || len > NANDLOG_MAXDATA
+            || c->offset+len+NANDLOG_OVERHEAD > NAND_PAGESIZE ) {
+            c->loaded = 0;
+            c->page++;
+            continue;
+        }
+        if( CRC16(p,len+5) != (uint16_t) (p[len+5]|(p[len+6]<<8)) ) {
+            // The length can be wrong, so the rest of the page is skipped
+            info.crcerrors++;
+            c->loaded = 0;
+            c->page++;
+            continue;
+        }
+        *time  = GetWord(p+1);
+        *pdata = p+5;
+        *plen  = len;
+        return 1;
+    }
+}
+
+/**
+ * @brief  Position the cursor at the first record with a time not less than time
+ *
+ * @note   Only the block index in RAM and a few page headers are used to find the page
+ */
+int NANDLog_Seek(NANDLog_CursorType *c, uint32_t time) {
+uint8_t sp[NAND_SPARESIZE];
+uint32_t b,start,seq,t;
+uint8_t *p;
+int lo,hi,mid,page;
+int len;
+int rc;
+
+    c->loaded = 0;
+    c->offset = 0;
+    c->page   = 0;
+    c->block  = tail;
+    if( head == NONE )
+        return NAND_OK;
+
+    // Last block whose first record is not after time
+    start = tail;
+    for(b=tail;;b=NextGood(b)) {
+        if( blocktime[b] != NONE && blocktime[b] <= time )
+            start = b;
+        else if( blocktime[b] != NONE )
+            break;
+        if( b == head )
+            break;
+    }
+
+    // Last page whose first record is not after time
+    lo = 0;
+    hi = (start == head ? (int) headpage : NAND_PAGESPERBLOCK)-1;
+    page = 0;
+    while( lo <= hi ) {
+        mid = (lo+hi)/2;
+        rc = NAND_ReadSpare(PAGEADDR(start,mid),sp);
+        if( rc < 0 )
+            return rc;
+        if( GetHeader(sp,&seq,&t) && t <= time ) {
+            page = mid;
+            lo = mid+1;
+        } else {
+            hi = mid-1;
+        }
+    }
+    c->block = start;
+    c->page  = (uint16_t) page;
+
+    while( (rc = Peek(c,&t,&p,&len)) > 0 && t < time )
+        c->offset += len+NANDLOG_OVERHEAD;
+
+    return rc < 0 ? rc : NAND_OK;
+}
+
+/**
+ * @brief  Read the record at the cursor and advance it
+ *
+ * @note   Only programmed pages are read (see NANDLog_Flush). Records with a CRC error
+ *         are skipped. The cursor must not be in blocks already reused.
+ *
+ * @return Length of data, 0 at the end of the log or negative in case of error
+ */
+int NANDLog_Read(NANDLog_CursorType *c, uint32_t *time, void *data, int max) {
+uint8_t *p;
+uint32_t t;
+int len;
+int rc;
+
+    rc = Peek(c,&t,&p,&len);
+    if( rc <= 0 )
+        return rc;
+    if( len > max )
+        return NAND_ERR_PARAM;
+
+    memcpy(data,p,len);
+    *time = t;
+    c->offset += len+NANDLOG_OVERHEAD;
+    return len;
+}
+
+void NANDLog_GetInfo(NANDLog_InfoType *inf) {
+uint32_t b;
+
+    *inf = info;
+    inf->sequence = sequence;
+    inf->last     = lasttime;
+    inf->first    = 0;
+    inf->blocks   = 0;
+    if( tail == NONE )
+        return;
+
+    inf->first = blocktime[tail];
+    for(b=tail;;b=NextGood(b)) {
+        inf->blocks++;
+        if( b == head || b == NONE )
+            break;
+    }
+}
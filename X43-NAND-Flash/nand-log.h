@@ -0,0 +1,81 @@
+#ifndef NAND_LOG_H
+#define NAND_LOG_H
+
+/**
+ * @file nand-log.h
+ * @brief Log-structured record store on the NAND256 device (e.g. for sensor samples)
+ *
+ * @note
+ *      Records (time stamp and up to NANDLOG_MAXDATA bytes) are appended to pages.
+ *      The blocks are used in circular order. When all are used, the oldest one is
+ *      erased. Time stamps must not decrease.
+ *
+ * @version 1.0.0
+ * Date:    7 October 2023
+ *
+ */
+
+#include <stdint.h>
+#include "nand-flash.h"
+
+/**
+ *  @brief  Blocks used by the log (upper half of the device)
+ */
+///@{
+#define NANDLOG_FIRSTBLOCK                      (NAND_BLOCKCOUNT/2)
+#define NANDLOG_LASTBLOCK                       (NAND_BLOCKCOUNT-1)
+#define NANDLOG_BLOCKS                          (NANDLOG_LASTBLOCK-NANDLOG_FIRSTBLOCK+1)
+///@}
+
+/**
+ *  @brief  Record format: length (1 byte), time (4 bytes), data and CRC16 (2 bytes)
+ */
+///@{
+#define NANDLOG_OVERHEAD                        (7)
+#define NANDLOG_MAXDATA                         (250)
+///@}
+
+/**
+ *  @brief  Return values (besides the NAND_* ones)
+ */
+#define NANDLOG_ERR_NOSPACE                     (-10)
+
+/**
+ *  @brief  Information about the log
+ */
+typedef struct {
+    uint32_t    first;                              /**< time of oldest record    */
+    uint32_t    last;                               /**< time of newest record    */
+    uint32_t    blocks;                             /**< blocks in use            */
+    uint32_t    badblocks;
+    uint32_t    sequence;                           /**< of the newest block      */
+    uint32_t    stalls;                             /**< erases waited for        */
+    uint32_t    programerrors;
+    uint32_t    crcerrors;                          /**< records skipped by reads */
+} NANDLog_InfoType;
+
+/**
+ *  @brief  Read position
+ *
+ *  @note   Allocated by the caller. It contains a page buffer
+ */
+typedef struct {
+    uint32_t    data[NAND_PAGESIZE/4];
+    uint32_t    block;                              /**< relative to FIRSTBLOCK   */
+    uint16_t    page;
+    uint16_t    offset;
+    uint8_t     loaded;
+} NANDLog_CursorType;
+
+int  NANDLog_Open(void);
+int  NANDLog_Format(void);
+int  NANDLog_Append(uint32_t time, const void *data, int len);
+int  NANDLog_Flush(void);
+void NANDLog_Poll(void);
+
+int  NANDLog_Seek(NANDLog_CursorType *c, uint32_t time);
+int  NANDLog_Read(NANDLog_CursorType *c, uint32_t *time, void *data, int max);
+
+void NANDLog_GetInfo(NANDLog_InfoType *info);
+
+#endif // NAND_LOG_H
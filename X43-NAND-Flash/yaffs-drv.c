@@ -0,0 +1,587 @@
+/**
+ * @file yaffs-drv.c
+ * @brief YAFFS2 hardware interface for the NAND256 Flash device in the EFM32GG-STK3700 board
+ *
+ * @note
+ *      It is only compiled when USE_YAFFS is defined, i.e., when YAFFSDIR is set in the
+ *      Makefile.
+ *
+ * @note
+ *      A chunk is formed by two consecutive pages. The ECC of each page is generated
+ *      and checked by the NAND driver (nand-flash.c).
+ *
+ * @note
+ *      Tag packing: YAFFS passes 16 bytes of packed tags (no_tags_ecc is set). They are
+ *      protected by a CRC16 and spread over the free bytes of the spare areas of the two
+ *      pages (bytes 0-4 and 9-15). Bytes 5 (bad block flag) and 6-8 (ECC) are not used.
+ *      Since the tags are in the spare area, a mount after a power loss (that cannot use
+ *      the checkpoint) only reads 32 bytes per chunk.
+ *
+ * @note
+ *      Chunk cache: the last chunks written or read are kept in RAM. A write transfers
+ *      the data to the device and returns while the second page is being programmed
+ *      (write-back). Its result is checked before the next access to the device, and
+ *      the chunks of a block are always written in sequence by YAFFS. So, a program
+ *      error is reported in the next write into the same block and YAFFS retires that
+ *      block. Until then, the failed chunk is read from the cache. The last chunk of a
+ *      block is always waited for.
+ *
+ * @version 1.0.0
+ * Date:    7 October 2023
+ *
+ */
+
+#ifdef USE_YAFFS
+
+#include <stdint.h>
+#include <string.h>
+#include "yaffs_guts.h"
+#include "yaffsfs.h"
+#include "nand-flash.h"
+#include "nand-bbt.h"
+#include "yaffs-drv.h"
+
+/**
+ *  @brief  Number of reserved blocks and of YAFFS short op caches
+ *
+ *  @note   YAFFS RAM usage grows with the number of chunks in use (about 2 bytes for
+ *          each chunk) and with the number of caches (YDRV_CHUNKSIZE bytes each)
+ */
+///@{
+#define YDRV_RESERVEDBLOCKS                     (5)
+#define YDRV_YAFFSCACHES                        (4)
+///@}
+
+/**
+ *  @brief  Tag packing
+ *
+ *  @note   Free bytes in the spare area of each page. The tags are followed by its CRC
+ */
+///@{
+static const uint8_t freebytes[] = { 0, 1, 2, 3, 4, 9, 10, 11, 12, 13, 14, 15 };
+#define FREEBYTES                               (sizeof(freebytes))
+#define OOBSIZE                                 (YDRV_TAGSIZE+2)
+#define CRC_POLY                                (0x1021)
+///@}
+
+#if OOBSIZE > YDRV_PAGESPERCHUNK*12             // 12 = FREEBYTES
+#error "Not enough free bytes in the spare area for the tags"
+#endif
+
+/**
+ *  @brief  Cache entry states
+ */
+///@{
+#define ENTRY_FREE                              (0)
+#define ENTRY_CLEAN                             (1)
+#define ENTRY_WRITING                           (2)
+#define ENTRY_FAILED                            (3)
+///@}
+
+/**
+ *  @brief  Cache entry
+ *
+ *  @note   Data is word aligned, so it can be moved by DMA
+ */
+typedef struct {
+    uint32_t    data[YDRV_CHUNKSIZE/4];
+    uint8_t     tags[YDRV_TAGSIZE];
+    int32_t     chunk;
+    uint32_t    stamp;                              /**< for LRU replacement      */
+    uint8_t     state;
+} CacheEntry;
+
+static CacheEntry       cache[YDRV_CACHESIZE];
+static CacheEntry      *writing     = 0;
+static uint32_t         usecounter  = 0;
+static int32_t          failedblock = -1;
+static YDRV_StatsType   stats;
+static struct yaffs_dev device;
+static int              initialized = 0;
+
+
+/**
+ * @brief  CRC16 (CCITT) of the tags
+ */
+static uint16_t CRC16(const uint8_t *p, int n) {
+uint16_t crc = 0xFFFF;
+int i;
+
+    while( n-- > 0 ) {
+        crc ^= (uint16_t) (*p++)<<8;
+        for(i=0;i<8;i++) {
+            if( crc&0x8000 )
+                crc = (uint16_t) ((crc<<1)^CRC_POLY);
+            else
+                crc = (uint16_t) (crc<<1);
+        }
+    }
+    return crc;
+}
+
+/**
+ * @brief  Spread the tags and its CRC over the spare areas of the pages of a chunk
+ */
+static void PackTags(const uint8_t *tags, uint8_t sp[][NAND_SPARESIZE]) {
+uint8_t oob[OOBSIZE];
+uint16_t crc;
+unsigned i;
+
+    memcpy(oob,tags,YDRV_TAGSIZE);
+    crc = CRC16(tags,YDRV_TAGSIZE);
+    oob[YDRV_TAGSIZE]   = (uint8_t) crc;
+    oob[YDRV_TAGSIZE+1] = (uint8_t) (crc>>8);
+
+    memset(sp,0xFF,YDRV_PAGESPERCHUNK*NAND_SPARESIZE);
+    for(i=0;i<OOBSIZE;i++)
+        sp[i/FREEBYTES][freebytes[i%FREEBYTES]] = oob[i];
+}
+
+/**
+ * @brief  Gather the tags from the spare areas
+ *
+ * @note   Tags of an erased chunk are returned as all ones (YAFFS recognizes them)
+ *
+ * @return NAND_OK or NAND_ERR_ECC when the CRC does not match
+ */
+static int UnpackTags(uint8_t sp[][NAND_SPARESIZE], uint8_t *tags) {
+uint8_t oob[OOBSIZE];
+uint8_t all = 0xFF;
+uint16_t crc;
+unsigned i;
+
+    for(i=0;i<OOBSIZE;i++) {
+        oob[i] = sp[i/FREEBYTES][freebytes[i%FREEBYTES]];
+        all &= oob[i];
+    }
+    if( all == 0xFF ) {
+        memset(tags,0xFF,YDRV_TAGSIZE);
+        return NAND_OK;
+    }
+
+    crc = (uint16_t) (oob[YDRV_TAGSIZE]|(oob[YDRV_TAGSIZE+1]<<8));
+    if( crc != CRC16(oob,YDRV_TAGSIZE) )
+        return NAND_ERR_ECC;
+
+    memcpy(tags,oob,YDRV_TAGSIZE);
+    return NAND_OK;
+}
+
+static inline uint32_t ChunkAddress(int chunk) {
+
+    return (uint32_t) chunk*YDRV_CHUNKSIZE;
+}
+
+static inline int ChunkBlock(int chunk) {
+
+    return chunk/YDRV_CHUNKSPERBLOCK;
+}
+
+/**
+ * @brief  Find a cached chunk
+ */
+static CacheEntry *FindEntry(int chunk) {
+int i;
+
+    for(i=0;i<YDRV_CACHESIZE;i++) {
+        if( cache[i].state != ENTRY_FREE && cache[i].chunk == chunk )
+            return &cache[i];
+    }
+    return 0;
+}
+
+/**
+ * @brief  Get an entry for a chunk
+ *
+ * @note   The least recently used clean (or free) entry is reused. Entries being
+ *         written or that failed are not. It returns null if there is none.
+ */
+static CacheEntry *AllocEntry(int chunk) {
+CacheEntry *e;
+int i;
+
+    e = FindEntry(chunk);
+    if( e && e->state != ENTRY_CLEAN )
+        return 0;
+    if( e == 0 ) {
+        for(i=0;i<YDRV_CACHESIZE;i++) {
+            if( cache[i].state == ENTRY_FREE ) {
+                e = &cache[i];
+                break;
+            }
+            if( cache[i].state == ENTRY_CLEAN
+                && (e == 0 || (int32_t) (cache[i].stamp-e->stamp) < 0) )
+                e = &cache[i];
+        }
+        if( e == 0 )
+            return 0;
+    }
+    e->state = ENTRY_FREE;
+    e->chunk = chunk;
+    e->stamp = ++usecounter;
+    return e;
+}
+
+/**
+ * @brief  Drop all cached chunks of a block
+ */
+static void Invalidate(int block) {
+int i;
+
+    for(i=0;i<YDRV_CACHESIZE;i++) {
+        if( ChunkBlock(cache[i].chunk) == block )
+            cache[i].state = ENTRY_FREE;
+    }
+    if( failedblock == block )
+        failedblock = -1;
+}
+
+/**
+ * @brief  Wait for the end of the last write and check its result
+ */
+static int Collect(void) {
+int rc;
+
+    rc = NAND_Wait();
+    if( writing ) {
+        if( rc < 0 ) {
+            writing->state = ENTRY_FAILED;
+            failedblock = ChunkBlock(writing->chunk);
+            stats.writeerrors++;
+        } else {
+            writing->state = ENTRY_CLEAN;
+        }
+        writing = 0;
+    }
+    return rc;
+}
+
+
+/**
+ * @brief  YAFFS Hardware Interface
+ */
+
+
+/**
+ * @brief  Write a chunk into flash
+ *
+ * @note   This function writes the specified chunk data and oob/spare data to flash.
+ *         This function should return YAFFS_OK on success or YAFFS_FAIL on failure.
+ *         The ECC is generated by the EBI for each page. The tags are packed in the
+ *         spare areas.
+ */
+int DRIVE_write_chunk(struct yaffs_dev *dev, int nand_chunk,
+            const u8 *data, int data_len,
+            const u8 *oob, int oob_len) {
+uint8_t tags[YDRV_TAGSIZE];
+uint8_t sp[YDRV_PAGESPERCHUNK][NAND_SPARESIZE];
+const uint8_t *src;
+CacheEntry *e;
+uint32_t addr;
+int rc,rc2;
+int i;
+
+    (void) dev;
+
+    if( data == 0 || data_len != YDRV_CHUNKSIZE || oob_len > YDRV_TAGSIZE )
+        return YAFFS_FAIL;
+
+    stats.writes++;
+
+    (void) Collect();
+    if( failedblock >= 0 && failedblock == ChunkBlock(nand_chunk) ) {
+        // Report the error of the previous chunk. YAFFS skips and retires this block
+        failedblock = -1;
+        return YAFFS_FAIL;
+    }
+
+    memset(tags,0xFF,YDRV_TAGSIZE);
+    if( oob )
+        memcpy(tags,oob,oob_len);
+    PackTags(tags,sp);
+
+    e = AllocEntry(nand_chunk);
+    if( e ) {
+        memcpy(e->data,data,YDRV_CHUNKSIZE);
+        memcpy(e->tags,tags,YDRV_TAGSIZE);
+        src = (const uint8_t *) e->data;
+    } else {
+        src = data;
+    }
+
+    addr = ChunkAddress(nand_chunk);
+    rc = NAND_OK;
+    for(i=0;i<YDRV_PAGESPERCHUNK&&rc==NAND_OK;i++)
+        rc = NAND_WritePageStart(addr+i*NAND_PAGESIZE,src+i*NAND_PAGESIZE,sp[i]);
+
+    if( rc == NAND_OK && e && (nand_chunk+1)%YDRV_CHUNKSPERBLOCK != 0 ) {
+        e->state = ENTRY_WRITING;
+        writing  = e;
+        return YAFFS_OK;
+    }
+
+    rc2 = NAND_Wait();
+    if( rc == NAND_OK )
+        rc = rc2;
+    if( rc < 0 ) {
+        stats.writeerrors++;
+        return YAFFS_FAIL;
+    }
+    if( e )
+        e->state = ENTRY_CLEAN;
+    return YAFFS_OK;
+}
+
+/**
+ *  @brief  Read function
+ *
+ *  @note  This function reads the specified chunk data and oob/spare data from flash.
+ *         This function should return YAFFS_OK on success or YAFFS_FAIL on failure.
+ *         When data is null, only the spare areas are read (used by the scan).
+ */
+int DRIVE_read_chunk(struct yaffs_dev *dev, int nand_chunk,
+            u8 *data, int data_len,
+            u8 *oob, int oob_len,
+            enum yaffs_ecc_result *ecc_result) {
+uint8_t tags[YDRV_TAGSIZE];
+uint8_t sp[YDRV_PAGESPERCHUNK][NAND_SPARESIZE];
+uint8_t *dst;
+CacheEntry *e;
+uint32_t addr;
+int corrected = 0;
+int failed = 0;
+int rc;
+int i;
+
+    (void) dev;
+
+    if( ecc_result )
+        *ecc_result = YAFFS_ECC_RESULT_NO_ERROR;
+
+    if( (data && data_len != YDRV_CHUNKSIZE) || oob_len > YDRV_TAGSIZE )
+        return YAFFS_FAIL;
+
+    if( data )
+        stats.reads++;
+    else
+        stats.tagreads++;
+
+    e = FindEntry(nand_chunk);
+    if( e ) {
+        if( data )
+            memcpy(data,e->data,YDRV_CHUNKSIZE);
+        if( oob )
+            memcpy(oob,e->tags,oob_len);
+        e->stamp = ++usecounter;
+        stats.hits++;
+        return YAFFS_OK;
+    }
+
+    (void) Collect();
+
+    addr = ChunkAddress(nand_chunk);
+    if( data == 0 ) {
+        for(i=0;i<YDRV_PAGESPERCHUNK;i++) {
+            if( NAND_ReadSpare(addr+i*NAND_PAGESIZE,sp[i]) < 0 )
+                return YAFFS_FAIL;
+        }
+    } else {
+        e = AllocEntry(nand_chunk);
+        dst = e ? (uint8_t *) e->data : data;
+        for(i=0;i<YDRV_PAGESPERCHUNK;i++) {
+            rc = NAND_ReadPageSpare(addr+i*NAND_PAGESIZE,dst+i*NAND_PAGESIZE,sp[i]);
+            if( rc == NAND_ECC_CORRECTED ) {
+                corrected = 1;
+            } else if( rc == NAND_ERR_ECC ) {
+                failed = 1;
+            } else if( rc < 0 ) {
+                return YAFFS_FAIL;
+            }
+        }
+    }
+
+    if( UnpackTags(sp,tags) < 0 ) {
+        stats.tagerrors++;
+        failed = 1;
+    }
+
+    if( failed ) {
+        stats.eccerrors++;
+        if( ecc_result )
+            *ecc_result = YAFFS_ECC_RESULT_UNFIXED;
+    } else if( corrected ) {
+        stats.corrected++;
+        if( ecc_result )
+            *ecc_result = YAFFS_ECC_RESULT_FIXED;
+    }
+
+    if( e ) {
+        memcpy(data,e->data,YDRV_CHUNKSIZE);
+        if( !failed ) {
+            memcpy(e->tags,tags,YDRV_TAGSIZE);
+            e->state = ENTRY_CLEAN;
+        }
+    }
+    if( oob )
+        memcpy(oob,tags,oob_len);
+
+    return YAFFS_OK;
+}
+
+
+/**
+ *  @brief  Erase function
+ *
+ *  @note   This function erases the specified block. This function should return YAFFS_OK
+ *          on success or YAFFS_FAIL on failure.
+ */
+int DRIVE_erase(struct yaffs_dev *dev, int block_no) {
+
+    (void) dev;
+
+    stats.erases++;
+    (void) Collect();
+    Invalidate(block_no);
+
+    if( NAND_EraseBlock((uint32_t) block_no*NAND_BLOCKSIZE) < 0 )
+        return YAFFS_FAIL;
+    return YAFFS_OK;
+}
+
+
+/**
+ *  @brief  Mark a bad block
+ *
+ *  @note   This function is only required for Yaffs2 mode. It marks a block bad.
+ */
+int DRIVE_mark_bad(struct yaffs_dev *dev, int block_no) {
+
+    (void) dev;
+
+    (void) Collect();
+    Invalidate(block_no);
+
+    if( NANDBBT_MarkBad((uint32_t) block_no) < 0 )
+        return YAFFS_FAIL;
+    return YAFFS_OK;
+}
+
+
+/**
+ *  @brief  Check is a block is a bad block
+ *
+ *  @note   This function is only required for Yaffs2 mode. It returns YAFFS_FAIL when
+ *          the block is bad. The bad block table in RAM is used (see nand-bbt.c).
+ */
+int DRIVE_check_bad(struct yaffs_dev *dev, int block_no) {
+
+    (void) dev;
+
+    (void) Collect();
+
+    if( NANDBBT_IsBad((uint32_t) block_no) != 0 )
+        return YAFFS_FAIL;
+    return YAFFS_OK;
+}
+
+
+/**
+ *  @brief  Initialization
+ *
+ *  @note   The NAND device and the bad block table are initialized at the first call
+ */
+int DRIVE_initialise(struct yaffs_dev *dev) {
+
+    (void) dev;
+
+    memset(cache,0,sizeof(cache));
+    writing     = 0;
+    failedblock = -1;
+
+    if( !initialized ) {
+        if( NAND_Init() < 0 || NANDBBT_Load() < 0 )
+            return YAFFS_FAIL;
+        initialized = 1;
+    }
+    return YAFFS_OK;
+}
+
+
+/**
+ *  @brief  De-initialization
+ *
+ *  @note   It waits for the end of the last write
+ */
+int DRIVE_deinitialise(struct yaffs_dev *dev) {
+
+    (void) dev;
+
+    if( YDRV_Flush() < 0 )
+        return YAFFS_FAIL;
+    return YAFFS_OK;
+}
+
+
+/**
+ * @brief  Configure the YAFFS device and add it
+ *
+ * @note   The device must be mounted with yaffs_mount(name)
+ */
+struct yaffs_dev *YDRV_Install(const char *name) {
+struct yaffs_param *param = &device.param;
+struct yaffs_driver *drv = &device.drv;
+
+    memset(&device,0,sizeof(device));
+
+    param->name                     = name;
+    param->total_bytes_per_chunk    = YDRV_CHUNKSIZE;
+    param->spare_bytes_per_chunk    = YDRV_PAGESPERCHUNK*NAND_SPARESIZE;
+    param->chunks_per_block         = YDRV_CHUNKSPERBLOCK;
+    param->start_block              = YDRV_FIRSTBLOCK;
+    param->end_block                = YDRV_LASTBLOCK;
+    param->n_reserved_blocks        = YDRV_RESERVEDBLOCKS;
+    param->n_caches                 = YDRV_YAFFSCACHES;
+    param->is_yaffs2                = 1;
+    param->inband_tags              = 0;
+    param->no_tags_ecc              = 1;
+
+    drv->drv_write_chunk_fn         = DRIVE_write_chunk;
+    drv->drv_read_chunk_fn          = DRIVE_read_chunk;
+    drv->drv_erase_fn               = DRIVE_erase;
+    drv->drv_mark_bad_fn            = DRIVE_mark_bad;
+    drv->drv_check_bad_fn           = DRIVE_check_bad;
+    drv->drv_initialise_fn          = DRIVE_initialise;
+    drv->drv_deinitialise_fn        = DRIVE_deinitialise;
+
+    yaffs_add_device(&device);
+
+    return &device;
+}
+
+/**
+ * @brief  Wait for the end of the last write
+ *
+ * @note   It must be called before removing power (e.g., after yaffs_sync)
+ *
+ * @return NAND_OK or NAND_ERR_FAIL if a program error was not yet reported to YAFFS
+ */
+int YDRV_Flush(void) {
+int rc;
+
+    rc = Collect();
+    if( rc == NAND_OK && failedblock >= 0 )
+        rc = NAND_ERR_FAIL;
+    return rc;
+}
+
+void YDRV_GetStats(YDRV_StatsType *s) {
+
+    *s = stats;
+}
+
+void YDRV_ClearStats(void) {
+
+    memset(&stats,0,sizeof(stats));
+}
+
+#endif // USE_YAFFS
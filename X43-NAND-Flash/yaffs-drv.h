@@ -0,0 +1,61 @@
+#ifndef YAFFS_DRV_H
+#define YAFFS_DRV_H
+
+/**
+ * @file yaffs-drv.h
+ * @brief YAFFS2 hardware interface for the NAND256 Flash device in the EFM32GG-STK3700 board
+ *
+ * @note
+ *      A YAFFS chunk is formed by two NAND pages (1024 bytes), because YAFFS2 with tags
+ *      in the spare area does not accept chunks smaller than 1024 bytes. The tags are
+ *      packed in the free bytes of the spare areas of both pages.
+ *
+ * @version 1.0.0
+ * Date:    7 October 2023
+ *
+ */
+
+#include <stdint.h>
+#include "nand-flash.h"
+#include "nand-bbt.h"
+
+/**
+ *  @brief  Geometry as seen by YAFFS
+ */
+///@{
+#define YDRV_PAGESPERCHUNK                      (2)
+#define YDRV_CHUNKSIZE                          (YDRV_PAGESPERCHUNK*NAND_PAGESIZE)
+#define YDRV_CHUNKSPERBLOCK                     (NAND_PAGESPERBLOCK/YDRV_PAGESPERCHUNK)
+#define YDRV_TAGSIZE                            (16)
+#define YDRV_FIRSTBLOCK                         (NANDBBT_BLOCK+NANDBBT_BLOCKS)
+#define YDRV_LASTBLOCK                          (NAND_BLOCKCOUNT/2-1)  // Upper half: nand-log.c
+///@}
+
+/**
+ *  @brief  Chunk cache size (entries of YDRV_CHUNKSIZE bytes)
+ */
+#define YDRV_CACHESIZE                          (4)
+
+/**
+ *  @brief  Driver statistics
+ */
+typedef struct {
+    uint32_t    reads;                              /**< chunk reads from YAFFS   */
+    uint32_t    tagreads;                           /**< tags only reads          */
+    uint32_t    hits;                               /**< reads served by cache    */
+    uint32_t    writes;
+    uint32_t    erases;
+    uint32_t    corrected;                          /**< ECC corrected reads      */
+    uint32_t    eccerrors;                          /**< uncorrectable reads      */
+    uint32_t    tagerrors;                          /**< tags with bad CRC        */
+    uint32_t    writeerrors;
+} YDRV_StatsType;
+
+struct yaffs_dev;
+
+struct yaffs_dev *YDRV_Install(const char *name);
+int  YDRV_Flush(void);
+void YDRV_GetStats(YDRV_StatsType *stats);
+void YDRV_ClearStats(void);
+
+#endif // YAFFS_DRV_H
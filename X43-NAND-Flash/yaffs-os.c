@@ -0,0 +1,76 @@
+/**
+ * @file yaffs-os.c
+ * @brief YAFFS RTOS interface for a barebone system
+ *
+ * @note
+ *      It is only compiled when USE_YAFFS is defined. There is no multithreading, so
+ *      the lock functions do nothing. YAFFS must not be called from interrupts.
+ *
+ * @version 1.0.0
+ * Date:    7 October 2023
+ *
+ */
+
+#ifdef USE_YAFFS
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include "yaffs_osglue.h"
+
+/// Millisecond counter (incremented by SysTick_Handler in main.c)
+extern volatile uint64_t tick;
+
+static int lasterror = 0;
+
+
+void yaffsfs_Lock(void) {
+}
+
+void yaffsfs_Unlock(void) {
+}
+
+u32 yaffsfs_CurrentTime(void) {
+
+    return (u32) (tick/1000);
+}
+
+void yaffsfs_SetError(int err) {
+
+    lasterror = err;
+}
+
+int yaffsfs_GetLastError(void) {
+
+    return lasterror;
+}
+
+void *yaffsfs_malloc(size_t size) {
+
+    return malloc(size);
+}
+
+void yaffsfs_free(void *ptr) {
+
+    free(ptr);
+}
+
+int yaffsfs_CheckMemRegion(const void *addr, size_t size, int write_request) {
+
+    (void) size;
+    (void) write_request;
+
+    if( addr == 0 )
+        return -1;
+    return 0;
+}
+
+void yaffsfs_OSInitialisation(void) {
+}
+
+void yaffs_bug_fn(const char *file_name, int line_no) {
+
+    printf("yaffs bug at %s:%d\n",file_name,line_no);
+}
+
+#endif // USE_YAFFS